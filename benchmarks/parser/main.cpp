@@ -0,0 +1,84 @@
+#include <iostream>
+#include <iomanip>
+
+#include <sys/resource.h>
+
+#include "occa.hpp"
+
+// Times [parserBase::parseSource] on the OKL files shipped with OCCA
+//   ./main                      : Uses the default OKL corpus
+//   ./main [iterations] file... : Uses the given files
+
+long maxResidentKB(){
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+
+#if OCCA_OS == OSX_OS
+  return (usage.ru_maxrss / 1024);
+#else
+  return usage.ru_maxrss;
+#endif
+}
+
+int main(int argc, char **argv){
+  int iterations = 20;
+  std::vector<std::string> files;
+
+  if(1 < argc)
+    iterations = atoi(argv[1]);
+
+  for(int i = 2; i < argc; ++i)
+    files.push_back(argv[i]);
+
+  if(files.size() == 0){
+    const std::string occaDir = occa::getOCCADir();
+
+    files.push_back(occaDir + "/examples/addVectors/addVectors.okl");
+    files.push_back(occaDir + "/examples/reduction/reduction.okl");
+    files.push_back(occaDir + "/examples/fd2d/fd2d.okl");
+    files.push_back(occaDir + "/examples/fd2d/fd2d_shared.okl");
+    files.push_back(occaDir + "/examples/fd2d/fd2d_nonShared.okl");
+    files.push_back(occaDir + "/examples/midgTest/midg.okl");
+    files.push_back(occaDir + "/sandbox/tests/lookup_kernel.okl");
+  }
+
+  const int fileCount = files.size();
+  double totalTime = 0;
+
+  std::cout << std::left
+            << std::setw(50) << "File"
+            << std::setw(14) << "ms / parse"
+            << std::setw(14) << "Max RSS (KB)" << '\n';
+
+  for(int f = 0; f < fileCount; ++f){
+    const std::string source = occa::readFile(files[f]);
+
+    double fileTime = 0;
+
+    for(int i = 0; i < iterations; ++i){
+      occa::parser parser;
+      parser.warnForMissingBarriers     = false;
+      parser.warnForBarrierConditionals = false;
+
+      const double start = occa::currentTime();
+      parser.parseSource(source.c_str());
+      fileTime += (occa::currentTime() - start);
+    }
+
+    totalTime += fileTime;
+
+    std::string prefix, name;
+    occa::getFilePrefixAndName(files[f], prefix, name);
+
+    std::cout << std::left
+              << std::setw(50) << name
+              << std::setw(14) << (1.0e3 * fileTime / iterations)
+              << std::setw(14) << maxResidentKB() << '\n';
+  }
+
+  std::cout << "Total: " << (1.0e3 * totalTime) << " ms for "
+            << iterations << " iterations of "
+            << fileCount  << " files\n";
+
+  return 0;
+}
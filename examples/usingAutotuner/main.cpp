@@ -0,0 +1,64 @@
+#include <iostream>
+
+#include "occa.hpp"
+
+int main(int argc, char **argv){
+  int entries = (1 << 20);
+
+  float *a = new float[entries];
+
+  for(int i = 0; i < entries; ++i)
+    a[i] = 1;
+
+  occa::device device;
+  device.setup("mode = OpenMP");
+
+  occa::memory o_a    = device.malloc(entries*sizeof(float), a);
+  occa::memory o_aRed = device.malloc(entries*sizeof(float));
+
+  // The fastest [p_Nred] is stored in the OCCA cache for this device,
+  //   later runs skip the tuning and build the kernel directly
+  occa::autotuner tuner(device, "reduction.okl", "reduction");
+
+  tuner.addDefine("p_Nred", 64);
+  tuner.addDefine("p_Nred", 128);
+  tuner.addDefine("p_Nred", 256);
+  tuner.addDefine("p_Nred", 512);
+
+  tuner.addArgument(0, entries);
+  tuner.addArgument(1, o_a);
+  tuner.addArgument(2, o_aRed);
+
+  occa::kernel reduction = tuner.build();
+
+  std::cout << "Best setup: " << tuner.best << '\n';
+
+  std::stringstream ss(tuner.best.defineValues[0]);
+  int p_Nred;
+  ss >> p_Nred;
+
+  const int reducedEntries = (entries + p_Nred - 1)/p_Nred;
+  float *aRed = new float[reducedEntries];
+
+  reduction(entries, o_a, o_aRed);
+
+  o_aRed.copyTo(aRed, reducedEntries*sizeof(float));
+
+  for(int i = 0; i < reducedEntries; ++i){
+    if(aRed[i] != p_Nred)
+      throw 1;
+  }
+
+  std::cout << "Reduction is correct\n";
+
+  delete [] a;
+  delete [] aRed;
+
+  reduction.free();
+  o_a.free();
+  o_aRed.free();
+
+  device.free();
+
+  return 0;
+}
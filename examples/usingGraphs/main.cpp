@@ -0,0 +1,72 @@
+#include <iostream>
+
+#include "occa.hpp"
+
+int main(int argc, char **argv){
+  int entries = 1024;
+  int steps   = 10;
+
+  float *x = new float[entries];
+  float *y = new float[entries];
+
+  for(int i = 0; i < entries; ++i){
+    x[i] = 1;
+    y[i] = 0;
+  }
+
+  occa::device device;
+  device.setup("mode = OpenMP");
+
+  occa::memory o_x = device.malloc(entries*sizeof(float), x);
+  occa::memory o_y = device.malloc(entries*sizeof(float), y);
+
+  occa::kernel axpy = device.buildKernelFromSource("axpy.okl",
+                                                   "axpy");
+
+  // Record one step:
+  //   y += alpha*x
+  //   y += x
+  occa::graph step(device);
+
+  const int scaledAxpy = step.addKernel(axpy);
+  step.setArgument(scaledAxpy, 0, entries);
+  step.setArgument(scaledAxpy, 1, 0.0f);
+  step.setArgument(scaledAxpy, 2, o_x);
+  step.setArgument(scaledAxpy, 3, o_y);
+
+  const int unitAxpy = step.addKernel(axpy);
+  step.setArgument(unitAxpy, 0, entries);
+  step.setArgument(unitAxpy, 1, 1.0f);
+  step.setArgument(unitAxpy, 2, o_x);
+  step.setArgument(unitAxpy, 3, o_y);
+
+  step.addCopyTo(y, o_y);
+
+  float expected = 0;
+
+  for(int t = 0; t < steps; ++t){
+    // Only alpha changes between steps
+    step.setArgument(scaledAxpy, 1, (float) t);
+    step.run();
+
+    expected += (t + 1);
+  }
+
+  for(int i = 0; i < entries; ++i){
+    if(y[i] != expected)
+      throw 1;
+  }
+
+  std::cout << "y = " << expected << '\n';
+
+  delete [] x;
+  delete [] y;
+
+  axpy.free();
+  o_x.free();
+  o_y.free();
+
+  device.free();
+
+  return 0;
+}
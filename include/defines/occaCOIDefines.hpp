@@ -80,7 +80,7 @@ typedef struct double4_t { double  x,y,z,w; } double4;
 
 
 //---[ Attributes ]-------------------------------
-#define occaShared
+#define occaShared   occaAligned
 #define occaPointer
 #define occaVariable &
 
@@ -207,6 +207,23 @@ typedef struct double4_t { double  x,y,z,w; } double4;
 #define occaUnroll3(N) _Pragma(#N)
 #define occaUnroll2(N) occaUnroll3(N)
 #define occaUnroll(N)  occaUnroll2(unroll N)
+// - - - - - - - - - - - - - - - - - - - - - - - -
+#define occaPragma2(X) _Pragma(#X)
+#define occaPragma(X)  occaPragma2(X)
+
+#if defined(_OPENMP) && (_OPENMP >= 201307)
+#  define occaSimdFor0                _Pragma("omp simd")
+#  define occaAlignedSimdFor0(...)    occaPragma(omp simd aligned(__VA_ARGS__ : OCCA_MEM_ALIGN))
+#elif defined(__INTEL_COMPILER)
+#  define occaSimdFor0                _Pragma("simd")
+#  define occaAlignedSimdFor0(...)    _Pragma("simd")
+#elif defined(__GNUC__)
+#  define occaSimdFor0                _Pragma("GCC ivdep")
+#  define occaAlignedSimdFor0(...)    _Pragma("GCC ivdep")
+#else
+#  define occaSimdFor0
+#  define occaAlignedSimdFor0(...)
+#endif
 //================================================
 
 
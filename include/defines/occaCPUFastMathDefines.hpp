@@ -0,0 +1,483 @@
+#ifndef OCCA_CPU_FAST_MATH_DEFINES_HEADER
+#define OCCA_CPU_FAST_MATH_DEFINES_HEADER
+
+#include <string.h>
+
+//---[ Fast Math ]--------------------------------
+//  Approximations behind occaFast* and occaNative* on CPU modes. They
+//    inline to straight-line code, so loops calling them vectorize like
+//    plain arithmetic when kernels are compiled with -O3
+//
+//  Compares and selects are done on the bits with integer masks, the
+//    compiler won't if-convert float compares under -ftrapping-math
+//
+//  Max errors measured against the exact result, in ULPs
+//
+//            float  double
+//    exp      1.5    1.5    (Underflows to 0 and overflows to inf)
+//    log2     2      2
+//    log10    2.5    2
+//    pow      2 + 2*|y*log2(|x|)|  (Signs and special cases follow <cmath>)
+//    sin      1.5    1.5    (|x| <= pi)
+//    cos      1.5    1.5    (|x| <= pi)
+//    tan      3      3      (|x| <= pi/2)
+//
+//  Larger arguments to sin and cos keep an absolute error below 2^-23
+//    (float, |x| < 8192) and 2^-52 (double, |x| < 1e6)
+//
+//  sin, cos and tan only reduce |x| up to 1e5 (float) and 1e9 (double),
+//    arguments past that are reduced as if they were +-1e5 or +-1e9 and
+//    the results are meaningless. Use sin, cos and tan for those, falling
+//    back to libm here would keep every loop calling them from vectorizing
+//
+//  Integer arguments are computed in double, like <cmath>
+inline int occaCPU_bits(const float f){
+  int i;
+  memcpy(&i, &f, sizeof(float));
+  return i;
+}
+
+inline int64_t occaCPU_bits(const double d){
+  int64_t i;
+  memcpy(&i, &d, sizeof(double));
+  return i;
+}
+
+inline float occaCPU_floatFromBits(const int i){
+  float f;
+  memcpy(&f, &i, sizeof(float));
+  return f;
+}
+
+inline double occaCPU_doubleFromBits(const int64_t i){
+  double d;
+  memcpy(&d, &i, sizeof(double));
+  return d;
+}
+
+// [cond] ? a : b with [cond] 0 or 1
+inline float occaCPU_select(const int cond, const float a, const float b){
+  const int mask = -((int) cond);
+
+  return occaCPU_floatFromBits((occaCPU_bits(a) & mask) | (occaCPU_bits(b) & ~mask));
+}
+
+inline double occaCPU_select(const int cond, const double a, const double b){
+  const int64_t mask = -((int64_t) cond);
+
+  return occaCPU_doubleFromBits((occaCPU_bits(a) & mask) | (occaCPU_bits(b) & ~mask));
+}
+
+// Integers ordered like the floats they come from
+inline int occaCPU_orderedBits(const float f){
+  const int i = occaCPU_bits(f);
+  return (i ^ ((i >> 31) & 0x7fffffff));
+}
+
+inline int64_t occaCPU_orderedBits(const double d){
+  const int64_t i = occaCPU_bits(d);
+  return (i ^ ((i >> 63) & 0x7fffffffffffffffLL));
+}
+
+template <class TM>
+inline TM occaCPU_clamp(const TM x, const TM lo, const TM hi){
+  const TM xlo = occaCPU_select(occaCPU_orderedBits(x) < occaCPU_orderedBits(lo), lo, x);
+
+  return occaCPU_select(occaCPU_orderedBits(hi) < occaCPU_orderedBits(xlo), hi, xlo);
+}
+
+inline int occaCPU_isFinite(const float x){
+  return ((occaCPU_bits(x) & 0x7fffffff) < 0x7f800000);
+}
+
+inline int occaCPU_isFinite(const double x){
+  return ((occaCPU_bits(x) & 0x7fffffffffffffffLL) < 0x7ff0000000000000LL);
+}
+
+inline int occaCPU_isNaN(const float x){
+  return (0x7f800000 < (occaCPU_bits(x) & 0x7fffffff));
+}
+
+inline int occaCPU_isNaN(const double x){
+  return (0x7ff0000000000000LL < (occaCPU_bits(x) & 0x7fffffffffffffffLL));
+}
+
+inline float occaCPU_abs(const float x){
+  return occaCPU_floatFromBits(occaCPU_bits(x) & 0x7fffffff);
+}
+
+inline double occaCPU_abs(const double x){
+  return occaCPU_doubleFromBits(occaCPU_bits(x) & 0x7fffffffffffffffLL);
+}
+
+// 1 for integer [y], [odd] is set for odd ones
+//   Floats from 2^23 up are integers, from 2^24 up even ones
+inline int occaCPU_isInteger(const float y, int &odd){
+  const float ya    = occaCPU_clamp(occaCPU_abs(y), 0.0f, 16777216.0f);
+  const int   small = (occaCPU_bits(ya) < 0x4b000000);
+
+  // Rounds [ya] into the last mantissa bits
+  const float t = occaCPU_select(small, ya + 8388608.0f, ya);
+
+  odd = (occaCPU_bits(t) & 1);
+
+  return (occaCPU_bits(occaCPU_select(small, t - 8388608.0f, t)) == occaCPU_bits(ya));
+}
+
+//   Doubles from 2^52 up are integers, from 2^53 up even ones
+inline int occaCPU_isInteger(const double y, int &odd){
+  const double ya    = occaCPU_clamp(occaCPU_abs(y), 0.0, 9007199254740992.0);
+  const int    small = (occaCPU_bits(ya) < 0x4330000000000000LL);
+
+  const double t = occaCPU_select(small, ya + 4503599627370496.0, ya);
+
+  odd = (int) (occaCPU_bits(t) & 1);
+
+  return (occaCPU_bits(occaCPU_select(small, t - 4503599627370496.0, t)) == occaCPU_bits(ya));
+}
+
+// 2^k split in two factors to reach denormals and infinity
+inline float occaCPU_scale(const float x, const int k){
+  const int k1 = (k >> 1);
+  const int k2 = (k - k1);
+
+  return ((x * occaCPU_floatFromBits((k1 + 127) << 23))
+          *   occaCPU_floatFromBits((k2 + 127) << 23));
+}
+
+inline double occaCPU_scale(const double x, const int k){
+  const int k1 = (k >> 1);
+  const int k2 = (k - k1);
+
+  return ((x * occaCPU_doubleFromBits(((int64_t) (k1 + 1023)) << 52))
+          *   occaCPU_doubleFromBits(((int64_t) (k2 + 1023)) << 52));
+}
+// - - - - - - - - - - - - - - - - - - - - - - - -
+
+inline float occaCPU_fastExp(const float x){
+  const float xc = occaCPU_clamp(x, -104.0f, 89.0f);
+
+  // x = k*ln(2) + r, |r| <= ln(2)/2 (the bias keeps the truncation a floor)
+  const int   k  = (((int) (1.44269504f*xc + 256.5f)) - 256);
+  const float kf = (float) k;
+  const float r  = ((xc - kf*0.693359375f) + kf*2.12194440e-4f);
+
+  const float p = 1.0f + r*(1.0f + r*(0.5f + r*(1.66666667e-1f + r*(4.16666667e-2f +
+                  r*(8.33333333e-3f + r*(1.38888889e-3f + r*1.98412698e-4f))))));
+
+  return occaCPU_select(occaCPU_isNaN(x), x, occaCPU_scale(p, k));
+}
+
+inline double occaCPU_fastExp(const double x){
+  const double xc = occaCPU_clamp(x, -746.0, 710.0);
+
+  const int    k  = (((int) (1.44269504088896340736*xc + 2048.5)) - 2048);
+  const double kd = (double) k;
+  const double r  = ((xc - kd*6.93147180369123816490e-01) - kd*1.90821492927058770002e-10);
+
+  const double p = 1.0 + r*(1.0 + r*(0.5 + r*(1.66666666666666667e-1 + r*(4.16666666666666667e-2 +
+                   r*(8.33333333333333333e-3 + r*(1.38888888888888889e-3 + r*(1.98412698412698413e-4 +
+                   r*(2.48015873015873016e-5 + r*(2.75573192239858907e-6 + r*(2.75573192239858907e-7 +
+                   r*(2.50521083854417188e-8 + r*(2.08767569878680990e-9 + r*1.60590438368216146e-10))))))))))));
+
+  return occaCPU_select(occaCPU_isNaN(x), x, occaCPU_scale(p, k));
+}
+// - - - - - - - - - - - - - - - - - - - - - - - -
+
+// x = 2^e * (1 + f) with sqrt(1/2) <= (1 + f) < sqrt(2)
+inline float occaCPU_logSplit(const float x, float &e){
+  const int isDenormal = (occaCPU_bits(x) < 0x00800000);
+
+  const int bits = occaCPU_bits(occaCPU_select(isDenormal, x*8388608.0f, x));
+
+  const int mBits = ((bits & 0x007fffff) | 0x3f800000);
+  const int isBig = (0x3fb504f3 < mBits);
+
+  const float m = occaCPU_floatFromBits(mBits - (isBig << 23));
+
+  e = (float) (((bits >> 23) & 0xff) - 127 - 23*isDenormal + isBig);
+
+  return (m - 1.0f);
+}
+
+inline double occaCPU_logSplit(const double x, double &e){
+  const int isDenormal = (occaCPU_bits(x) < 0x0010000000000000LL);
+
+  const int64_t bits = occaCPU_bits(occaCPU_select(isDenormal, x*4503599627370496.0, x));
+
+  const int64_t mBits = ((bits & 0x000fffffffffffffLL) | 0x3ff0000000000000LL);
+  const int     isBig = (0x3ff6a09e667f3bcdLL < mBits);
+
+  const double m = occaCPU_doubleFromBits(mBits - (((int64_t) isBig) << 52));
+
+  e = (double) (((int) ((bits >> 52) & 0x7ff)) - 1023 - 52*isDenormal + isBig);
+
+  return (m - 1.0);
+}
+
+// log(1 + f) = f - s*(f - R) with s = f/(2 + f) and R = 2s^2/3 + 2s^4/5 + ...
+inline float occaCPU_log1pSeries(const float f){
+  const float s    = f / (2.0f + f);
+  const float s2   = s*s;
+  const float hfsq = 0.5f*f*f;
+
+  const float R = s2*(6.66666667e-1f + s2*(4.0e-1f + s2*(2.85714286e-1f + s2*2.22222222e-1f)));
+
+  return (f - (hfsq - s*(hfsq + R)));
+}
+
+inline double occaCPU_log1pSeries(const double f){
+  const double s    = f / (2.0 + f);
+  const double s2   = s*s;
+  const double hfsq = 0.5*f*f;
+
+  const double R = s2*(6.66666666666666667e-1 + s2*(4.0e-1 + s2*(2.85714285714285714e-1 +
+                   s2*(2.22222222222222222e-1 + s2*(1.81818181818181818e-1 + s2*(1.53846153846153846e-1 +
+                   s2*(1.33333333333333333e-1 + s2*(1.17647058823529412e-1 + s2*(1.05263157894736842e-1 +
+                   s2*9.52380952380952381e-2)))))))));
+
+  return (f - (hfsq - s*(hfsq + R)));
+}
+
+// -inf for 0, NaN for x < 0, inf and NaN are passed through
+inline float occaCPU_logSpecialCases(const float x, const float ret){
+  const int bits = occaCPU_bits(x);
+
+  const float ret2 = occaCPU_select(0x7f800000 <= bits, x, ret);
+  const float ret1 = occaCPU_select(bits < 0, occaCPU_floatFromBits(0x7fc00000), ret2);
+
+  return occaCPU_select((bits & 0x7fffffff) == 0, occaCPU_floatFromBits((int) 0xff800000), ret1);
+}
+
+inline double occaCPU_logSpecialCases(const double x, const double ret){
+  const int64_t bits = occaCPU_bits(x);
+
+  const double ret2 = occaCPU_select(0x7ff0000000000000LL <= bits, x, ret);
+  const double ret1 = occaCPU_select(bits < 0, occaCPU_doubleFromBits(0x7ff8000000000000LL), ret2);
+
+  return occaCPU_select((bits & 0x7fffffffffffffffLL) == 0, occaCPU_doubleFromBits((int64_t) 0xfff0000000000000ULL), ret1);
+}
+
+inline float occaCPU_fastLog2(const float x){
+  float e;
+  const float f = occaCPU_logSplit(x, e);
+
+  return occaCPU_logSpecialCases(x, e + 1.44269504f*occaCPU_log1pSeries(f));
+}
+
+inline double occaCPU_fastLog2(const double x){
+  double e;
+  const double f = occaCPU_logSplit(x, e);
+
+  return occaCPU_logSpecialCases(x, e + 1.44269504088896340736*occaCPU_log1pSeries(f));
+}
+
+inline float occaCPU_fastLog10(const float x){
+  float e;
+  const float f = occaCPU_logSplit(x, e);
+
+  return occaCPU_logSpecialCases(x, (e*3.01029996e-1f +
+                                     4.34294482e-1f*occaCPU_log1pSeries(f)));
+}
+
+inline double occaCPU_fastLog10(const double x){
+  double e;
+  const double f = occaCPU_logSplit(x, e);
+
+  return occaCPU_logSpecialCases(x, (e*3.01029995663981195214e-1 +
+                                     4.34294481903251827651e-1*occaCPU_log1pSeries(f)));
+}
+// - - - - - - - - - - - - - - - - - - - - - - - -
+
+// [ret] = exp(y*log|x|), applies the sign and special cases of <cmath>
+template <class TM>
+inline TM occaCPU_powSpecialCases(const TM x, const TM y, const TM ret, const TM nan){
+  const TM one = 1;
+
+  int yIsOdd;
+  const int yIsInteger = occaCPU_isInteger(y, yIsOdd);
+
+  const TM  absX        = occaCPU_abs(x);
+  const int xIsNegative = (occaCPU_bits(x) < 0);
+
+  // x^0, 1^y and (-1)^(+-inf)
+  const int isOne = ((occaCPU_bits(occaCPU_abs(y)) == 0)    |
+                     (occaCPU_bits(x) == occaCPU_bits(one)) |
+                     ((occaCPU_bits(absX) == occaCPU_bits(one)) &
+                      !occaCPU_isFinite(y) & !occaCPU_isNaN(y)));
+
+  // Finite x < 0 with a non-integer y
+  const int isNaN = (xIsNegative & !yIsInteger &
+                     (0 < occaCPU_bits(absX)) & occaCPU_isFinite(x));
+
+  const TM signedRet = occaCPU_select(xIsNegative & yIsInteger & yIsOdd, -ret, ret);
+
+  return occaCPU_select(isOne, one, occaCPU_select(isNaN, nan, signedRet));
+}
+
+// pow(x, y) = +-exp(y*log|x|)
+inline float occaCPU_fastPow(const float x, const float y){
+  const float absX = occaCPU_abs(x);
+
+  float e;
+  const float f = occaCPU_logSplit(absX, e);
+
+  const float logX = occaCPU_logSpecialCases(absX, (e*6.93147181e-1f + occaCPU_log1pSeries(f)));
+
+  return occaCPU_powSpecialCases(x, y,
+                                 occaCPU_fastExp(y*logX),
+                                 occaCPU_floatFromBits(0x7fc00000));
+}
+
+inline double occaCPU_fastPow(const double x, const double y){
+  const double absX = occaCPU_abs(x);
+
+  double e;
+  const double f = occaCPU_logSplit(absX, e);
+
+  const double logX = occaCPU_logSpecialCases(absX, (e*6.93147180559945309417e-1 + occaCPU_log1pSeries(f)));
+
+  return occaCPU_powSpecialCases(x, y,
+                                 occaCPU_fastExp(y*logX),
+                                 occaCPU_doubleFromBits(0x7ff8000000000000LL));
+}
+// - - - - - - - - - - - - - - - - - - - - - - - -
+
+// x = q*(pi/2) + r, |r| <= pi/4, returns sin(r) and cos(r)
+inline int occaCPU_sinCos(const float x, float &s, float &c){
+  const float xc = occaCPU_clamp(x, -1.0e5f, 1.0e5f);
+
+  const int   q  = (((int) (6.36619772e-1f*xc + 65536.5f)) - 65536);
+  const float qf = (float) q;
+  const float r  = (((xc - qf*1.5703125f) - qf*4.837512969970703125e-4f) - qf*7.54978995489188216e-8f);
+  const float r2 = r*r;
+
+  s = r + r*r2*(-1.66666667e-1f + r2*(8.33333333e-3f + r2*(-1.98412698e-4f + r2*2.75573192e-6f)));
+  c = 1.0f + r2*(-0.5f + r2*(4.16666667e-2f + r2*(-1.38888889e-3f + r2*(2.48015873e-5f + r2*-2.75573192e-7f))));
+
+  return q;
+}
+
+inline int occaCPU_sinCos(const double x, double &s, double &c){
+  const double xc = occaCPU_clamp(x, -1.0e9, 1.0e9);
+
+  const int    q  = (((int) (6.36619772367581343076e-1*xc + 1073741824.5)) - 1073741824);
+  const double qd = (double) q;
+  const double r  = (((xc - qd*1.57079632673412561417e+00) - qd*6.07710050630396597660e-11) - qd*2.02226624879595063154e-21);
+  const double r2 = r*r;
+
+  s = r + r*r2*(-1.66666666666666667e-1 + r2*(8.33333333333333333e-3 + r2*(-1.98412698412698413e-4 +
+      r2*(2.75573192239858907e-6 + r2*(-2.50521083854417188e-8 + r2*(1.60590438368216146e-10 +
+      r2*(-7.64716373181981648e-13 + r2*2.81145725434552076e-15)))))));
+
+  c = 1.0 + r2*(-0.5 + r2*(4.16666666666666667e-2 + r2*(-1.38888888888888889e-3 + r2*(2.48015873015873016e-5 +
+      r2*(-2.75573192239858907e-7 + r2*(2.08767569878680990e-9 + r2*(-1.14707455977297247e-11 +
+      r2*4.77947733238738530e-14)))))));
+
+  return q;
+}
+
+template <class TM>
+inline TM occaCPU_fastSin_(const TM x){
+  TM s, c;
+  const int q = occaCPU_sinCos(x, s, c);
+
+  const TM ret = occaCPU_select(q & 1, c, s);
+
+  return occaCPU_select(occaCPU_isFinite(x),
+                        occaCPU_select((q >> 1) & 1, -ret, ret),
+                        x - x);
+}
+
+template <class TM>
+inline TM occaCPU_fastCos_(const TM x){
+  TM s, c;
+  const int q = occaCPU_sinCos(x, s, c);
+
+  const TM ret = occaCPU_select(q & 1, s, c);
+
+  return occaCPU_select(occaCPU_isFinite(x),
+                        occaCPU_select(((q + 1) >> 1) & 1, -ret, ret),
+                        x - x);
+}
+
+template <class TM>
+inline TM occaCPU_fastTan_(const TM x){
+  TM s, c;
+  const int q = occaCPU_sinCos(x, s, c);
+
+  // tan(r + pi/2) = -cos(r)/sin(r)
+  const TM num = occaCPU_select(q & 1, -c, s);
+  const TM den = occaCPU_select(q & 1, s, c);
+
+  return occaCPU_select(occaCPU_isFinite(x), num / den, x - x);
+}
+
+inline float  occaCPU_fastSin(const float x){  return occaCPU_fastSin_(x); }
+inline double occaCPU_fastSin(const double x){ return occaCPU_fastSin_(x); }
+
+inline float  occaCPU_fastCos(const float x){  return occaCPU_fastCos_(x); }
+inline double occaCPU_fastCos(const double x){ return occaCPU_fastCos_(x); }
+
+inline float  occaCPU_fastTan(const float x){  return occaCPU_fastTan_(x); }
+inline double occaCPU_fastTan(const double x){ return occaCPU_fastTan_(x); }
+// - - - - - - - - - - - - - - - - - - - - - - - -
+
+// Without these, integer arguments are ambiguous between float and double
+template <class TM> struct occaCPU_promote {};
+
+template <> struct occaCPU_promote<float>  { typedef float  type; };
+template <> struct occaCPU_promote<double> { typedef double type; };
+
+#define OCCA_CPU_PROMOTE_TO_DOUBLE(TM)                                \
+  template <> struct occaCPU_promote<TM> { typedef double type; }
+
+OCCA_CPU_PROMOTE_TO_DOUBLE(bool);
+OCCA_CPU_PROMOTE_TO_DOUBLE(char);
+OCCA_CPU_PROMOTE_TO_DOUBLE(signed char);
+OCCA_CPU_PROMOTE_TO_DOUBLE(unsigned char);
+OCCA_CPU_PROMOTE_TO_DOUBLE(short);
+OCCA_CPU_PROMOTE_TO_DOUBLE(unsigned short);
+OCCA_CPU_PROMOTE_TO_DOUBLE(int);
+OCCA_CPU_PROMOTE_TO_DOUBLE(unsigned int);
+OCCA_CPU_PROMOTE_TO_DOUBLE(long);
+OCCA_CPU_PROMOTE_TO_DOUBLE(unsigned long);
+OCCA_CPU_PROMOTE_TO_DOUBLE(long long);
+OCCA_CPU_PROMOTE_TO_DOUBLE(unsigned long long);
+
+#undef OCCA_CPU_PROMOTE_TO_DOUBLE
+
+// float only when both are float
+template <class TM1, class TM2> struct occaCPU_widest { typedef double type; };
+template <> struct occaCPU_widest<float, float> { typedef float type; };
+
+template <class TM1, class TM2>
+struct occaCPU_promote2 {
+  typedef typename occaCPU_widest<typename occaCPU_promote<TM1>::type,
+                                  typename occaCPU_promote<TM2>::type>::type type;
+};
+
+#define OCCA_CPU_PROMOTED_FUNCTION(FUNC)                                \
+  template <class TM>                                                   \
+  inline typename occaCPU_promote<TM>::type FUNC(const TM x){           \
+    return FUNC((typename occaCPU_promote<TM>::type) x);                \
+  }
+
+OCCA_CPU_PROMOTED_FUNCTION(occaCPU_fastExp)
+OCCA_CPU_PROMOTED_FUNCTION(occaCPU_fastLog2)
+OCCA_CPU_PROMOTED_FUNCTION(occaCPU_fastLog10)
+OCCA_CPU_PROMOTED_FUNCTION(occaCPU_fastSin)
+OCCA_CPU_PROMOTED_FUNCTION(occaCPU_fastCos)
+OCCA_CPU_PROMOTED_FUNCTION(occaCPU_fastTan)
+
+#undef OCCA_CPU_PROMOTED_FUNCTION
+
+template <class TM1, class TM2>
+inline typename occaCPU_promote2<TM1, TM2>::type occaCPU_fastPow(const TM1 x, const TM2 y){
+  typedef typename occaCPU_promote2<TM1, TM2>::type TM;
+
+  return occaCPU_fastPow((TM) x, (TM) y);
+}
+//================================================
+
+#endif
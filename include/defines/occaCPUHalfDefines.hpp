@@ -0,0 +1,167 @@
+#ifndef OCCA_CPU_HALF_DEFINES_HEADER
+#define OCCA_CPU_HALF_DEFINES_HEADER
+
+#include <string.h>
+
+//---[ Half Precision ]---------------------------
+//  half and bfloat16 are storage types, like OpenCL's half they are
+//    read and written through the load/store helpers
+//
+//    float  occaLoadHalf(ptr, n)               ptr[n]
+//    void   occaStoreHalf(ptr, n, value)       ptr[n] = value
+//    float4 occaLoadHalfx4(ptr, n)             ptr[4n], ..., ptr[4n + 3]
+//    void   occaStoreHalfx4(ptr, n, value)
+//
+//    occaLoadBfloat16, occaStoreBfloat16, ... work the same way
+//
+//  Stores round to nearest even. Scalar conversions are branchless and
+//    vectorize in inner loops, x4 conversions use F16C when available
+#if defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__))
+#  define OCCA_CPU_HALF_F16C 1
+#  include <immintrin.h>
+#else
+#  define OCCA_CPU_HALF_F16C 0
+#endif
+
+typedef struct half_t     { uint16_t bits; } half;
+typedef struct bfloat16_t { uint16_t bits; } bfloat16;
+
+inline uint32_t occaCPU_floatBits(const float f){
+  uint32_t i;
+  memcpy(&i, &f, sizeof(float));
+  return i;
+}
+
+inline float occaCPU_bitsToFloat(const uint32_t i){
+  float f;
+  memcpy(&f, &i, sizeof(float));
+  return f;
+}
+
+// [cond] ? a : b with [cond] 0 or 1
+inline uint32_t occaCPU_selectBits(const uint32_t cond, const uint32_t a, const uint32_t b){
+  const uint32_t mask = (0 - cond);
+  return ((a & mask) | (b & ~mask));
+}
+
+inline float occaCPU_halfToFloat(const uint16_t h){
+  const uint32_t sign = ((uint32_t) (h & 0x8000)) << 16;
+  const uint32_t em   = (h & 0x7fff);
+
+  // Rebiased exponent
+  const uint32_t normal = (em << 13) + 0x38000000;
+
+  // Denormals are (mantissa * 2^-24), done without float denormals
+  //   so they survive flush-to-zero
+  const uint32_t denormal = occaCPU_floatBits(((float) (int) em) * 5.9604644775390625e-8f);
+
+  // Inf and NaN keep their payload, NaNs come back quiet
+  const uint32_t infNaN = ((em << 13) | 0x7f800000 | (((uint32_t) (0x7c00 < em)) << 22));
+
+  return occaCPU_bitsToFloat(sign | occaCPU_selectBits((uint32_t) (0x7c00 <= em),
+                                                       infNaN,
+                                                       occaCPU_selectBits((uint32_t) (em < 0x0400),
+                                                                          denormal,
+                                                                          normal)));
+}
+
+inline uint16_t occaCPU_floatToHalf(const float f){
+  const uint32_t bits    = occaCPU_floatBits(f);
+  const uint32_t sign    = (bits & 0x80000000) >> 16;
+  const uint32_t absBits = (bits & 0x7fffffff);
+
+  // Normal halfs: rebias and round on the bits
+  const uint32_t normal = (absBits + 0xc8000fff + ((absBits >> 13) & 1)) >> 13;
+
+  // Denormal halfs: the float add rounds the mantissa into place,
+  //   float denormals are below the half range and go to 0 anyway
+  const uint32_t denormal = (occaCPU_floatBits(occaCPU_bitsToFloat(absBits) + 0.5f) - 0x3f000000);
+
+  // Overflows go to inf, NaNs stay quiet NaNs
+  const uint32_t big = occaCPU_selectBits((uint32_t) (0x7f800000 < absBits), 0x7e00, 0x7c00);
+
+  const uint32_t h = occaCPU_selectBits((uint32_t) (0x477ff000 <= absBits),
+                                        big,
+                                        occaCPU_selectBits((uint32_t) (absBits < 0x38800000),
+                                                           denormal,
+                                                           normal));
+  return (uint16_t) (sign | h);
+}
+
+inline float occaCPU_bfloat16ToFloat(const uint16_t b){
+  return occaCPU_bitsToFloat(((uint32_t) b) << 16);
+}
+
+inline uint16_t occaCPU_floatToBfloat16(const float f){
+  const uint32_t bits = occaCPU_floatBits(f);
+
+  const uint32_t rounded = (bits + 0x7fff + ((bits >> 16) & 1)) >> 16;
+  const uint32_t isNaN   = (uint32_t) (0x7f800000 < (bits & 0x7fffffff));
+
+  return (uint16_t) occaCPU_selectBits(isNaN, (bits >> 16) | 0x40, rounded);
+}
+
+inline float occaLoadHalf(const half *ptr, const int n){
+  return occaCPU_halfToFloat(ptr[n].bits);
+}
+
+inline void occaStoreHalf(half *ptr, const int n, const float value){
+  ptr[n].bits = occaCPU_floatToHalf(value);
+}
+
+inline float occaLoadBfloat16(const bfloat16 *ptr, const int n){
+  return occaCPU_bfloat16ToFloat(ptr[n].bits);
+}
+
+inline void occaStoreBfloat16(bfloat16 *ptr, const int n, const float value){
+  ptr[n].bits = occaCPU_floatToBfloat16(value);
+}
+
+inline float4 occaLoadHalfx4(const half *ptr, const int n){
+  float4 v;
+#if OCCA_CPU_HALF_F16C
+  _mm_store_ps(&v.x, _mm_cvtph_ps(_mm_loadl_epi64((const __m128i*) (ptr + 4*n))));
+#else
+  v.x = occaCPU_halfToFloat(ptr[4*n + 0].bits);
+  v.y = occaCPU_halfToFloat(ptr[4*n + 1].bits);
+  v.z = occaCPU_halfToFloat(ptr[4*n + 2].bits);
+  v.w = occaCPU_halfToFloat(ptr[4*n + 3].bits);
+#endif
+  return v;
+}
+
+inline void occaStoreHalfx4(half *ptr, const int n, const float4 &value){
+#if OCCA_CPU_HALF_F16C
+  _mm_storel_epi64((__m128i*) (ptr + 4*n), _mm_cvtps_ph(_mm_load_ps(&value.x), 0));
+#else
+  ptr[4*n + 0].bits = occaCPU_floatToHalf(value.x);
+  ptr[4*n + 1].bits = occaCPU_floatToHalf(value.y);
+  ptr[4*n + 2].bits = occaCPU_floatToHalf(value.z);
+  ptr[4*n + 3].bits = occaCPU_floatToHalf(value.w);
+#endif
+}
+
+inline float4 occaLoadBfloat16x4(const bfloat16 *ptr, const int n){
+  float4 v;
+#if OCCA_CPU_VECTOR_SSE
+  // Interleaving with zeros puts each value in the high half of a float
+  const __m128i b = _mm_loadl_epi64((const __m128i*) (ptr + 4*n));
+  _mm_store_ps(&v.x, _mm_castsi128_ps(_mm_unpacklo_epi16(_mm_setzero_si128(), b)));
+#else
+  v.x = occaCPU_bfloat16ToFloat(ptr[4*n + 0].bits);
+  v.y = occaCPU_bfloat16ToFloat(ptr[4*n + 1].bits);
+  v.z = occaCPU_bfloat16ToFloat(ptr[4*n + 2].bits);
+  v.w = occaCPU_bfloat16ToFloat(ptr[4*n + 3].bits);
+#endif
+  return v;
+}
+
+inline void occaStoreBfloat16x4(bfloat16 *ptr, const int n, const float4 &value){
+  ptr[4*n + 0].bits = occaCPU_floatToBfloat16(value.x);
+  ptr[4*n + 1].bits = occaCPU_floatToBfloat16(value.y);
+  ptr[4*n + 2].bits = occaCPU_floatToBfloat16(value.z);
+  ptr[4*n + 3].bits = occaCPU_floatToBfloat16(value.w);
+}
+//================================================
+
+#endif
@@ -0,0 +1,132 @@
+#ifndef OCCA_CPU_PRIVATE_DEFINES_HEADER
+#define OCCA_CPU_PRIVATE_DEFINES_HEADER
+
+//---[ Private ]---------------------------------
+template <class TM, const int SIZE>
+class occaPrivate_t {
+public:
+  const int dim0, dim1, dim2;
+  const int &id0, &id1, &id2;
+
+  TM data[OCCA_MAX_THREADS][SIZE] occaAligned;
+
+  occaPrivate_t(int dim0_, int dim1_, int dim2_,
+                int &id0_, int &id1_, int &id2_) :
+    dim0(dim0_),
+    dim1(dim1_),
+    dim2(dim2_),
+    id0(id0_),
+    id1(id1_),
+    id2(id2_) {}
+
+  ~occaPrivate_t(){}
+
+  inline int index() const {
+    return ((id2*dim1 + id1)*dim0 + id0);
+  }
+
+  inline TM& operator [] (const int n){
+    return data[index()][n];
+  }
+
+  inline TM operator [] (const int n) const {
+    return data[index()][n];
+  }
+
+  inline operator TM(){
+    return data[index()][0];
+  }
+
+  inline operator TM*(){
+    return data[index()];
+  }
+
+  inline TM& operator = (const occaPrivate_t &r) {
+    data[index()][0] = r.data[index()][0];
+    return data[index()][0];
+  }
+
+  inline TM& operator = (const TM &t){
+    data[index()][0] = t;
+    return data[index()][0];
+  }
+
+  inline TM& operator += (const TM &t){
+    data[index()][0] += t;
+    return data[index()][0];
+  }
+
+  inline TM& operator -= (const TM &t){
+    data[index()][0] -= t;
+    return data[index()][0];
+  }
+
+  inline TM& operator /= (const TM &t){
+    data[index()][0] /= t;
+    return data[index()][0];
+  }
+
+  inline TM& operator *= (const TM &t){
+    data[index()][0] *= t;
+    return data[index()][0];
+  }
+
+  friend inline TM operator + (const TM &a, const occaPrivate_t &b){
+    return (a + b.data[b.index()][0]);
+  }
+
+  friend inline TM operator + (const occaPrivate_t &a, const TM &b){
+    return (a.data[a.index()][0] + b);
+  }
+
+  friend inline TM operator - (const TM &a, const occaPrivate_t &b){
+    return (a - b.data[b.index()][0]);
+  }
+
+  friend inline TM operator - (const occaPrivate_t &a, const TM &b){
+    return (a.data[a.index()][0] - b);
+  }
+
+  friend inline TM operator * (const TM &a, const occaPrivate_t &b){
+    return (a * b.data[b.index()][0]);
+  }
+
+  friend inline TM operator * (const occaPrivate_t &a, const TM &b){
+    return (a.data[a.index()][0] * b);
+  }
+
+  friend inline TM operator / (const TM &a, const occaPrivate_t &b){
+    return (a / b.data[b.index()][0]);
+  }
+
+  friend inline TM operator / (const occaPrivate_t &a, const TM &b){
+    return (a.data[a.index()][0] / b);
+  }
+
+  inline TM& operator ++ (){
+    return (++data[index()][0]);
+  }
+
+  inline TM& operator ++ (int){
+    return (data[index()][0]++);
+  }
+
+  inline TM& operator -- (){
+    return (--data[index()][0]);
+  }
+
+  inline TM& operator -- (int){
+    return (data[index()][0]--);
+  }
+};
+
+#define occaPrivateArray( TYPE , NAME , SIZE )                          \
+  occaPrivate_t<TYPE,SIZE> NAME(occaInnerDim0, occaInnerDim1, occaInnerDim2, \
+                                occaInnerId0, occaInnerId1, occaInnerId2);
+
+#define occaPrivate( TYPE , NAME )                                      \
+  occaPrivate_t<TYPE,1> NAME(occaInnerDim0, occaInnerDim1, occaInnerDim2, \
+                             occaInnerId0, occaInnerId1, occaInnerId2);
+//================================================
+
+#endif
@@ -0,0 +1,257 @@
+#ifndef OCCA_CPU_VECTOR_DEFINES_HEADER
+#define OCCA_CPU_VECTOR_DEFINES_HEADER
+
+//---[ Vector Types ]-----------------------------
+//  float2, float4, double2 and double4 are aligned to their size so
+//    loads and stores stay in one vector register. float3 and double3
+//    keep the packed layout from before (12 and 24 bytes)
+//
+//  Structs stay aggregates, {x, y, z, w} initialization still works and
+//    make_float4(x, y, z, w) is there for kernels ported from CUDA
+//
+//  Swizzles are read-only member functions: v.xy(), v.zw(), v.wzyx()
+#ifndef MC_CL_EXE
+#  define occaVectorAlign(BYTES) __attribute__ ((aligned (BYTES)))
+#else
+#  define occaVectorAlign(BYTES) __declspec(align(BYTES))
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#  define OCCA_CPU_VECTOR_SSE 1
+#  include <emmintrin.h>
+#else
+#  define OCCA_CPU_VECTOR_SSE 0
+#endif
+
+#if defined(__AVX__)
+#  define OCCA_CPU_VECTOR_AVX 1
+#  include <immintrin.h>
+#else
+#  define OCCA_CPU_VECTOR_AVX 0
+#endif
+
+typedef struct occaVectorAlign(8) float2_t {
+  float x,y;
+
+  inline float2_t yx() const { float2_t v = {y, x}; return v; }
+} float2;
+
+typedef struct float3_t {
+  float x,y,z;
+
+  inline float2 xy() const { float2 v = {x, y}; return v; }
+  inline float2 yz() const { float2 v = {y, z}; return v; }
+  inline float2 xz() const { float2 v = {x, z}; return v; }
+
+  inline float3_t zyx() const { float3_t v = {z, y, x}; return v; }
+} float3;
+
+typedef struct occaVectorAlign(16) float4_t {
+  float x,y,z,w;
+
+  inline float2 xy() const { float2 v = {x, y}; return v; }
+  inline float2 zw() const { float2 v = {z, w}; return v; }
+
+  inline float3 xyz() const { float3 v = {x, y, z}; return v; }
+
+  inline float4_t wzyx() const { float4_t v = {w, z, y, x}; return v; }
+} float4;
+
+typedef struct occaVectorAlign(16) double2_t {
+  double x,y;
+
+  inline double2_t yx() const { double2_t v = {y, x}; return v; }
+} double2;
+
+typedef struct double3_t {
+  double x,y,z;
+
+  inline double2 xy() const { double2 v = {x, y}; return v; }
+  inline double2 yz() const { double2 v = {y, z}; return v; }
+  inline double2 xz() const { double2 v = {x, z}; return v; }
+
+  inline double3_t zyx() const { double3_t v = {z, y, x}; return v; }
+} double3;
+
+typedef struct occaVectorAlign(32) double4_t {
+  double x,y,z,w;
+
+  inline double2 xy() const { double2 v = {x, y}; return v; }
+  inline double2 zw() const { double2 v = {z, w}; return v; }
+
+  inline double3 xyz() const { double3 v = {x, y, z}; return v; }
+
+  inline double4_t wzyx() const { double4_t v = {w, z, y, x}; return v; }
+} double4;
+//================================================
+
+
+//---[ Constructors ]-----------------------------
+#define OCCA_CPU_VECTOR_MAKE(BASE)                                      \
+  inline BASE##2 make_##BASE##2(const BASE x, const BASE y){            \
+    BASE##2 v = {x, y};                                                 \
+    return v;                                                           \
+  }                                                                     \
+                                                                        \
+  inline BASE##3 make_##BASE##3(const BASE x, const BASE y, const BASE z){ \
+    BASE##3 v = {x, y, z};                                              \
+    return v;                                                           \
+  }                                                                     \
+                                                                        \
+  inline BASE##4 make_##BASE##4(const BASE x, const BASE y, const BASE z, const BASE w){ \
+    BASE##4 v = {x, y, z, w};                                           \
+    return v;                                                           \
+  }                                                                     \
+                                                                        \
+  /* Broadcasts for the scalar operators */                             \
+  inline BASE##2 occaCPU_##BASE##2(const BASE s){ return make_##BASE##2(s, s); } \
+  inline BASE##3 occaCPU_##BASE##3(const BASE s){ return make_##BASE##3(s, s, s); } \
+  inline BASE##4 occaCPU_##BASE##4(const BASE s){ return make_##BASE##4(s, s, s, s); }
+
+OCCA_CPU_VECTOR_MAKE(float)
+OCCA_CPU_VECTOR_MAKE(double)
+//================================================
+
+
+//---[ Operators ]--------------------------------
+#define OCCA_CPU_VECTOR2_OP(TYPE, OP)                                   \
+  inline TYPE operator OP (const TYPE &a, const TYPE &b){               \
+    TYPE v = {a.x OP b.x, a.y OP b.y};                                  \
+    return v;                                                           \
+  }
+
+#define OCCA_CPU_VECTOR3_OP(TYPE, OP)                                   \
+  inline TYPE operator OP (const TYPE &a, const TYPE &b){               \
+    TYPE v = {a.x OP b.x, a.y OP b.y, a.z OP b.z};                      \
+    return v;                                                           \
+  }
+
+#define OCCA_CPU_VECTOR4_OP(TYPE, OP)                                   \
+  inline TYPE operator OP (const TYPE &a, const TYPE &b){               \
+    TYPE v = {a.x OP b.x, a.y OP b.y, a.z OP b.z, a.w OP b.w};          \
+    return v;                                                           \
+  }
+
+// Types are aligned, so the aligned load/store intrinsics are safe
+#define OCCA_CPU_VECTOR_SIMD_OP(TYPE, OP, LOAD, STORE, SIMD_OP)         \
+  inline TYPE operator OP (const TYPE &a, const TYPE &b){               \
+    TYPE v;                                                             \
+    STORE(&v.x, SIMD_OP(LOAD(&a.x), LOAD(&b.x)));                       \
+    return v;                                                           \
+  }
+
+#define OCCA_CPU_VECTOR_OPS(N, TYPE)                                    \
+  OCCA_CPU_VECTOR##N##_OP(TYPE, +)                                      \
+  OCCA_CPU_VECTOR##N##_OP(TYPE, -)                                      \
+  OCCA_CPU_VECTOR##N##_OP(TYPE, *)                                      \
+  OCCA_CPU_VECTOR##N##_OP(TYPE, /)
+
+#define OCCA_CPU_VECTOR_SIMD_OPS(TYPE, LOAD, STORE, PREFIX, SUFFIX)     \
+  OCCA_CPU_VECTOR_SIMD_OP(TYPE, +, LOAD, STORE, PREFIX##_add_##SUFFIX)  \
+  OCCA_CPU_VECTOR_SIMD_OP(TYPE, -, LOAD, STORE, PREFIX##_sub_##SUFFIX)  \
+  OCCA_CPU_VECTOR_SIMD_OP(TYPE, *, LOAD, STORE, PREFIX##_mul_##SUFFIX)  \
+  OCCA_CPU_VECTOR_SIMD_OP(TYPE, /, LOAD, STORE, PREFIX##_div_##SUFFIX)
+
+// Scalar, compound and unary operators on top of the vector ones
+#define OCCA_CPU_VECTOR_SCALAR_OP(TYPE, BASE, OP)                       \
+  inline TYPE operator OP (const TYPE &a, const BASE b){                \
+    return (a OP occaCPU_##TYPE(b));                                    \
+  }                                                                     \
+                                                                        \
+  inline TYPE operator OP (const BASE a, const TYPE &b){                \
+    return (occaCPU_##TYPE(a) OP b);                                    \
+  }                                                                     \
+                                                                        \
+  inline TYPE& operator OP##= (TYPE &a, const TYPE &b){                 \
+    return (a = (a OP b));                                              \
+  }                                                                     \
+                                                                        \
+  inline TYPE& operator OP##= (TYPE &a, const BASE b){                  \
+    return (a = (a OP occaCPU_##TYPE(b)));                              \
+  }
+
+#define OCCA_CPU_VECTOR_COMMON_OPS(TYPE, BASE)                          \
+  OCCA_CPU_VECTOR_SCALAR_OP(TYPE, BASE, +)                              \
+  OCCA_CPU_VECTOR_SCALAR_OP(TYPE, BASE, -)                              \
+  OCCA_CPU_VECTOR_SCALAR_OP(TYPE, BASE, *)                              \
+  OCCA_CPU_VECTOR_SCALAR_OP(TYPE, BASE, /)                              \
+                                                                        \
+  inline TYPE operator + (const TYPE &a){                               \
+    return a;                                                           \
+  }                                                                     \
+                                                                        \
+  inline TYPE operator - (const TYPE &a){                               \
+    return (occaCPU_##TYPE(-1) * a);                                    \
+  }
+
+OCCA_CPU_VECTOR_OPS(2, float2)
+OCCA_CPU_VECTOR_OPS(3, float3)
+OCCA_CPU_VECTOR_OPS(3, double3)
+
+#if OCCA_CPU_VECTOR_SSE
+OCCA_CPU_VECTOR_SIMD_OPS(float4 , _mm_load_ps, _mm_store_ps, _mm, ps)
+OCCA_CPU_VECTOR_SIMD_OPS(double2, _mm_load_pd, _mm_store_pd, _mm, pd)
+#else
+OCCA_CPU_VECTOR_OPS(4, float4)
+OCCA_CPU_VECTOR_OPS(2, double2)
+#endif
+
+#if OCCA_CPU_VECTOR_AVX
+OCCA_CPU_VECTOR_SIMD_OPS(double4, _mm256_load_pd, _mm256_store_pd, _mm256, pd)
+#else
+OCCA_CPU_VECTOR_OPS(4, double4)
+#endif
+
+OCCA_CPU_VECTOR_COMMON_OPS(float2 , float)
+OCCA_CPU_VECTOR_COMMON_OPS(float3 , float)
+OCCA_CPU_VECTOR_COMMON_OPS(float4 , float)
+OCCA_CPU_VECTOR_COMMON_OPS(double2, double)
+OCCA_CPU_VECTOR_COMMON_OPS(double3, double)
+OCCA_CPU_VECTOR_COMMON_OPS(double4, double)
+//================================================
+
+
+//---[ Geometry ]---------------------------------
+#define OCCA_CPU_VECTOR_GEOMETRY(TYPE, BASE)                            \
+  inline BASE length(const TYPE &a){                                    \
+    return std::sqrt(dot(a, a));                                             \
+  }                                                                     \
+                                                                        \
+  inline TYPE normalize(const TYPE &a){                                 \
+    return (a * (((BASE) 1) / length(a)));                              \
+  }
+
+#define OCCA_CPU_VECTOR_CROSS(BASE)                                     \
+  inline BASE##3 cross(const BASE##3 &a, const BASE##3 &b){             \
+    return make_##BASE##3(a.y*b.z - a.z*b.y,                            \
+                          a.z*b.x - a.x*b.z,                            \
+                          a.x*b.y - a.y*b.x);                           \
+  }                                                                     \
+                                                                        \
+  /* Like OpenCL, w is set to 0 */                                      \
+  inline BASE##4 cross(const BASE##4 &a, const BASE##4 &b){             \
+    return make_##BASE##4(a.y*b.z - a.z*b.y,                            \
+                          a.z*b.x - a.x*b.z,                            \
+                          a.x*b.y - a.y*b.x,                            \
+                          0);                                           \
+  }
+
+inline float  dot(const float2 &a , const float2 &b) { return (a.x*b.x + a.y*b.y); }
+inline float  dot(const float3 &a , const float3 &b) { return (a.x*b.x + a.y*b.y + a.z*b.z); }
+inline float  dot(const float4 &a , const float4 &b) { return (a.x*b.x + a.y*b.y + a.z*b.z + a.w*b.w); }
+inline double dot(const double2 &a, const double2 &b){ return (a.x*b.x + a.y*b.y); }
+inline double dot(const double3 &a, const double3 &b){ return (a.x*b.x + a.y*b.y + a.z*b.z); }
+inline double dot(const double4 &a, const double4 &b){ return (a.x*b.x + a.y*b.y + a.z*b.z + a.w*b.w); }
+
+OCCA_CPU_VECTOR_GEOMETRY(float2 , float)
+OCCA_CPU_VECTOR_GEOMETRY(float3 , float)
+OCCA_CPU_VECTOR_GEOMETRY(float4 , float)
+OCCA_CPU_VECTOR_GEOMETRY(double2, double)
+OCCA_CPU_VECTOR_GEOMETRY(double3, double)
+OCCA_CPU_VECTOR_GEOMETRY(double4, double)
+
+OCCA_CPU_VECTOR_CROSS(float)
+OCCA_CPU_VECTOR_CROSS(double)
+//================================================
+
+#endif
@@ -255,6 +255,71 @@ __device__ inline double occaCuda_fastLog10(const double x){ return log10(x);
 #define occaUnroll3(N) _Pragma(#N)
 #define occaUnroll2(N) occaUnroll3(N)
 #define occaUnroll(N)  occaUnroll2(unroll N)
+// - - - - - - - - - - - - - - - - - - - - - - - -
+#define occaSimdFor0
+#define occaAlignedSimdFor0(...)
+//================================================
+
+
+//---[ Half Precision ]---------------------------
+//  Converted with PTX, cuda_fp16.h isn't needed
+typedef struct half_t     { unsigned short bits; } half;
+typedef struct bfloat16_t { unsigned short bits; } bfloat16;
+
+__device__ inline float occaCuda_halfToFloat(const unsigned short h){
+  float f;
+  asm("cvt.f32.f16 %0, %1;" : "=f"(f) : "h"(h));
+  return f;
+}
+
+__device__ inline unsigned short occaCuda_floatToHalf(const float f){
+  unsigned short h;
+  asm("cvt.rn.f16.f32 %0, %1;" : "=h"(h) : "f"(f));
+  return h;
+}
+
+__device__ inline float occaCuda_bfloat16ToFloat(const unsigned short b){
+  return __uint_as_float(((unsigned int) b) << 16);
+}
+
+// Rounds to nearest even, NaNs stay quiet NaNs
+__device__ inline unsigned short occaCuda_floatToBfloat16(const float f){
+  const unsigned int bits = __float_as_uint(f);
+
+  if(0x7f800000 < (bits & 0x7fffffff))
+    return (unsigned short) ((bits >> 16) | 0x40);
+
+  return (unsigned short) ((bits + 0x7fff + ((bits >> 16) & 1)) >> 16);
+}
+
+#define occaLoadHalf(PTR, N)             occaCuda_halfToFloat((PTR)[N].bits)
+#define occaStoreHalf(PTR, N, VALUE)     ((PTR)[N].bits = occaCuda_floatToHalf(VALUE))
+#define occaLoadBfloat16(PTR, N)         occaCuda_bfloat16ToFloat((PTR)[N].bits)
+#define occaStoreBfloat16(PTR, N, VALUE) ((PTR)[N].bits = occaCuda_floatToBfloat16(VALUE))
+// - - - - - - - - - - - - - - - - - - - - - - - -
+#define occaLoadHalfx4(PTR, N)                      \
+  make_float4(occaLoadHalf(PTR, 4*(N) + 0),         \
+              occaLoadHalf(PTR, 4*(N) + 1),         \
+              occaLoadHalf(PTR, 4*(N) + 2),         \
+              occaLoadHalf(PTR, 4*(N) + 3))
+
+#define occaStoreHalfx4(PTR, N, VALUE)              \
+  (occaStoreHalf(PTR, 4*(N) + 0, (VALUE).x),        \
+   occaStoreHalf(PTR, 4*(N) + 1, (VALUE).y),        \
+   occaStoreHalf(PTR, 4*(N) + 2, (VALUE).z),        \
+   occaStoreHalf(PTR, 4*(N) + 3, (VALUE).w))
+
+#define occaLoadBfloat16x4(PTR, N)                  \
+  make_float4(occaLoadBfloat16(PTR, 4*(N) + 0),     \
+              occaLoadBfloat16(PTR, 4*(N) + 1),     \
+              occaLoadBfloat16(PTR, 4*(N) + 2),     \
+              occaLoadBfloat16(PTR, 4*(N) + 3))
+
+#define occaStoreBfloat16x4(PTR, N, VALUE)          \
+  (occaStoreBfloat16(PTR, 4*(N) + 0, (VALUE).x),    \
+   occaStoreBfloat16(PTR, 4*(N) + 1, (VALUE).y),    \
+   occaStoreBfloat16(PTR, 4*(N) + 2, (VALUE).z),    \
+   occaStoreBfloat16(PTR, 4*(N) + 3, (VALUE).w))
 //================================================
 
 
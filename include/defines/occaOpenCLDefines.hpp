@@ -180,6 +180,42 @@
 #define occaUnroll3(N) _Pragma(#N)
 #define occaUnroll2(N) occaUnroll3(N)
 #define occaUnroll(N)  occaUnroll2(unroll N)
+// - - - - - - - - - - - - - - - - - - - - - - - -
+#define occaSimdFor0
+#define occaAlignedSimdFor0(...)
+//================================================
+
+
+//---[ Half Precision ]---------------------------
+typedef struct bfloat16_t { ushort bits; } bfloat16;
+
+#define occaLoadHalf(PTR, N)           vload_half(N, PTR)
+#define occaStoreHalf(PTR, N, VALUE)   vstore_half_rte(VALUE, N, PTR)
+#define occaLoadHalfx4(PTR, N)         vload_half4(N, PTR)
+#define occaStoreHalfx4(PTR, N, VALUE) vstore_half4_rte(VALUE, N, PTR)
+// - - - - - - - - - - - - - - - - - - - - - - - -
+#define occaCL_bfloat16ToFloat(B) as_float(((uint) (B)) << 16)
+
+// Rounds to nearest even, NaNs stay quiet NaNs
+#define occaCL_floatToBfloat16(F)                                       \
+  ((0x7f800000 < (as_uint((float) (F)) & 0x7fffffff)) ?                  \
+   (ushort) ((as_uint((float) (F)) >> 16) | 0x40)     :                  \
+   (ushort) ((as_uint((float) (F)) + 0x7fff + ((as_uint((float) (F)) >> 16) & 1)) >> 16))
+
+#define occaLoadBfloat16(PTR, N)         occaCL_bfloat16ToFloat((PTR)[N].bits)
+#define occaStoreBfloat16(PTR, N, VALUE) ((PTR)[N].bits = occaCL_floatToBfloat16(VALUE))
+
+#define occaLoadBfloat16x4(PTR, N)              \
+  ((float4) (occaLoadBfloat16(PTR, 4*(N) + 0),  \
+             occaLoadBfloat16(PTR, 4*(N) + 1),  \
+             occaLoadBfloat16(PTR, 4*(N) + 2),  \
+             occaLoadBfloat16(PTR, 4*(N) + 3)))
+
+#define occaStoreBfloat16x4(PTR, N, VALUE)              \
+  (occaStoreBfloat16(PTR, 4*(N) + 0, (VALUE).x),        \
+   occaStoreBfloat16(PTR, 4*(N) + 1, (VALUE).y),        \
+   occaStoreBfloat16(PTR, 4*(N) + 2, (VALUE).z),        \
+   occaStoreBfloat16(PTR, 4*(N) + 3, (VALUE).w))
 //================================================
 
 
@@ -3,21 +3,12 @@
 
 #include <stdint.h>
 
-#include <cstdlib>
-#include <cstdio>
-#include <cmath>
-
 //---[ Defines ]----------------------------------
 #define OCCA_MAX_THREADS 512
 #define OCCA_MEM_ALIGN   64
 
-typedef struct float2_t { float  x,y;     } float2;
-typedef struct float3_t { float  x,y,z;   } float3;
-typedef struct float4_t { float  x,y,z,w; } float4;
-
-typedef struct double2_t { double  x,y;     } double2;
-typedef struct double3_t { double  x,y,z;   } double3;
-typedef struct double4_t { double  x,y,z,w; } double4;
+// float2, ..., double4 are added with occaCPUVectorDefines
+// half and bfloat16 are added with occaCPUHalfDefines
 //================================================
 
 
@@ -77,7 +68,7 @@ typedef struct double4_t { double  x,y,z,w; } double4;
 
 
 //---[ Attributes ]-------------------------------
-#define occaShared
+#define occaShared   occaAligned
 #define occaPointer
 #define occaVariable &
 
@@ -118,6 +109,7 @@ typedef struct double4_t { double  x,y,z,w; } double4;
 
 
 //---[ Math ]-------------------------------------
+// occaCPU_fast* functions are added with occaCPUFastMathDefines
 #define occaFabs       fabs
 #define occaFastFabs   fabs
 #define occaNativeFabs fabs
@@ -131,8 +123,8 @@ typedef struct double4_t { double  x,y,z,w; } double4;
 #define occaNativeCbrt cbrt
 
 #define occaSin       sin
-#define occaFastSin   sin
-#define occaNativeSin sin
+#define occaFastSin   occaCPU_fastSin
+#define occaNativeSin occaCPU_fastSin
 
 #define occaAsin       asin
 #define occaFastAsin   asin
@@ -147,8 +139,8 @@ typedef struct double4_t { double  x,y,z,w; } double4;
 #define occaNativeAsinh asinh
 
 #define occaCos       cos
-#define occaFastCos   cos
-#define occaNativeCos cos
+#define occaFastCos   occaCPU_fastCos
+#define occaNativeCos occaCPU_fastCos
 
 #define occaAcos       acos
 #define occaFastAcos   acos
@@ -163,8 +155,8 @@ typedef struct double4_t { double  x,y,z,w; } double4;
 #define occaNativeAcosh acosh
 
 #define occaTan       tan
-#define occaFastTan   tan
-#define occaNativeTan tan
+#define occaFastTan   occaCPU_fastTan
+#define occaNativeTan occaCPU_fastTan
 
 #define occaAtan       atan
 #define occaFastAtan   atan
@@ -179,24 +171,24 @@ typedef struct double4_t { double  x,y,z,w; } double4;
 #define occaNativeAtanh atanh
 
 #define occaExp       exp
-#define occaFastExp   exp
-#define occaNativeExp exp
+#define occaFastExp   occaCPU_fastExp
+#define occaNativeExp occaCPU_fastExp
 
 #define occaExpm1       expm1
 #define occaFastExpm1   expm1
 #define occaNativeExpm1 expm1
 
 #define occaPow       pow
-#define occaFastPow   pow
-#define occaNativePow pow
+#define occaFastPow   occaCPU_fastPow
+#define occaNativePow occaCPU_fastPow
 
 #define occaLog2       log2
-#define occaFastLog2   log2
-#define occaNativeLog2 log2
+#define occaFastLog2   occaCPU_fastLog2
+#define occaNativeLog2 occaCPU_fastLog2
 
 #define occaLog10       log10
-#define occaFastLog10   log10
-#define occaNativeLog10 log10
+#define occaFastLog10   occaCPU_fastLog10
+#define occaNativeLog10 occaCPU_fastLog10
 //================================================
 
 
@@ -209,130 +201,23 @@ typedef struct double4_t { double  x,y,z,w; } double4;
 #define occaUnroll3(N) _Pragma(#N)
 #define occaUnroll2(N) occaUnroll3(N)
 #define occaUnroll(N)  occaUnroll2(unroll N)
-//================================================
-
-
-//---[ Private ]---------------------------------
-template <class TM, const int SIZE>
-class occaPrivate_t {
-public:
-  const int dim0, dim1, dim2;
-  const int &id0, &id1, &id2;
-
-  TM data[OCCA_MAX_THREADS][SIZE] occaAligned;
-
-  occaPrivate_t(int dim0_, int dim1_, int dim2_,
-                int &id0_, int &id1_, int &id2_) :
-    dim0(dim0_),
-    dim1(dim1_),
-    dim2(dim2_),
-    id0(id0_),
-    id1(id1_),
-    id2(id2_) {}
-
-  ~occaPrivate_t(){}
-
-  inline int index() const {
-    return ((id2*dim1 + id1)*dim0 + id0);
-  }
-
-  inline TM& operator [] (const int n){
-    return data[index()][n];
-  }
-
-  inline TM operator [] (const int n) const {
-    return data[index()][n];
-  }
-
-  inline operator TM(){
-    return data[index()][0];
-  }
-
-  inline operator TM*(){
-    return data[index()];
-  }
-
-  inline TM& operator = (const TM &t){
-    data[index()][0] = t;
-    return data[index()][0];
-  }
-
-  inline TM& operator += (const TM &t){
-    data[index()][0] += t;
-    return data[index()][0];
-  }
-
-  inline TM& operator -= (const TM &t){
-    data[index()][0] -= t;
-    return data[index()][0];
-  }
-
-  inline TM& operator /= (const TM &t){
-    data[index()][0] /= t;
-    return data[index()][0];
-  }
-
-  inline TM& operator *= (const TM &t){
-    data[index()][0] *= t;
-    return data[index()][0];
-  }
-
-  friend inline TM operator + (const TM &a, const occaPrivate_t &b){
-    return (a + b.data[b.index()][0]);
-  }
-
-  friend inline TM operator + (const occaPrivate_t &a, const TM &b){
-    return (a.data[a.index()][0] + b);
-  }
-
-  friend inline TM operator - (const TM &a, const occaPrivate_t &b){
-    return (a - b.data[b.index()][0]);
-  }
-
-  friend inline TM operator - (const occaPrivate_t &a, const TM &b){
-    return (a.data[a.index()][0] - b);
-  }
-
-  friend inline TM operator * (const TM &a, const occaPrivate_t &b){
-    return (a * b.data[b.index()][0]);
-  }
-
-  friend inline TM operator * (const occaPrivate_t &a, const TM &b){
-    return (a.data[a.index()][0] * b);
-  }
-
-  friend inline TM operator / (const TM &a, const occaPrivate_t &b){
-    return (a / b.data[b.index()][0]);
-  }
-
-  friend inline TM operator / (const occaPrivate_t &a, const TM &b){
-    return (a.data[a.index()][0] / b);
-  }
-
-  inline TM& operator ++ (){
-    return (++data[index()][0]);
-  }
-
-  inline TM& operator ++ (int){
-    return (data[index()][0]++);
-  }
-
-  inline TM& operator -- (){
-    return (--data[index()][0]);
-  }
-
-  inline TM& operator -- (int){
-    return (data[index()][0]--);
-  }
-};
-
-#define occaPrivateArray( TYPE , NAME , SIZE )                          \
-  occaPrivate_t<TYPE,SIZE> NAME(occaInnerDim0, occaInnerDim1, occaInnerDim2, \
-                                occaInnerId0, occaInnerId1, occaInnerId2);
-
-#define occaPrivate( TYPE , NAME )                                      \
-  occaPrivate_t<TYPE,1> NAME(occaInnerDim0, occaInnerDim1, occaInnerDim2, \
-                             occaInnerId0, occaInnerId1, occaInnerId2);
+// - - - - - - - - - - - - - - - - - - - - - - - -
+#define occaPragma2(X) _Pragma(#X)
+#define occaPragma(X)  occaPragma2(X)
+
+#if defined(_OPENMP) && (_OPENMP >= 201307)
+#  define occaSimdFor0                _Pragma("omp simd")
+#  define occaAlignedSimdFor0(...)    occaPragma(omp simd aligned(__VA_ARGS__ : OCCA_MEM_ALIGN))
+#elif defined(__INTEL_COMPILER)
+#  define occaSimdFor0                _Pragma("simd")
+#  define occaAlignedSimdFor0(...)    _Pragma("simd")
+#elif defined(__GNUC__)
+#  define occaSimdFor0                _Pragma("GCC ivdep")
+#  define occaAlignedSimdFor0(...)    _Pragma("GCC ivdep")
+#else
+#  define occaSimdFor0
+#  define occaAlignedSimdFor0(...)
+#endif
 //================================================
 
 
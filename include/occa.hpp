@@ -8,6 +8,8 @@
 
 #include "occaBase.hpp"
 #include "occaLibrary.hpp"
+#include "occaAutotuner.hpp"
+#include "occaGraph.hpp"
 #include "occaTimer.hpp"
 
 #include "occaOpenCL.hpp"
@@ -0,0 +1,110 @@
+#ifndef OCCA_AUTOTUNER_HEADER
+#define OCCA_AUTOTUNER_HEADER
+
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#include "occaTools.hpp"
+#include "occaBase.hpp"
+
+namespace occa {
+  //---[ Autotuner ]------------------
+  //  Benchmarks a kernel over the working dims and defines added by the
+  //    user and keeps the fastest setup in the OCCA cache, keyed by the
+  //    device identifier and the kernel hash
+  //
+  //  occa::autotuner tuner(device, "reduction.okl", "reduction");
+  //
+  //  tuner.addDefine("p_Nred", 128);
+  //  tuner.addDefine("p_Nred", 256);
+  //
+  //  tuner.addArgument(0, entries);
+  //  tuner.addArgument(1, o_a);
+  //  tuner.addArgument(2, o_aRed);
+  //
+  //  occa::kernel reduction = tuner.build(); // Tunes only on a cache miss
+  class autotuneSetup {
+  public:
+    int dims;
+    dim inner, outer;
+
+    std::vector<std::string> defineNames, defineValues;
+
+    double timeTaken;
+
+    autotuneSetup();
+
+    autotuneSetup(const autotuneSetup &s);
+    autotuneSetup& operator = (const autotuneSetup &s);
+
+    kernelInfo getKernelInfo(const kernelInfo &baseInfo) const;
+
+    std::string toString() const;
+    bool load(const std::string &content);
+  };
+
+  std::ostream& operator << (std::ostream &out, const autotuneSetup &s);
+
+  class autotuner {
+  public:
+    occa::device dev;
+
+    std::string filename, functionName;
+    kernelInfo info;
+
+    int warmupRuns, timedRuns;
+    bool verbose;
+
+    // Search space
+    int dims;
+    dim globalDims;
+    std::vector<dim> innerDims;
+
+    std::vector<std::string> defineNames;
+    std::vector<std::vector<std::string> > defineValues;
+
+    int argumentCount;
+    kernelArg arguments[OCCA_MAX_ARGS];
+
+    autotuneSetup best;
+
+    autotuner(occa::device dev_,
+              const std::string &filename_,
+              const std::string &functionName_,
+              const kernelInfo &info_ = defaultKernelInfo);
+
+    // Outer dims are set to cover [globalDims] for each inner candidate
+    void setGlobalDims(const int dims_, const dim &globalDims_);
+    void addInnerDims(const dim &inner);
+
+    template <class TM>
+    inline void addDefine(const std::string &name, const TM &value){
+      std::stringstream ss;
+      ss << value;
+
+      addDefineValue(name, ss.str());
+    }
+
+    void addDefineValue(const std::string &name, const std::string &value);
+
+    void addArgument(const int argPos, const kernelArg &arg);
+
+    std::string getCacheFilename();
+
+    bool loadFromCache();
+    void saveToCache();
+
+    int setupCount();
+    autotuneSetup getSetup(const int id);
+
+    double benchmark(kernel &k);
+
+    void tune();
+
+    kernel build();
+  };
+  //==================================
+};
+
+#endif
@@ -82,6 +82,11 @@ namespace occa {
 
   static const uintptr_t useLoopy  = (1 << 0);
   static const uintptr_t useFloopy = (1 << 1);
+
+  // Languages for device::buildKernelFromString()
+  static const int usingOKL    = (1 << 0);
+  static const int usingOFL    = (1 << 1);
+  static const int usingNative = (1 << 2);
   //==================================
 
   //---[ Mode ]-----------------------
@@ -164,6 +169,8 @@ namespace occa {
   template <occa::mode> class device_t;
   class device;
 
+  class graph;
+
   //---[ Helper Classes ]-------------
   class deviceInfo {
   public:
@@ -306,6 +313,10 @@ namespace occa {
   static const argInfo threadCount("threadCount");
   static const argInfo pinnedCores("pinnedCores");
 
+  static const argInfo hugePages("hugePages");
+
+  static const argInfo outOfOrder("outOfOrder");
+
   class argInfoMap {
   public:
     std::map<std::string, std::string> iMap;
@@ -331,7 +342,9 @@ namespace occa {
            (info != "chunk")       &&
            (info != "threadCount") &&
            (info != "schedule")    &&
-           (info != "pinnedCores")){
+           (info != "pinnedCores") &&
+           (info != "hugePages")   &&
+           (info != "outOfOrder")){
 
           std::cout << "Flag [" << info << "] is not available, skipping it\n";
 
@@ -466,6 +479,32 @@ namespace occa {
     inline uintptr_t& operator [] (int i);
   };
 
+  // Layout of a rectangular region inside a linear buffer for the
+  //   copyRect methods. [origin] is {byte, row, slice} and the pitches
+  //   are the bytes between rows and between slices, pitches of 0 are
+  //   packed to the copied region
+  class rect {
+  public:
+    occa::dim origin;
+    uintptr_t rowPitch, slicePitch;
+
+    inline rect();
+    inline rect(const uintptr_t originX,
+                const uintptr_t originY     = 0,
+                const uintptr_t originZ     = 0,
+                const uintptr_t rowPitch_   = 0,
+                const uintptr_t slicePitch_ = 0);
+
+    inline rect(const rect &r);
+    inline rect& operator = (const rect &r);
+
+    // Byte offset of [origin]
+    inline uintptr_t offset() const;
+
+    // Byte after the last one touched by a copy of [region]
+    inline uintptr_t end(const occa::dim &region) const;
+  };
+
   union kernelArg_t {
     int int_;
     unsigned int uint_;
@@ -606,8 +645,9 @@ namespace occa {
   extern const int int32FormatIndex;
   extern const int halfFormatIndex;
   extern const int floatFormatIndex;
+  extern const int bfloat16FormatIndex;
 
-  extern const int sizeOfFormats[8];
+  extern const int sizeOfFormats[9];
 
   class formatType {
   private:
@@ -623,6 +663,7 @@ namespace occa {
     template <occa::mode>
     void* format() const;
 
+    int formatIndex() const;
     int count() const;
     size_t bytes() const;
   };
@@ -636,6 +677,9 @@ namespace occa {
   extern const occa::formatType int32Format , int32x2Format , int32x4Format;
   extern const occa::formatType halfFormat  , halfx2Format  , halfx4Format;
   extern const occa::formatType floatFormat , floatx2Format , floatx4Format;
+
+  // Textures read bfloat16 as raw 16-bit integers
+  extern const occa::formatType bfloat16Format, bfloat16x2Format, bfloat16x4Format;
   //==================================
 
 
@@ -678,6 +722,9 @@ namespace occa {
     virtual kernel_v* loadFromLibrary(const char *cache,
                                       const std::string &functionName_) = 0;
 
+    // Kernel [functionName_] from this kernel's compiled binary
+    virtual kernel_v* buildSibling(const std::string &functionName_) = 0;
+
     virtual int preferredDimSize() = 0;
 
 #include "operators/occaVirtualOperatorDeclarations.hpp"
@@ -714,6 +761,8 @@ namespace occa {
     kernel_t<mode>* loadFromLibrary(const char *cache,
                                     const std::string &functionName_);
 
+    kernel_t<mode>* buildSibling(const std::string &functionName_);
+
     int preferredDimSize();
 
 #include "operators/occaOperatorDeclarations.hpp"
@@ -725,6 +774,7 @@ namespace occa {
   };
 
   class kernel {
+    template <occa::mode> friend class occa::device_t;
     friend class occa::device;
 
   private:
@@ -805,6 +855,20 @@ namespace occa {
 
 
   //---[ Memory ]---------------------
+  // Strided copy used by the CPU modes, [dest] and [src] are the buffer
+  //   starts and the rects have their pitches set. The copy is split in
+  //   [parts] even pieces and only piece [part] is copied
+  void cpuCopyRect(void *dest,
+                   const void *src,
+                   const occa::dim &region,
+                   const occa::rect &destRect,
+                   const occa::rect &srcRect,
+                   const int part  = 0,
+                   const int parts = 1);
+
+  // Smaller regions are copied faster by one thread than by waking more
+  bool cpuCopyRectIsLarge(const occa::dim &region);
+
   void memcpy(memory &dest,
               const void *source,
               const uintptr_t bytes = 0,
@@ -867,6 +931,28 @@ namespace occa {
 
     bool isAWrapper;
 
+    // Set by wrapHostMemory(), the caller keeps ownership of the pointer
+    bool wrapsHostPtr;
+
+    // Pages backing CPU-mode allocations, [mappedBytes] is 0 unless mmap'd
+    uintptr_t pageBytes, mappedBytes;
+
+    // Slices point to the allocation they view, which is only freed
+    //   once it and all of its slices are freed
+    memory_v *parent;
+    uintptr_t parentOffset;
+
+    int sliceRefs;
+    bool freePending;
+
+    // Named POSIX shared memory, only its creator unlinks the name
+    std::string sharedName;
+    bool ownsSharedName;
+
+    // Host pointer returned by map(), NULL when not mapped
+    void *mapPtr;
+    uintptr_t mapBytes, mapOffset;
+
   public:
     virtual inline ~memory_v(){}
 
@@ -909,6 +995,45 @@ namespace occa {
                              const uintptr_t destOffset = 0,
                              const uintptr_t srcOffset = 0) = 0;
 
+    // Rects come in with their pitches set and checked by occa::memory
+    virtual void copyRectFrom(const void *source,
+                              const occa::dim &region,
+                              const occa::rect &destRect,
+                              const occa::rect &srcRect) = 0;
+
+    virtual void copyRectFrom(const memory_v *source,
+                              const occa::dim &region,
+                              const occa::rect &destRect,
+                              const occa::rect &srcRect) = 0;
+
+    virtual void copyRectTo(void *dest,
+                            const occa::dim &region,
+                            const occa::rect &destRect,
+                            const occa::rect &srcRect) = 0;
+
+    virtual void asyncCopyRectFrom(const void *source,
+                                   const occa::dim &region,
+                                   const occa::rect &destRect,
+                                   const occa::rect &srcRect) = 0;
+
+    virtual void asyncCopyRectFrom(const memory_v *source,
+                                   const occa::dim &region,
+                                   const occa::rect &destRect,
+                                   const occa::rect &srcRect) = 0;
+
+    virtual void asyncCopyRectTo(void *dest,
+                                 const occa::dim &region,
+                                 const occa::rect &destRect,
+                                 const occa::rect &srcRect) = 0;
+
+    virtual memory_v* slice(const uintptr_t offset,
+                            const uintptr_t bytes) = 0;
+
+    virtual void* map(const uintptr_t bytes,
+                      const uintptr_t offset) = 0;
+
+    virtual void unmap() = 0;
+
     virtual void free() = 0;
   };
 
@@ -963,6 +1088,44 @@ namespace occa {
                      const uintptr_t destOffset = 0,
                      const uintptr_t srcOffset = 0);
 
+    void copyRectFrom(const void *source,
+                      const occa::dim &region,
+                      const occa::rect &destRect,
+                      const occa::rect &srcRect);
+
+    void copyRectFrom(const memory_v *source,
+                      const occa::dim &region,
+                      const occa::rect &destRect,
+                      const occa::rect &srcRect);
+
+    void copyRectTo(void *dest,
+                    const occa::dim &region,
+                    const occa::rect &destRect,
+                    const occa::rect &srcRect);
+
+    void asyncCopyRectFrom(const void *source,
+                           const occa::dim &region,
+                           const occa::rect &destRect,
+                           const occa::rect &srcRect);
+
+    void asyncCopyRectFrom(const memory_v *source,
+                           const occa::dim &region,
+                           const occa::rect &destRect,
+                           const occa::rect &srcRect);
+
+    void asyncCopyRectTo(void *dest,
+                         const occa::dim &region,
+                         const occa::rect &destRect,
+                         const occa::rect &srcRect);
+
+    memory_v* slice(const uintptr_t offset,
+                    const uintptr_t bytes);
+
+    void* map(const uintptr_t bytes,
+              const uintptr_t offset);
+
+    void unmap();
+
     void free();
   };
 
@@ -992,6 +1155,14 @@ namespace occa {
       return mHandle->size;
     }
 
+    // 0 when the page size is unknown (GPU modes, wrapped memory)
+    inline uintptr_t pageSize() const {
+      if(mHandle == NULL)
+        return 0;
+
+      return mHandle->pageBytes;
+    }
+
     void* textureArg() const;
 
     void* getMemoryHandle();
@@ -1015,6 +1186,19 @@ namespace occa {
                 const uintptr_t destOffset = 0,
                 const uintptr_t srcOffset = 0);
 
+    // Converts between host floats and a buffer stored as [format]
+    //   (halfFormat or bfloat16Format). [entries = 0] converts the rest
+    //   of the buffer, [offset] is in bytes of this buffer
+    void copyFrom(const float *source,
+                  const occa::formatType &format,
+                  const uintptr_t entries = 0,
+                  const uintptr_t offset = 0);
+
+    void copyTo(float *dest,
+                const occa::formatType &format,
+                const uintptr_t entries = 0,
+                const uintptr_t offset = 0);
+
     void asyncCopyFrom(const void *source,
                        const uintptr_t bytes = 0,
                        const uintptr_t offset = 0);
@@ -1033,6 +1217,94 @@ namespace occa {
                      const uintptr_t destOffset = 0,
                      const uintptr_t srcOffset = 0);
 
+    // Copies [region] = {bytes per row, rows, slices} between strided
+    //   layouts, e.g. one face of a 3D block for a halo exchange:
+    //
+    //     // Face x = 0 of an (nx, ny, nz) block of doubles, packed on the host
+    //     o_u.copyRectTo(face,
+    //                    occa::dim(sizeof(double), ny, nz),
+    //                    occa::rect(),
+    //                    occa::rect(0, 0, 0, nx*sizeof(double)));
+    //
+    //   [destRect] and [srcRect] place the region in the destination and
+    //   source, host pointers included. The regions can't overlap
+    //
+    //   CPU modes have no copy queue, their async variants are done
+    //   copying when they return
+    void copyRectFrom(const void *source,
+                      const occa::dim &region,
+                      const occa::rect &destRect = occa::rect(),
+                      const occa::rect &srcRect  = occa::rect());
+
+    void copyRectFrom(const memory &source,
+                      const occa::dim &region,
+                      const occa::rect &destRect = occa::rect(),
+                      const occa::rect &srcRect  = occa::rect());
+
+    void copyRectTo(void *dest,
+                    const occa::dim &region,
+                    const occa::rect &destRect = occa::rect(),
+                    const occa::rect &srcRect  = occa::rect());
+
+    void copyRectTo(memory &dest,
+                    const occa::dim &region,
+                    const occa::rect &destRect = occa::rect(),
+                    const occa::rect &srcRect  = occa::rect());
+
+    void asyncCopyRectFrom(const void *source,
+                           const occa::dim &region,
+                           const occa::rect &destRect = occa::rect(),
+                           const occa::rect &srcRect  = occa::rect());
+
+    void asyncCopyRectFrom(const memory &source,
+                           const occa::dim &region,
+                           const occa::rect &destRect = occa::rect(),
+                           const occa::rect &srcRect  = occa::rect());
+
+    void asyncCopyRectTo(void *dest,
+                         const occa::dim &region,
+                         const occa::rect &destRect = occa::rect(),
+                         const occa::rect &srcRect  = occa::rect());
+
+    void asyncCopyRectTo(memory &dest,
+                         const occa::dim &region,
+                         const occa::rect &destRect = occa::rect(),
+                         const occa::rect &srcRect  = occa::rect());
+
+    // View of [bytes] starting at [offset] sharing this allocation,
+    //   [bytes = 0] views the rest of the buffer
+    memory slice(const uintptr_t offset,
+                 const uintptr_t bytes = 0);
+
+    inline bool isSlice() const {
+      return ((mHandle != NULL) && (mHandle->parent != NULL));
+    }
+
+    inline bool isShared() const {
+      return ((mHandle != NULL) && (mHandle->sharedName.size() != 0));
+    }
+
+    // Fence kept with shared memory, [signalPeers] finishes the device
+    //   and returns the value peers pass to [waitForPeers]
+    uintptr_t signalPeers();
+    void waitForPeers(const uintptr_t value);
+
+    // Finishes the device and writes file-backed buffers back to disk
+    void sync(const uintptr_t bytes = 0,
+              const uintptr_t offset = 0);
+
+    // Host pointer to [bytes] starting at [offset], valid until unmap().
+    //   Zero-copy in CPU modes and on OpenCL devices sharing host memory,
+    //   other modes stage through a host buffer written back by unmap()
+    void* map(const uintptr_t bytes = 0,
+              const uintptr_t offset = 0);
+
+    void unmap();
+
+    inline bool isMapped() const {
+      return ((mHandle != NULL) && (mHandle->mapPtr != NULL));
+    }
+
     void swap(memory &m);
 
     void free();
@@ -1096,6 +1368,9 @@ namespace occa {
     occa::device wrapDevice(cl_platform_id platformID,
                             cl_device_id deviceID,
                             cl_context context);
+
+    // clSetKernelArg calls skipped since the argument was already bound
+    uintptr_t skippedArgumentBinds();
   };
 #endif
 
@@ -1114,6 +1389,7 @@ namespace occa {
   class device_v {
     template <occa::mode> friend class occa::device_t;
     template <occa::mode> friend class occa::kernel_t;
+    template <occa::mode> friend class occa::memory_t;
     friend class occa::device;
 
   private:
@@ -1147,6 +1423,7 @@ namespace occa {
     virtual void finish() = 0;
 
     virtual void waitFor(tag tag_) = 0;
+    virtual void streamWaitFor(tag tag_) = 0;
 
     virtual stream createStream() = 0;
     virtual void freeStream(stream s) = 0;
@@ -1154,6 +1431,7 @@ namespace occa {
 
     virtual tag tagStream() = 0;
     virtual double timeBetween(const tag &startTag, const tag &endTag) = 0;
+    virtual void freeTag(tag tag_) = 0;
 
     virtual kernel_v* buildKernelFromSource(const std::string &filename,
                                             const std::string &functionName_,
@@ -1169,6 +1447,9 @@ namespace occa {
     virtual kernel_v* loadKernelFromLibrary(const char *cache,
                                             const std::string &functionName_) = 0;
 
+    // Replays [g] in order, CPU modes submit its launches together
+    virtual void runGraph(occa::graph &g) = 0;
+
 #if OCCA_OPENCL_ENABLED
     friend occa::device cl::wrapDevice(cl_platform_id platformID,
                                        cl_device_id deviceID,
@@ -1186,12 +1467,16 @@ namespace occa {
     virtual memory_v* wrapMemory(void *handle_,
                                  const uintptr_t bytes) = 0;
 
+    virtual memory_v* wrapHostMemory(void *ptr,
+                                     const uintptr_t bytes) = 0;
+
     virtual memory_v* wrapTexture(void *handle_,
                                   const int dim, const occa::dim &dims,
                                   occa::formatType type, const int permissions) = 0;
 
     virtual memory_v* malloc(const uintptr_t bytes,
-                             void* source) = 0;
+                             void* source,
+                             const int pages) = 0;
 
     virtual memory_v* talloc(const int dim, const occa::dim &dims,
                              void *source,
@@ -1235,6 +1520,7 @@ namespace occa {
     void finish();
 
     void waitFor(tag tag_);
+    void streamWaitFor(tag tag_);
 
     stream createStream();
     void freeStream(stream s);
@@ -1242,6 +1528,7 @@ namespace occa {
 
     tag tagStream();
     double timeBetween(const tag &startTag, const tag &endTag);
+    void freeTag(tag tag_);
 
     kernel_v* buildKernelFromSource(const std::string &filename,
                                     const std::string &functionName,
@@ -1257,6 +1544,8 @@ namespace occa {
     kernel_v* loadKernelFromLibrary(const char *cache,
                                     const std::string &functionName_);
 
+    void runGraph(occa::graph &g);
+
 #if OCCA_OPENCL_ENABLED
     friend occa::device cl::wrapDevice(cl_platform_id platformID,
                                        cl_device_id deviceID,
@@ -1274,12 +1563,16 @@ namespace occa {
     memory_v* wrapMemory(void *handle_,
                          const uintptr_t bytes);
 
+    memory_v* wrapHostMemory(void *ptr,
+                             const uintptr_t bytes);
+
     memory_v* wrapTexture(void *handle_,
                           const int dim, const occa::dim &dims,
                           occa::formatType type, const int permissions);
 
     memory_v* malloc(const uintptr_t bytes,
-                     void *source);
+                     void *source,
+                     const int pages);
 
     memory_v* talloc(const int dim, const occa::dim &dims,
                      void *source,
@@ -1296,6 +1589,7 @@ namespace occa {
     template <occa::mode> friend class occa::device_t;
 
     friend class occa::kernelDatabase;
+    friend class occa::graph;
 
   private:
     occa::mode mode_;
@@ -1355,8 +1649,17 @@ namespace occa {
     void flush();
     void finish();
 
+    // Blocks the host until [tag_] is reached
     void waitFor(tag tag_);
 
+    // Later work on the current stream waits for [tag_], the host doesn't.
+    //   Used to order streams (or an out-of-order OpenCL queue) with tags
+    void streamWaitFor(tag tag_);
+
+    // Tags from tagStream() hold an OpenCL or CUDA event until freeTag(),
+    //   release them once nothing waits for or times them anymore
+    void freeTag(tag tag_);
+
     stream createStream();
     stream getStream();
     void setStream(stream s);
@@ -1371,6 +1674,13 @@ namespace occa {
                                  const std::string &functionName,
                                  const kernelInfo &info_ = defaultKernelInfo);
 
+    // Builds [content] without writing it to a file, only the compiled
+    //   binary is cached
+    kernel buildKernelFromString(const std::string &content,
+                                 const std::string &functionName,
+                                 const kernelInfo &info_ = defaultKernelInfo,
+                                 const int language = usingOKL);
+
     kernel buildKernelFromBinary(const std::string &filename,
                                  const std::string &functionName);
 
@@ -1409,17 +1719,37 @@ namespace occa {
     memory wrapMemory(void *handle_,
                       const uintptr_t bytes);
 
+    // Buffer backed by [ptr], kernels use the host memory directly when
+    //   the device shares it (CPU modes, CPU/integrated OpenCL devices).
+    //   [ptr] is not freed with the buffer
+    memory wrapHostMemory(void *ptr,
+                          const uintptr_t bytes);
+
     memory wrapTexture(void *handle_,
                        const int dim, const occa::dim &dims,
                        occa::formatType type, const int permissions);
 
     memory malloc(const uintptr_t bytes,
-                  void *source = NULL);
+                  void *source = NULL,
+                  const int pages = pageType::deviceDefault);
 
     memory talloc(const int dim, const occa::dim &dims,
                   void *source,
                   occa::formatType type, const int permissions = readWrite);
 
+    // Pthreads and OpenMP only, processes on the same node can map the
+    //   buffer with wrapSharedMemory([name])
+    memory mallocShared(const std::string &name,
+                        const uintptr_t bytes,
+                        void *source = NULL);
+
+    memory wrapSharedMemory(const std::string &name);
+
+    // Pthreads and OpenMP only, [flags] are fileMap:: bits
+    memory mmapFile(const std::string &filename,
+                    const uintptr_t bytes = 0,
+                    const int flags = fileMap::readWrite);
+
     void free();
 
     int simdWidth();
@@ -1495,6 +1825,8 @@ namespace occa {
          (name == "OCCA_USING_CUDA")     ||
          (name == "OCCA_USING_COI")      ||
 
+         (name == "OCCA_USING_OPENMP_REGION") ||
+
          (name == "occaInnerDim0") ||
          (name == "occaInnerDim1") ||
          (name == "occaInnerDim2") ||
@@ -1672,6 +2004,46 @@ namespace occa {
   inline uintptr_t& dim::operator [] (int i){
     return data[i];
   }
+
+  inline rect::rect() :
+    origin(0,0,0),
+    rowPitch(0),
+    slicePitch(0) {}
+
+  inline rect::rect(const uintptr_t originX,
+                    const uintptr_t originY,
+                    const uintptr_t originZ,
+                    const uintptr_t rowPitch_,
+                    const uintptr_t slicePitch_) :
+    origin(originX, originY, originZ),
+    rowPitch(rowPitch_),
+    slicePitch(slicePitch_) {}
+
+  inline rect::rect(const rect &r) :
+    origin(r.origin),
+    rowPitch(r.rowPitch),
+    slicePitch(r.slicePitch) {}
+
+  inline rect& rect::operator = (const rect &r){
+    origin     = r.origin;
+    rowPitch   = r.rowPitch;
+    slicePitch = r.slicePitch;
+
+    return *this;
+  }
+
+  inline uintptr_t rect::offset() const {
+    return (origin.x +
+            origin.y*rowPitch +
+            origin.z*slicePitch);
+  }
+
+  inline uintptr_t rect::end(const occa::dim &region) const {
+    return (offset() +
+            (region.z - 1)*slicePitch +
+            (region.y - 1)*rowPitch +
+            region.x);
+  }
 };
 
 #endif
@@ -112,6 +112,10 @@ extern "C" {
   extern LIBOCCA_API const uintptr_t occaAutoSize;
   extern LIBOCCA_API const uintptr_t occaNoOffset;
 
+  extern LIBOCCA_API const int occaUsingOKL;
+  extern LIBOCCA_API const int occaUsingOFL;
+  extern LIBOCCA_API const int occaUsingNative;
+
   extern LIBOCCA_API const uintptr_t occaTypeSize[OCCA_TYPE_COUNT];
 
   //---[ TypeCasting ]------------------
@@ -151,6 +155,12 @@ extern "C" {
                                                                        const char *functionName,
                                                                        occaKernelInfo info);
 
+  LIBOCCA_API occaKernel LIBOCCA_CALLINGCONV occaBuildKernelFromString(occaDevice device,
+                                                                       const char *str,
+                                                                       const char *functionName,
+                                                                       occaKernelInfo info,
+                                                                       const int language);
+
   LIBOCCA_API occaKernel LIBOCCA_CALLINGCONV occaBuildKernelFromBinary(occaDevice device,
                                                                        const char *filename,
                                                                        const char *functionName);
@@ -179,6 +189,7 @@ extern "C" {
   LIBOCCA_API occaTag LIBOCCA_CALLINGCONV occaDeviceTagStream(occaDevice device);
   LIBOCCA_API double LIBOCCA_CALLINGCONV occaDeviceTimeBetweenTags(occaDevice device,
                                                                    occaTag startTag, occaTag endTag);
+  LIBOCCA_API void LIBOCCA_CALLINGCONV occaDeviceFreeTag(occaDevice device, occaTag tag);
 
   LIBOCCA_API void LIBOCCA_CALLINGCONV occaDeviceStreamFree(occaDevice device, occaStream stream);
 
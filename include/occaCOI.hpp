@@ -96,6 +96,9 @@ namespace occa {
   kernel_t<COI>* kernel_t<COI>::loadFromLibrary(const char *cache,
                                                 const std::string &functionName_);
 
+  template <>
+  kernel_t<COI>* kernel_t<COI>::buildSibling(const std::string &functionName_);
+
   template <>
   int kernel_t<COI>::preferredDimSize();
 
@@ -170,6 +173,49 @@ namespace occa {
                                   const uintptr_t destOffset,
                                   const uintptr_t srcOffset);
 
+  template <>
+  void memory_t<COI>::copyRectFrom(const void *source,
+                                   const occa::dim &region,
+                                   const occa::rect &destRect,
+                                   const occa::rect &srcRect);
+
+  template <>
+  void memory_t<COI>::copyRectFrom(const memory_v *source,
+                                   const occa::dim &region,
+                                   const occa::rect &destRect,
+                                   const occa::rect &srcRect);
+
+  template <>
+  void memory_t<COI>::copyRectTo(void *dest,
+                                 const occa::dim &region,
+                                 const occa::rect &destRect,
+                                 const occa::rect &srcRect);
+
+  template <>
+  void memory_t<COI>::asyncCopyRectFrom(const void *source,
+                                        const occa::dim &region,
+                                        const occa::rect &destRect,
+                                        const occa::rect &srcRect);
+
+  template <>
+  void memory_t<COI>::asyncCopyRectFrom(const memory_v *source,
+                                        const occa::dim &region,
+                                        const occa::rect &destRect,
+                                        const occa::rect &srcRect);
+
+  template <>
+  void memory_t<COI>::asyncCopyRectTo(void *dest,
+                                      const occa::dim &region,
+                                      const occa::rect &destRect,
+                                      const occa::rect &srcRect);
+
+  template <>
+  void* memory_t<COI>::map(const uintptr_t bytes,
+                           const uintptr_t offset);
+
+  template <>
+  void memory_t<COI>::unmap();
+
   template <>
   void memory_t<COI>::free();
   //==================================
@@ -224,6 +270,9 @@ namespace occa {
   template <>
   void device_t<COI>::waitFor(tag tag_);
 
+  template <>
+  void device_t<COI>::streamWaitFor(tag tag_);
+
   template <>
   stream device_t<COI>::createStream();
 
@@ -239,6 +288,9 @@ namespace occa {
   template <>
   double device_t<COI>::timeBetween(const tag &startTag, const tag &endTag);
 
+  template <>
+  void device_t<COI>::freeTag(tag tag_);
+
   template <>
   kernel_v* device_t<COI>::buildKernelFromSource(const std::string &filename,
                                                  const std::string &functionName_,
@@ -257,10 +309,17 @@ namespace occa {
   kernel_v* device_t<COI>::loadKernelFromLibrary(const char *cache,
                                                  const std::string &functionName_);
 
+  template <>
+  void device_t<COI>::runGraph(occa::graph &g);
+
   template <>
   memory_v* device_t<COI>::wrapMemory(void *handle_,
                                       const uintptr_t bytes);
 
+  template <>
+  memory_v* device_t<COI>::wrapHostMemory(void *ptr,
+                                          const uintptr_t bytes);
+
   template <>
   memory_v* device_t<COI>::wrapTexture(void *handle_,
                                        const int dim, const occa::dim &dims,
@@ -268,7 +327,8 @@ namespace occa {
 
   template <>
   memory_v* device_t<COI>::malloc(const uintptr_t bytes,
-                                  void *source);
+                                  void *source,
+                                  const int pages);
 
   template <>
   memory_v* device_t<COI>::talloc(const int dim, const occa::dim &dims,
@@ -39,7 +39,7 @@ namespace occa {
     void init();
   };
 
-  extern const CUarray_format cudaFormats[8];
+  extern const CUarray_format cudaFormats[9];
 
   template <>
   void* formatType::format<occa::CUDA>() const;
@@ -79,6 +79,9 @@ namespace occa {
   kernel_t<CUDA>* kernel_t<CUDA>::loadFromLibrary(const char *cache,
                                                   const std::string &functionName_);
 
+  template <>
+  kernel_t<CUDA>* kernel_t<CUDA>::buildSibling(const std::string &functionName_);
+
   template <>
   int kernel_t<CUDA>::preferredDimSize();
 
@@ -153,6 +156,49 @@ namespace occa {
                                    const uintptr_t destOffset,
                                    const uintptr_t srcOffset);
 
+  template <>
+  void memory_t<CUDA>::copyRectFrom(const void *source,
+                                    const occa::dim &region,
+                                    const occa::rect &destRect,
+                                    const occa::rect &srcRect);
+
+  template <>
+  void memory_t<CUDA>::copyRectFrom(const memory_v *source,
+                                    const occa::dim &region,
+                                    const occa::rect &destRect,
+                                    const occa::rect &srcRect);
+
+  template <>
+  void memory_t<CUDA>::copyRectTo(void *dest,
+                                  const occa::dim &region,
+                                  const occa::rect &destRect,
+                                  const occa::rect &srcRect);
+
+  template <>
+  void memory_t<CUDA>::asyncCopyRectFrom(const void *source,
+                                         const occa::dim &region,
+                                         const occa::rect &destRect,
+                                         const occa::rect &srcRect);
+
+  template <>
+  void memory_t<CUDA>::asyncCopyRectFrom(const memory_v *source,
+                                         const occa::dim &region,
+                                         const occa::rect &destRect,
+                                         const occa::rect &srcRect);
+
+  template <>
+  void memory_t<CUDA>::asyncCopyRectTo(void *dest,
+                                       const occa::dim &region,
+                                       const occa::rect &destRect,
+                                       const occa::rect &srcRect);
+
+  template <>
+  void* memory_t<CUDA>::map(const uintptr_t bytes,
+                            const uintptr_t offset);
+
+  template <>
+  void memory_t<CUDA>::unmap();
+
   template <>
   void memory_t<CUDA>::free();
   //==================================
@@ -207,6 +253,9 @@ namespace occa {
   template <>
   void device_t<CUDA>::waitFor(tag tag_);
 
+  template <>
+  void device_t<CUDA>::streamWaitFor(tag tag_);
+
   template <>
   stream device_t<CUDA>::createStream();
 
@@ -222,6 +271,9 @@ namespace occa {
   template <>
   double device_t<CUDA>::timeBetween(const tag &startTag, const tag &endTag);
 
+  template <>
+  void device_t<CUDA>::freeTag(tag tag_);
+
   template <>
   kernel_v* device_t<CUDA>::buildKernelFromSource(const std::string &filename,
                                                   const std::string &functionName_,
@@ -240,10 +292,17 @@ namespace occa {
   kernel_v* device_t<CUDA>::loadKernelFromLibrary(const char *cache,
                                                   const std::string &functionName_);
 
+  template <>
+  void device_t<CUDA>::runGraph(occa::graph &g);
+
   template <>
   memory_v* device_t<CUDA>::wrapMemory(void *handle_,
                                        const uintptr_t bytes);
 
+  template <>
+  memory_v* device_t<CUDA>::wrapHostMemory(void *ptr,
+                                           const uintptr_t bytes);
+
   template <>
   memory_v* device_t<CUDA>::wrapTexture(void *handle_,
                                         const int dim, const occa::dim &dims,
@@ -251,7 +310,8 @@ namespace occa {
 
   template <>
   memory_v* device_t<CUDA>::malloc(const uintptr_t bytes,
-                                   void *source);
+                                   void *source,
+                                   const int pages);
 
   template <>
   memory_v* device_t<CUDA>::talloc(const int dim, const occa::dim &dims,
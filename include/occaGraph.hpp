@@ -0,0 +1,128 @@
+#ifndef OCCA_GRAPH_HEADER
+#define OCCA_GRAPH_HEADER
+
+#include <iostream>
+#include <vector>
+
+#include "occaTools.hpp"
+#include "occaBase.hpp"
+
+namespace occa {
+  //---[ Graph ]----------------------
+  //  Records a sequence of kernel launches, copies and tags on a device
+  //    and replays it in order. Kernel arguments are packed once when
+  //    recorded, only the ones patched with setArgument() change
+  //
+  //  CPU modes submit launches together:
+  //    OpenMP  : One team runs the launches between kernels that open
+  //              their own parallel for's (non-OKL kernels)
+  //    Pthreads: Each worker gets one job for the launches between copies
+  //
+  //  occa::graph step(device);
+  //
+  //  const int update = step.addKernel(updateKernel);
+  //  step.setArgument(update, 0, entries);
+  //  step.setArgument(update, 1, o_u);
+  //  step.addCopyTo(u, o_u);
+  //
+  //  for(int t = 0; t < steps; ++t){
+  //    step.setArgument(update, 2, t*dt); // Patch a scalar
+  //    step.run();
+  //  }
+  namespace graphNode {
+    static const int kernelLaunch = 0;
+    static const int copy         = 1;
+    static const int copyFrom     = 2;
+    static const int copyTo       = 3;
+    static const int tagStream    = 4;
+  };
+
+  class graphNode_t {
+  public:
+    int type;
+
+    // Keeps its own argument list, the kernel handle is shared
+    occa::kernel k;
+
+    int dims;
+    dim inner, outer;
+
+    occa::memory dest, src;
+    void *hostPtr;
+    uintptr_t bytes, destOffset, srcOffset;
+    bool async;
+
+    // Set once the node has been replayed, the graph frees it
+    occa::tag streamTag;
+    bool hasTag;
+
+    graphNode_t();
+
+    graphNode_t(const graphNode_t &n);
+    graphNode_t& operator = (const graphNode_t &n);
+  };
+
+  class graph {
+  public:
+    occa::device dev;
+
+    std::vector<graphNode_t> nodes;
+
+    graph();
+    graph(occa::device dev_);
+
+    graph(const graph &g);
+    graph& operator = (const graph &g);
+
+    void setDevice(occa::device dev_);
+
+    int size() const;
+
+    // Also frees the tags set by replays
+    void clear();
+
+    // Returns the node id used to patch arguments
+    int addKernel(occa::kernel &k);
+
+    int addKernel(occa::kernel &k,
+                  const int dims, const dim &inner, const dim &outer);
+
+    void setArgument(const int nodeID,
+                     const int argPos,
+                     const kernelArg &arg);
+
+    void setWorkingDims(const int nodeID,
+                        const int dims, const dim &inner, const dim &outer);
+
+    int addCopy(occa::memory &dest,
+                occa::memory &src,
+                const uintptr_t bytes = 0,
+                const uintptr_t destOffset = 0,
+                const uintptr_t srcOffset = 0,
+                const bool async = false);
+
+    int addCopyFrom(occa::memory &dest,
+                    const void *src,
+                    const uintptr_t bytes = 0,
+                    const uintptr_t offset = 0,
+                    const bool async = false);
+
+    int addCopyTo(void *dest,
+                  occa::memory &src,
+                  const uintptr_t bytes = 0,
+                  const uintptr_t offset = 0,
+                  const bool async = false);
+
+    // The node's tag is set with device::tagStream() on each replay and
+    //   freed by the next replay or clear(), graph copies don't own it
+    int addTag();
+
+    occa::tag getTag(const int nodeID) const;
+
+    void run();
+    void runNode(graphNode_t &node);
+  };
+  //==================================
+};
+
+#endif
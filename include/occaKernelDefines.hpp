@@ -1,8 +1,12 @@
 namespace occa {
-    extern char occaPthreadsDefines[10606];
-    extern char occaOpenMPDefines[10781];
-    extern char occaOpenCLDefines[10053];
-    extern char occaCUDADefines[11242];
-    extern char occaCOIDefines[10667];
+    extern char occaPthreadsDefines[8290];
+    extern char occaOpenMPDefines[9605];
+    extern char occaCPUPrivateDefines[3193];
+    extern char occaCPUVectorDefines[11786];
+    extern char occaCPUHalfDefines[6148];
+    extern char occaCPUFastMathDefines[17386];
+    extern char occaOpenCLDefines[11751];
+    extern char occaCUDADefines[13827];
+    extern char occaCOIDefines[11358];
     extern char occaCOIMain[37440];
 }
@@ -18,6 +18,14 @@
 
 namespace occa {
   //---[ Data Structs ]---------------
+  namespace cl {
+    // NULL nested kernel slot + texture samplers
+    static const int maxArgumentSlots = (2*OCCA_MAX_ARGS + 1);
+
+    // Larger arguments are always rebound
+    static const int cachedArgumentBytes = 16;
+  };
+
   struct OpenCLKernelData_t {
     int platform, device;
 
@@ -26,6 +34,13 @@ namespace occa {
     cl_context     context;
     cl_program     program;
     cl_kernel      kernel;
+
+    // Last value set in each argument slot, [boundBytes] is 0 when unknown.
+    //   Freeing memory can recycle cl_mem handles, the cache is cleared
+    //   when [boundFrees] is behind the freed-memory count
+    uintptr_t boundFrees;
+    uintptr_t boundBytes[cl::maxArgumentSlots];
+    char boundValues[cl::maxArgumentSlots][cl::cachedArgumentBytes];
   };
 
   struct OpenCLDeviceData_t {
@@ -34,6 +49,13 @@ namespace occa {
     cl_platform_id platformID;
     cl_device_id   deviceID;
     cl_context     context;
+
+    // CPU and integrated devices, buffers can live in host memory
+    bool sharesHostMemory;
+
+    // Set with [outOfOrder = 1], commands in a stream are only ordered
+    //   through tags (device::streamWaitFor) or finish()
+    bool outOfOrder;
   };
   //==================================
 
@@ -60,6 +82,8 @@ namespace occa {
 
     int deviceVendor(int pID, int dID);
 
+    bool deviceSharesHostMemory(cl_device_id clDID);
+
     int deviceCoreCount(int pID, int dID);
 
     occa::deviceInfo deviceInfo(int pID, int dID);
@@ -80,9 +104,17 @@ namespace occa {
 
     void saveProgramBinary(OpenCLKernelData_t &data_,
                            const std::string &cachedBinary);
+
+    void clearArgumentCache(OpenCLKernelData_t &data_);
+
+    // Only calls clSetKernelArg if [value] changed since the last launch
+    cl_int setKernelArg(OpenCLKernelData_t &data_,
+                        const int argPos,
+                        const uintptr_t bytes,
+                        const void *value);
   };
 
-  extern const cl_channel_type clFormats[8];
+  extern const cl_channel_type clFormats[9];
 
   template <>
   void* formatType::format<occa::OpenCL>() const;
@@ -119,6 +151,9 @@ namespace occa {
   kernel_t<OpenCL>* kernel_t<OpenCL>::loadFromLibrary(const char *cache,
                                                       const std::string &functionName_);
 
+  template <>
+  kernel_t<OpenCL>* kernel_t<OpenCL>::buildSibling(const std::string &functionName_);
+
   template <>
   int kernel_t<OpenCL>::preferredDimSize();
 
@@ -193,6 +228,49 @@ namespace occa {
                                      const uintptr_t destOffset,
                                      const uintptr_t srcOffset);
 
+  template <>
+  void memory_t<OpenCL>::copyRectFrom(const void *source,
+                                      const occa::dim &region,
+                                      const occa::rect &destRect,
+                                      const occa::rect &srcRect);
+
+  template <>
+  void memory_t<OpenCL>::copyRectFrom(const memory_v *source,
+                                      const occa::dim &region,
+                                      const occa::rect &destRect,
+                                      const occa::rect &srcRect);
+
+  template <>
+  void memory_t<OpenCL>::copyRectTo(void *dest,
+                                    const occa::dim &region,
+                                    const occa::rect &destRect,
+                                    const occa::rect &srcRect);
+
+  template <>
+  void memory_t<OpenCL>::asyncCopyRectFrom(const void *source,
+                                           const occa::dim &region,
+                                           const occa::rect &destRect,
+                                           const occa::rect &srcRect);
+
+  template <>
+  void memory_t<OpenCL>::asyncCopyRectFrom(const memory_v *source,
+                                           const occa::dim &region,
+                                           const occa::rect &destRect,
+                                           const occa::rect &srcRect);
+
+  template <>
+  void memory_t<OpenCL>::asyncCopyRectTo(void *dest,
+                                         const occa::dim &region,
+                                         const occa::rect &destRect,
+                                         const occa::rect &srcRect);
+
+  template <>
+  void* memory_t<OpenCL>::map(const uintptr_t bytes,
+                              const uintptr_t offset);
+
+  template <>
+  void memory_t<OpenCL>::unmap();
+
   template <>
   void memory_t<OpenCL>::free();
   //==================================
@@ -250,6 +328,9 @@ namespace occa {
   template <>
   void device_t<OpenCL>::waitFor(tag tag_);
 
+  template <>
+  void device_t<OpenCL>::streamWaitFor(tag tag_);
+
   template <>
   stream device_t<OpenCL>::createStream();
 
@@ -265,6 +346,9 @@ namespace occa {
   template <>
   double device_t<OpenCL>::timeBetween(const tag &startTag, const tag &endTag);
 
+  template <>
+  void device_t<OpenCL>::freeTag(tag tag_);
+
   template <>
   kernel_v* device_t<OpenCL>::buildKernelFromSource(const std::string &filename,
                                                     const std::string &functionName_,
@@ -283,10 +367,17 @@ namespace occa {
   kernel_v* device_t<OpenCL>::loadKernelFromLibrary(const char *cache,
                                                     const std::string &functionName_);
 
+  template <>
+  void device_t<OpenCL>::runGraph(occa::graph &g);
+
   template <>
   memory_v* device_t<OpenCL>::wrapMemory(void *handle_,
                                          const uintptr_t bytes);
 
+  template <>
+  memory_v* device_t<OpenCL>::wrapHostMemory(void *ptr,
+                                             const uintptr_t bytes);
+
   template <>
   memory_v* device_t<OpenCL>::wrapTexture(void *handle_,
                                           const int dim, const occa::dim &dims,
@@ -294,7 +385,8 @@ namespace occa {
 
   template <>
   memory_v* device_t<OpenCL>::malloc(const uintptr_t bytes,
-                                     void *source);
+                                     void *source,
+                                     const int pages);
 
   template <>
   memory_v* device_t<OpenCL>::talloc(const int dim, const occa::dim &dims,
@@ -11,6 +11,10 @@
 
 #include "occaKernelDefines.hpp"
 
+#if (OCCA_OS == LINUX_OS)
+#  include <sched.h>
+#endif
+
 #if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
 #  include <dlfcn.h>
 #else
@@ -19,9 +23,52 @@
 
 namespace occa {
   //---[ Data Structs ]---------------
+  struct OpenMPTeam_t {
+    int threadCount;     // 0 keeps the caller's team size
+    int schedule, chunk; // omp_sched_t and chunk size for schedule(runtime), 0 keeps the caller's
+
+    std::vector<int> pinnedCores;
+  };
+
+  struct OpenMPDeviceData_t {
+    OpenMPTeam_t team;
+
+    int pages; // pageType used by malloc() for large buffers
+  };
+
   struct OpenMPKernelData_t {
     void *dlHandle, *handle;
+
+    // Siblings share the library, only its first kernel closes it
+    bool ownsLibrary;
+
+    // Launchers whose nested kernels share one team, every thread of
+    //   the team runs the launcher
+    bool usesRegion;
+
+    // Device's team when the kernel was built, launches don't go through the device
+    OpenMPTeam_t team;
   };
+
+  // Sets the launching thread's team ICVs and affinity while in scope,
+  //   the caller's are restored when it ends
+  class openMPTeamScope {
+  private:
+    bool changedICVs;
+    int threadCount, schedule, chunk;
+
+#if (OCCA_OS == LINUX_OS)
+    bool changedAffinity;
+    cpu_set_t affinity;
+#endif
+
+  public:
+    openMPTeamScope(const OpenMPTeam_t &team);
+    ~openMPTeamScope();
+  };
+
+  // True if [kData] is a launcher that still needs its team opened
+  bool openMPLaunchOpensTeam(OpenMPKernelData_t &kData);
   //==================================
 
 
@@ -55,6 +102,9 @@ namespace occa {
   kernel_t<OpenMP>* kernel_t<OpenMP>::loadFromLibrary(const char *cache,
                                                       const std::string &functionName_);
 
+  template <>
+  kernel_t<OpenMP>* kernel_t<OpenMP>::buildSibling(const std::string &functionName_);
+
   template <>
   int kernel_t<OpenMP>::preferredDimSize();
 
@@ -129,6 +179,49 @@ namespace occa {
                                      const uintptr_t destOffset,
                                      const uintptr_t srcOffset);
 
+  template <>
+  void memory_t<OpenMP>::copyRectFrom(const void *source,
+                                      const occa::dim &region,
+                                      const occa::rect &destRect,
+                                      const occa::rect &srcRect);
+
+  template <>
+  void memory_t<OpenMP>::copyRectFrom(const memory_v *source,
+                                      const occa::dim &region,
+                                      const occa::rect &destRect,
+                                      const occa::rect &srcRect);
+
+  template <>
+  void memory_t<OpenMP>::copyRectTo(void *dest,
+                                    const occa::dim &region,
+                                    const occa::rect &destRect,
+                                    const occa::rect &srcRect);
+
+  template <>
+  void memory_t<OpenMP>::asyncCopyRectFrom(const void *source,
+                                           const occa::dim &region,
+                                           const occa::rect &destRect,
+                                           const occa::rect &srcRect);
+
+  template <>
+  void memory_t<OpenMP>::asyncCopyRectFrom(const memory_v *source,
+                                           const occa::dim &region,
+                                           const occa::rect &destRect,
+                                           const occa::rect &srcRect);
+
+  template <>
+  void memory_t<OpenMP>::asyncCopyRectTo(void *dest,
+                                         const occa::dim &region,
+                                         const occa::rect &destRect,
+                                         const occa::rect &srcRect);
+
+  template <>
+  void* memory_t<OpenMP>::map(const uintptr_t bytes,
+                              const uintptr_t offset);
+
+  template <>
+  void memory_t<OpenMP>::unmap();
+
   template <>
   void memory_t<OpenMP>::free();
   //==================================
@@ -183,6 +276,9 @@ namespace occa {
   template <>
   void device_t<OpenMP>::waitFor(tag tag_);
 
+  template <>
+  void device_t<OpenMP>::streamWaitFor(tag tag_);
+
   template <>
   stream device_t<OpenMP>::createStream();
 
@@ -198,6 +294,9 @@ namespace occa {
   template <>
   double device_t<OpenMP>::timeBetween(const tag &startTag, const tag &endTag);
 
+  template <>
+  void device_t<OpenMP>::freeTag(tag tag_);
+
   template <>
   kernel_v* device_t<OpenMP>::buildKernelFromSource(const std::string &filename,
                                                     const std::string &functionName_,
@@ -216,10 +315,17 @@ namespace occa {
   kernel_v* device_t<OpenMP>::loadKernelFromLibrary(const char *cache,
                                                     const std::string &functionName_);
 
+  template <>
+  void device_t<OpenMP>::runGraph(occa::graph &g);
+
   template <>
   memory_v* device_t<OpenMP>::wrapMemory(void *handle_,
                                          const uintptr_t bytes);
 
+  template <>
+  memory_v* device_t<OpenMP>::wrapHostMemory(void *ptr,
+                                             const uintptr_t bytes);
+
   template <>
   memory_v* device_t<OpenMP>::wrapTexture(void *handle_,
                                           const int dim, const occa::dim &dims,
@@ -227,7 +333,8 @@ namespace occa {
 
   template <>
   memory_v* device_t<OpenMP>::malloc(const uintptr_t bytes,
-                                     void *source);
+                                     void *source,
+                                     const int pages);
 
   template <>
   memory_v* device_t<OpenMP>::talloc(const int dim, const occa::dim &dims,
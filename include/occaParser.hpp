@@ -13,15 +13,35 @@ namespace occa {
   namespace parserNS {
     class occaLoopInfo;
 
+    // Outer-scope variable read or written inside an inner-loop body
+    class loopAccess_t {
+    public:
+      varInfo *var;
+      bool isWrite;
+
+      // [isInjective]: work-items never touch the same entry
+      std::string index;
+      bool isInjective;
+    };
+
+    typedef std::vector<loopAccess_t> loopAccessVector_t;
+
     class parserBase {
     public:
-      static const int version = 100;
+      static const int version = 103;
 
       bool parsingC;
 
-      macroMap_t macroMap;
+      // Owns the nodes created while translating
+      parserArena arena;
+
+      macroTable macroMap;
       std::vector<macroInfo> macros;
 
+      // Macros being expanded, expansions are only memoized at depth 0
+      //   since the ones below depend on which macros are being expanded
+      int macroDepth;
+
       bool macrosAreInitialized;
 
       varUsedMap_t varUpdateMap;
@@ -34,15 +54,20 @@ namespace occa {
       //---[ Warnings ]-----------------
       bool warnForMissingBarriers;
       bool warnForBarrierConditionals;
+      bool warnForRemovedBarriers;
       //================================
 
       parserBase();
+      ~parserBase();
 
       const std::string parseFile(const std::string &filename,
                                   const bool parsingC_ = true);
 
       const std::string parseSource(const char *cRoot);
 
+      const std::string parseSource(const std::string &source,
+                                    const bool parsingC_);
+
       //---[ Macro Parser Functions ]---
       std::string getMacroName(const char *&c);
 
@@ -53,6 +78,11 @@ namespace occa {
       int loadMacro(const std::string &line, const int state = doNothing);
 
       void applyMacros(std::string &line);
+      void expandMacros(const char *c, std::string &newLine);
+      void expandObjectMacro(macroInfo &info, std::string &newLine);
+      void expandFunctionMacro(macroInfo &info,
+                               const char *&c,
+                               std::string &newLine);
 
       strNode* preprocessMacros(strNode *nodeRoot);
 
@@ -115,6 +145,43 @@ namespace occa {
 
       bool statementHasBarrier(statement &s);
 
+      void minimizeBarriers();
+      void minimizeBarriersInStatement(statement &s);
+
+      statement* getInnerMostOccaFor(statement &s);
+      bool innerLoopsMatch(statement &s1, statement &s2);
+
+      bool innerLoopsCanBeFused(statement &s1,
+                                statement &s2,
+                                const bool hasGlobalFence);
+
+      bool addLoopAccesses(statement &s,
+                           statement &sLoop,
+                           const std::string &iter,
+                           const bool inLoopScope,
+                           loopAccessVector_t &accesses);
+
+      bool indexIsInjective(expNode &exp,
+                            statement &s,
+                            statement &sLoop,
+                            const std::string &iter);
+
+      bool expIsLoopInvariant(expNode &exp,
+                              statement &s,
+                              statement &sLoop,
+                              const std::string &iter);
+
+      varInfo* hasVariableInKernelScope(statement &s,
+                                        const std::string &varName);
+
+      bool varIsLocalToLoop(varInfo &var,
+                            statement &s,
+                            statement &sLoop);
+
+      void fuseInnerLoops(statement &origin,
+                          statementNode *snLoop1,
+                          statementNode *snLoop2);
+
       void fixOccaForStatementOrder(statement &origin, statementNode *sn);
       void fixOccaForOrder();
 
@@ -128,10 +195,18 @@ namespace occa {
 
       void addArgQualifiers();
 
+      void copyScalarArgs();
+      void addPointerArgQualifiers();
+
       void modifyExclusiveVariables(statement &s);
 
       void modifyTextureVariables();
 
+      void addSimdFors(statement &s);
+      bool scopeHasExclusives(statement &s);
+      bool statementHasExclusives(statement &s);
+      bool statementIsSimdSafe(statement &s, const bool inBreakableScope);
+
       statementNode* splitKernelStatement(statementNode *snKernel,
                                           kernelInfo &info);
 
@@ -0,0 +1,104 @@
+#ifndef OCCA_PARSER_ARENA_HEADER
+#define OCCA_PARSER_ARENA_HEADER
+
+#include "occaParserDefines.hpp"
+
+namespace occa {
+  namespace parserNS {
+    //---[ Parser Arena ]---------------------------
+    //  Parser nodes (strNode, expNode, statement, varInfo, typeInfo, ...)
+    //    are allocated through the active arena while a translation is
+    //    running and are all released in one shot when it finishes.
+    //  Allocations made without an active arena go to the heap and
+    //    behave like regular new/delete.
+    typedef void (*arenaDestructor_t)(void *ptr);
+
+    class parserArena {
+    public:
+      struct allocHeader_t {
+        parserArena *arena;
+        arenaDestructor_t destructor;
+        allocHeader_t *next;
+        int isAlive;
+      };
+
+      struct block_t {
+        block_t *next;
+        size_t bytes, used;
+      };
+
+      static const size_t headerBytes;
+      static const size_t blockHeaderBytes;
+      static const size_t defaultBlockBytes;
+
+      static parserArena *current;
+
+      block_t *blocks;
+      allocHeader_t *allocs;
+
+      size_t bytesAllocated, bytesReserved;
+      int liveAllocs;
+
+      parserArena();
+      ~parserArena();
+
+      void* allocate(const size_t bytes,
+                     arenaDestructor_t destructor);
+
+      block_t* newBlock(const size_t bytes);
+
+      void release();
+
+      static void* alloc(const size_t bytes,
+                         arenaDestructor_t destructor = NULL);
+
+      static void dealloc(void *ptr);
+
+      static allocHeader_t* headerOf(void *ptr);
+    };
+
+    // Sets [arena] as the active arena for the lifetime of the scope
+    class arenaScope {
+    public:
+      parserArena *previous;
+
+      inline arenaScope(parserArena &arena) :
+        previous(parserArena::current) {
+        parserArena::current = &arena;
+      }
+
+      inline ~arenaScope(){
+        parserArena::current = previous;
+      }
+    };
+
+    template <class TM>
+    void arenaDestroy(void *ptr){
+      ((TM*) ptr)->~TM();
+    }
+
+    // Only for types without destructors (pointer/bool arrays)
+    template <class TM>
+    inline TM* arenaNewArray(const int count){
+      return (TM*) parserArena::alloc(count * sizeof(TM));
+    }
+
+    template <class TM>
+    inline void arenaDeleteArray(TM *ptr){
+      parserArena::dealloc((void*) ptr);
+    }
+    //==============================================
+  };
+};
+
+#define OCCA_PARSER_ARENA_OPERATORS(CLASS)                              \
+  inline static void* operator new(size_t bytes){                       \
+    return occa::parserNS::parserArena::alloc(bytes,                    \
+                                              &occa::parserNS::arenaDestroy<CLASS>); \
+  }                                                                     \
+                                                                        \
+  inline static void operator delete(void *ptr){                        \
+    occa::parserNS::parserArena::dealloc(ptr);                          \
+  }
+
+#endif
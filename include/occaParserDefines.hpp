@@ -41,10 +41,6 @@ namespace occa {
   typedef parserNS::node<parserNS::statement*> statementNode;
   typedef parserNS::node<parserNS::varInfo*>   varInfoNode;
 
-  typedef std::map<std::string,int>  macroMap_t;
-  typedef macroMap_t::iterator       macroMapIterator;
-  typedef macroMap_t::const_iterator cMacroMapIterator;
-
   typedef std::map<std::string,int>        keywordTypeMap_t;
   typedef keywordTypeMap_t::iterator       keywordTypeMapIterator;
   typedef keywordTypeMap_t::const_iterator cKeywordTypeMapIterator;
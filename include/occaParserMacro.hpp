@@ -98,6 +98,12 @@ namespace occa {
       std::vector<std::string> parts;
       std::vector<int> argBetweenParts;
 
+      // Memoized expansion of object-like macros,
+      //   valid while [expandedGeneration] matches the table's generation
+      std::string expandedBody;
+      int expandedGeneration;
+      bool isExpanding;
+
       macroInfo();
 
       std::string applyArgs(const std::vector<std::string> &args);
@@ -105,6 +111,39 @@ namespace occa {
 
     std::ostream& operator << (std::ostream &out, const macroInfo &info);
     //==============================================
+
+
+    //---[ Macro Table ]----------------------------
+    //  Open hash of macro names -> position in the parser's macro vector
+    //  Lookups take (char*, chars) to avoid building a string per word
+    class macroTable {
+    public:
+      struct entry_t {
+        std::string name;
+        unsigned int hash;
+        int pos, next;
+      };
+
+      std::vector<int> buckets;
+      std::vector<entry_t> entries;
+
+      int generation;
+
+      macroTable();
+
+      static unsigned int hash(const char *c, const size_t chars);
+
+      int find(const char *c, const size_t chars) const;
+      int find(const std::string &name) const;
+
+      bool has(const std::string &name) const;
+
+      void set(const std::string &name, const int pos);
+      void erase(const std::string &name);
+
+      void rehash(const int bucketCount);
+    };
+    //==============================================
   };
 };
 
@@ -3,6 +3,7 @@
 
 #include "occaParserDefines.hpp"
 #include "occaParserTools.hpp"
+#include "occaParserArena.hpp"
 
 namespace occa {
   namespace parserNS {
@@ -13,6 +14,8 @@ namespace occa {
       node *left, *right, *up, *down;
       TM value;
 
+      OCCA_PARSER_ARENA_OPERATORS(node<TM>);
+
       node();
       node(const TM &t);
       node(const node<TM> &n);
@@ -59,6 +62,8 @@ namespace occa {
 
       int originalLine;
 
+      OCCA_PARSER_ARENA_OPERATORS(strNode);
+
       strNode();
       strNode(const std::string &value_);
       strNode(const strNode &n);
@@ -2,6 +2,7 @@
 #define OCCA_PARSER_STATEMENT_HEADER
 
 #include "occaParserDefines.hpp"
+#include "occaParserArena.hpp"
 #include "occaParserMacro.hpp"
 #include "occaParserTools.hpp"
 #include "occaParserNodes.hpp"
@@ -104,6 +105,8 @@ namespace occa {
       int leafCount;
       expNode **leaves;
 
+      OCCA_PARSER_ARENA_OPERATORS(expNode);
+
       expNode();
       expNode(statement &s);
       expNode(expNode &up_);
@@ -347,6 +350,8 @@ namespace occa {
       int statementCount;
       statementNode *statementStart, *statementEnd;
 
+      OCCA_PARSER_ARENA_OPERATORS(statement);
+
       statement(parserBase &pb);
 
       statement(const int depth_,
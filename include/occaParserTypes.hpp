@@ -2,6 +2,7 @@
 #define OCCA_PARSER_TYPES_HEADER
 
 #include "occaParserDefines.hpp"
+#include "occaParserArena.hpp"
 #include "occaParserNodes.hpp"
 #include "occaParserStatement.hpp"
 
@@ -98,6 +99,8 @@ namespace occa {
 
       varInfo *typedefVar;
 
+      OCCA_PARSER_ARENA_OPERATORS(typeInfo);
+
       typeInfo();
 
       typeInfo(const typeInfo &type);
@@ -148,6 +151,9 @@ namespace occa {
       static const int functionDec     = (1 << 1);
       static const int functionDef     = (1 << 2);
       static const int functionPointer = (1 << 3);
+
+      // Kernel pointer arguments declared [aligned]
+      static const int alignedPointer  = (1 << 4);
     };
 
     class varInfo {
@@ -175,6 +181,8 @@ namespace occa {
       int functionNestCount;
       varInfo *functionNests;
 
+      OCCA_PARSER_ARENA_OPERATORS(varInfo);
+
       varInfo();
 
       varInfo(const varInfo &var);
@@ -376,9 +384,13 @@ namespace occa {
 
       std::vector<statement*> nestedKernels;
 
+      // Launcher is run by every thread of an OpenMP team
+      bool usesRegion;
+
       inline kernelInfo() :
         name(),
-        baseName() {}
+        baseName(),
+        usesRegion(false) {}
     };
     //==============================================
   };
@@ -387,14 +399,17 @@ namespace occa {
   public:
     std::string baseName;
     int nestedKernels;
+    bool usesRegion;
 
     inline parsedKernelInfo() :
       baseName(""),
-      nestedKernels(0) {}
+      nestedKernels(0),
+      usesRegion(false) {}
 
     inline parsedKernelInfo(parserNS::kernelInfo &kInfo) :
       baseName(kInfo.baseName),
-      nestedKernels(kInfo.nestedKernels.size()) {}
+      nestedKernels(kInfo.nestedKernels.size()),
+      usesRegion(kInfo.usesRegion) {}
   };
 };
 
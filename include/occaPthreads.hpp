@@ -22,6 +22,29 @@ namespace occa {
   struct PthreadKernelArg_t;
   typedef void (*PthreadLaunchHandle_t)(PthreadKernelArg_t &args);
 
+  // Launches collected during a graph replay, each worker runs its
+  //   share of all of them as one job
+  struct PthreadBatch_t {
+    int count;
+
+    // Entry [launch*count + rank]
+    std::vector<PthreadLaunchHandle_t> kernelLaunch;
+    std::vector<PthreadKernelArg_t*> kernelArgs;
+
+    pthread_mutex_t mutex;
+    int arrived, finished;
+    volatile int barrierID;
+  };
+
+  // Rect copy split across the workers, each copies its share
+  struct PthreadCopyRect_t {
+    void *dest;
+    const void *src;
+
+    occa::dim region;
+    occa::rect destRect, srcRect;
+  };
+
   // [-] Hard-coded for now
   struct PthreadsDeviceData_t {
     int coreCount;
@@ -37,10 +60,18 @@ namespace occa {
     std::queue<PthreadKernelArg_t*> kernelArgs[OCCA_MAX_ARGS];
 
     pthread_mutex_t pendingJobsMutex, kernelMutex;
+
+    // Set while a graph replay collects launches
+    PthreadBatch_t *batch;
+
+    int pages; // pageType used by malloc() for large buffers
   };
 
   struct PthreadsKernelData_t {
     void *dlHandle, *handle;
+
+    // Siblings share the library, only its first kernel closes it
+    bool ownsLibrary;
     int pThreadCount;
 
     int *pendingJobs;
@@ -49,6 +80,8 @@ namespace occa {
     std::queue<PthreadKernelArg_t*> *kernelArgs[50];
 
     pthread_mutex_t *pendingJobsMutex, *kernelMutex;
+
+    PthreadBatch_t **batch;
   };
 
   struct PthreadWorkerData_t {
@@ -111,6 +144,9 @@ namespace occa {
   kernel_t<Pthreads>* kernel_t<Pthreads>::loadFromLibrary(const char *cache,
                                                           const std::string &functionName_);
 
+  template <>
+  kernel_t<Pthreads>* kernel_t<Pthreads>::buildSibling(const std::string &functionName_);
+
   template <>
   int kernel_t<Pthreads>::preferredDimSize();
 
@@ -182,6 +218,49 @@ namespace occa {
                                        const uintptr_t destOffset,
                                        const uintptr_t srcOffset);
 
+  template <>
+  void memory_t<Pthreads>::copyRectFrom(const void *source,
+                                        const occa::dim &region,
+                                        const occa::rect &destRect,
+                                        const occa::rect &srcRect);
+
+  template <>
+  void memory_t<Pthreads>::copyRectFrom(const memory_v *source,
+                                        const occa::dim &region,
+                                        const occa::rect &destRect,
+                                        const occa::rect &srcRect);
+
+  template <>
+  void memory_t<Pthreads>::copyRectTo(void *dest,
+                                      const occa::dim &region,
+                                      const occa::rect &destRect,
+                                      const occa::rect &srcRect);
+
+  template <>
+  void memory_t<Pthreads>::asyncCopyRectFrom(const void *source,
+                                             const occa::dim &region,
+                                             const occa::rect &destRect,
+                                             const occa::rect &srcRect);
+
+  template <>
+  void memory_t<Pthreads>::asyncCopyRectFrom(const memory_v *source,
+                                             const occa::dim &region,
+                                             const occa::rect &destRect,
+                                             const occa::rect &srcRect);
+
+  template <>
+  void memory_t<Pthreads>::asyncCopyRectTo(void *dest,
+                                           const occa::dim &region,
+                                           const occa::rect &destRect,
+                                           const occa::rect &srcRect);
+
+  template <>
+  void* memory_t<Pthreads>::map(const uintptr_t bytes,
+                                const uintptr_t offset);
+
+  template <>
+  void memory_t<Pthreads>::unmap();
+
   template <>
   void memory_t<Pthreads>::free();
   //==================================
@@ -236,6 +315,9 @@ namespace occa {
   template <>
   void device_t<Pthreads>::waitFor(tag tag_);
 
+  template <>
+  void device_t<Pthreads>::streamWaitFor(tag tag_);
+
   template <>
   stream device_t<Pthreads>::createStream();
 
@@ -251,6 +333,9 @@ namespace occa {
   template <>
   double device_t<Pthreads>::timeBetween(const tag &startTag, const tag &endTag);
 
+  template <>
+  void device_t<Pthreads>::freeTag(tag tag_);
+
   template <>
   kernel_v* device_t<Pthreads>::buildKernelFromSource(const std::string &filename,
                                                       const std::string &functionName_,
@@ -269,6 +354,9 @@ namespace occa {
   kernel_v* device_t<Pthreads>::loadKernelFromLibrary(const char *cache,
                                                       const std::string &functionName_);
 
+  template <>
+  void device_t<Pthreads>::runGraph(occa::graph &g);
+
   template <>
   void device_t<Pthreads>::free();
 
@@ -276,6 +364,10 @@ namespace occa {
   memory_v* device_t<Pthreads>::wrapMemory(void *handle_,
                                            const uintptr_t bytes);
 
+  template <>
+  memory_v* device_t<Pthreads>::wrapHostMemory(void *ptr,
+                                               const uintptr_t bytes);
+
   template <>
   memory_v* device_t<Pthreads>::wrapTexture(void *handle_,
                                             const int dim, const occa::dim &dims,
@@ -283,7 +375,8 @@ namespace occa {
 
   template <>
   memory_v* device_t<Pthreads>::malloc(const uintptr_t bytes,
-                                       void *source);
+                                       void *source,
+                                       const int pages);
 
   template <>
   memory_v* device_t<Pthreads>::talloc(const int dim, const occa::dim &dims,
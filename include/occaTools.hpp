@@ -86,6 +86,169 @@ namespace occa {
   std::string createIntermediateSource(const std::string &filename,
                                        const std::string &cachedBinary,
                                        const kernelInfo &info);
+
+  //---[ Intermediate Sources ]-------
+  //  Sources for Pthreads, OpenMP and OpenCL kernels stay in memory,
+  //    p_ and i_ files are only written with OCCA_KEEP_INTERMEDIATES=1
+  bool keepIntermediateFiles();
+
+  void writeFile(const std::string &filename,
+                 const std::string &content);
+
+  void setIntermediateSource(const std::string &iCachedBinary,
+                             const std::string &source);
+
+  std::string getIntermediateSource(const std::string &filename,
+                                    const std::string &cachedBinary,
+                                    const kernelInfo &info);
+  //==================================
+
+  //---[ String Sources ]-------------
+  //  Kernel sources given as strings are registered under a filename
+  //    with [extension], readFile() returns them without touching disk
+  std::string setStringSource(const std::string &source,
+                              const std::string &extension);
+
+  void releaseStringSource(const std::string &filename);
+  //==================================
+
+  //---[ Compiler ]-------------------
+  //  Execs [command] directly with [source] on stdin and prints its
+  //    diagnostics, [compilerEnvScript] is sourced once per process
+  int runCompiler(const std::string &compilerEnvScript,
+                  const std::string &command,
+                  const std::string &source);
+  //==================================
+
+  //---[ CPU Prelude ]----------------
+  //  Pthreads and OpenMP kernels get the std headers and a slim core
+  //    of defines, vector types, half types, occaPrivate, fast math and
+  //    the launcher headers are only added when [source] uses them
+  bool usesVectorTypes(const std::string &source);
+  bool usesHalfTypes(const std::string &source);
+
+  std::string getCPUPrelude(const std::string &defines,
+                            const std::string &source);
+
+  // Writes [prelude] to the cache and precompiles it once per
+  //   (compiler, flags, prelude), returns the header to force-include
+  std::string getCachedPrelude(const std::string &prelude,
+                               const std::string &compilerEnvScript,
+                               const std::string &compiler,
+                               const std::string &compilerFlags);
+  //==================================
+
+  //---[ CPU ISA ]--------------------
+  //  Highest vector ISA supported by both the host CPU and the OS
+  namespace cpuISA {
+    static const int none   = 0;
+    static const int sse4_2 = 1;
+    static const int avx    = 2;
+    static const int avx2   = 3; // + FMA, F16C
+    static const int avx512 = 4; // F, CD, BW, DQ, VL
+  };
+
+  int getHostISA();
+
+  std::string isaName(const int isa);
+
+  std::string isaCompilerFlags(const int isa,
+                               const std::string &compiler,
+                               const std::string &compilerFlags);
+
+  int isaSimdWidth(const int isa);
+  //==================================
+
+  //---[ Half Precision ]-------------
+  //  Bulk conversions between floats and 16-bit storage, rounding to
+  //    nearest even. F16C and AVX-512 paths are picked from getHostISA()
+  void floatToHalf(const float *src, uint16_t *dest, const uintptr_t entries);
+  void halfToFloat(const uint16_t *src, float *dest, const uintptr_t entries);
+
+  void floatToBfloat16(const float *src, uint16_t *dest, const uintptr_t entries);
+  void bfloat16ToFloat(const uint16_t *src, float *dest, const uintptr_t entries);
+  //==================================
+
+  //---[ CPU Pages ]------------------
+  //  Page policy for Pthreads and OpenMP allocations, devices pick a
+  //    default with setup("mode = OpenMP, hugePages = 2MB") that only
+  //    applies to buffers spanning a huge page. malloc() can override it
+  namespace pageType {
+    static const int deviceDefault = 0;
+    static const int regular       = 1;
+    static const int transparent   = 2; // madvise(MADV_HUGEPAGE)
+    static const int huge2MB       = 3; // mmap(MAP_HUGETLB)
+    static const int huge1GB       = 4;
+  };
+
+  // none, transparent, 2MB, 1GB
+  int pageTypeFromString(const std::string &str);
+
+  std::string pageSizeName(const uintptr_t bytes);
+
+  // Falls back from 1GB to 2MB pages to transparent huge pages, then to
+  //   regular pages. [pageBytes] is set to the page size backing the
+  //   buffer and [mappedBytes] to its mmap length (0 if not mapped)
+  void* cpuMalloc(const uintptr_t bytes,
+                  const int pages,
+                  const int defaultPages,
+                  uintptr_t &pageBytes,
+                  uintptr_t &mappedBytes);
+
+  void cpuFree(void *ptr, const uintptr_t mappedBytes);
+  //==================================
+
+
+  //---[ CPU Shared Memory ]----------
+  //  Named POSIX shared memory, processes on the same node map the same
+  //    buffer. A fence counter is kept in the last cache line of the
+  //    mapping, after the [bytes] handed to the user
+  void* cpuMallocShared(const std::string &name,
+                        const uintptr_t bytes,
+                        uintptr_t &mappedBytes);
+
+  // [bytes] is set to the size given by the process that created it
+  void* cpuOpenShared(const std::string &name,
+                      uintptr_t &bytes,
+                      uintptr_t &mappedBytes);
+
+  void cpuUnlinkShared(const std::string &name);
+
+  // Returns the new fence value
+  uintptr_t cpuSignalShared(void *ptr, const uintptr_t mappedBytes);
+
+  // Spins until the fence reaches [value]
+  void cpuWaitForShared(void *ptr, const uintptr_t mappedBytes,
+                        const uintptr_t value);
+  //==================================
+
+
+  //---[ CPU File Mapping ]-----------
+  //  Buffers backed by a file with mmap(MAP_SHARED), writes reach the
+  //    file on munmap or after an explicit sync
+  namespace fileMap {
+    static const int read       = (1 << 0);
+    static const int write      = (1 << 1);
+    static const int readWrite  = (read | write);
+    static const int create     = (1 << 2); // Create or grow the file to [bytes]
+
+    // madvise() hints
+    static const int sequential = (1 << 3);
+    static const int random     = (1 << 4);
+    static const int willNeed   = (1 << 5); // Starts readahead
+    static const int populate   = (1 << 6); // Faults in the mapping upfront
+  };
+
+  // [bytes = 0] maps the whole file and is set to its size
+  void* cpuMmapFile(const std::string &filename,
+                    uintptr_t &bytes,
+                    const int flags);
+
+  // Blocks until [bytes] starting at [offset] are written back
+  void cpuSyncMapped(void *ptr,
+                     const uintptr_t bytes,
+                     const uintptr_t offset);
+  //==================================
 };
 
 #endif
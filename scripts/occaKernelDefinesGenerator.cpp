@@ -20,16 +20,19 @@ inline std::string readFile(const std::string &filename){
 inline std::string saveFileToVariable(std::string filename,
                                       std::string varName,
                                       int &chars,
-                                      std::string indent = ""){
+                                      std::string indent = "",
+                                      const bool addDeviceDefines = true){
   std::stringstream occaDeviceDefines;
-  occaDeviceDefines << "#define OCCA_USING_CPU 0" << std::endl
-                    << "#define OCCA_USING_GPU 0" << std::endl
-                    << std::endl
-                    << "#define OCCA_USING_PTHREADS 0" << std::endl
-                    << "#define OCCA_USING_OPENMP   0" << std::endl
-                    << "#define OCCA_USING_OPENCL   0" << std::endl
-                    << "#define OCCA_USING_CUDA     0" << std::endl
-                    << "#define OCCA_USING_COI      0" << std::endl;
+
+  if(addDeviceDefines)
+    occaDeviceDefines << "#define OCCA_USING_CPU 0" << std::endl
+                      << "#define OCCA_USING_GPU 0" << std::endl
+                      << std::endl
+                      << "#define OCCA_USING_PTHREADS 0" << std::endl
+                      << "#define OCCA_USING_OPENMP   0" << std::endl
+                      << "#define OCCA_USING_OPENCL   0" << std::endl
+                      << "#define OCCA_USING_CUDA     0" << std::endl
+                      << "#define OCCA_USING_COI      0" << std::endl;
 
   std::string fileContents = occaDeviceDefines.str() + readFile(filename);
   chars = fileContents.size();
@@ -63,7 +66,7 @@ inline std::string saveFileToVariable(std::string filename,
 }
 
 int main(int argc, char **argv){
-  int mpChars, clChars, cuChars, ptChars, coiChars, coiMainChars;
+  int mpChars, clChars, cuChars, ptChars, cpuPrivChars, cpuVecChars, cpuHalfChars, cpuMathChars, coiChars, coiMainChars;
 
   if(argc != 2){
     std::cout << "Needs [OCCA_DIR] as the argument\n";
@@ -85,6 +88,34 @@ int main(int argc, char **argv){
                                       mpChars,
                                       "    ");
 
+  // Only added to CPU kernels that use occaPrivate
+  std::string cpuPriv = saveFileToVariable(occaDir + "/include/defines/occaCPUPrivateDefines.hpp",
+                                           "occaCPUPrivateDefines",
+                                           cpuPrivChars,
+                                           "    ",
+                                           false);
+
+  // Only added to CPU kernels that use float2, ..., double4
+  std::string cpuVec = saveFileToVariable(occaDir + "/include/defines/occaCPUVectorDefines.hpp",
+                                          "occaCPUVectorDefines",
+                                          cpuVecChars,
+                                          "    ",
+                                          false);
+
+  // Only added to CPU kernels that use half or bfloat16
+  std::string cpuHalf = saveFileToVariable(occaDir + "/include/defines/occaCPUHalfDefines.hpp",
+                                           "occaCPUHalfDefines",
+                                           cpuHalfChars,
+                                           "    ",
+                                           false);
+
+  // Only added to CPU kernels that use occaFast* or occaNative*
+  std::string cpuMath = saveFileToVariable(occaDir + "/include/defines/occaCPUFastMathDefines.hpp",
+                                           "occaCPUFastMathDefines",
+                                           cpuMathChars,
+                                           "    ",
+                                           false);
+
   std::string cl = saveFileToVariable(occaDir + "/include/defines/occaOpenCLDefines.hpp",
                                       "occaOpenCLDefines",
                                       clChars,
@@ -114,6 +145,10 @@ int main(int argc, char **argv){
   fs << ns << std::endl
      << "    extern char occaPthreadsDefines[" << ptChars << "];" << std::endl
      << "    extern char occaOpenMPDefines[" << mpChars  << "];"  << std::endl
+     << "    extern char occaCPUPrivateDefines[" << cpuPrivChars << "];" << std::endl
+     << "    extern char occaCPUVectorDefines[" << cpuVecChars << "];" << std::endl
+     << "    extern char occaCPUHalfDefines[" << cpuHalfChars << "];" << std::endl
+     << "    extern char occaCPUFastMathDefines[" << cpuMathChars << "];" << std::endl
      << "    extern char occaOpenCLDefines[" << clChars  << "];"  << std::endl
      << "    extern char occaCUDADefines["   << cuChars  << "];"  << std::endl
      << "    extern char occaCOIDefines["   << coiChars << "];"   << std::endl
@@ -127,6 +162,10 @@ int main(int argc, char **argv){
   fs << ns      << std::endl
      << pt      << std::endl
      << mp      << std::endl
+     << cpuPriv << std::endl
+     << cpuVec  << std::endl
+     << cpuHalf << std::endl
+     << cpuMath << std::endl
      << cl      << std::endl
      << cu      << std::endl
      << coi     << std::endl
@@ -102,6 +102,9 @@ def pthreadOperatorDefinition(N):
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -115,12 +118,21 @@ def pthreadOperatorDefinition(N):
 
       """ + '\n    '.join(['args->args[{0}] = arg{0};'.format(n) for n in xrange(N)]) + """
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel""" + str(N) + """);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel""" + str(N) + """);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -169,9 +181,20 @@ def ompOperatorDefinition(N):
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              """ + ',\n              '.join(['arg{0}.data()'.format(n) for n in xrange(N)]) + ');'
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      """ + ompKernelCall(N, '      ') + """
+    }
+    else{
+      """ + ompKernelCall(N, '      ') + """
+    }"""
+
+def ompKernelCall(N, indent):
+    return """tmpKernel(occaKernelArgs,
+""" + indent + """          occaInnerId0, occaInnerId1, occaInnerId2,
+""" + indent + """          """ + (',\n' + indent + '          ').join(['arg{0}.data()'.format(n) for n in xrange(N)]) + ');'
 
 def clOperatorDefinition(N):
     return """
@@ -183,13 +206,13 @@ def clOperatorDefinition(N):
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     """ + '\n\n    '.join(["""OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg{0}.size, arg{0}.data()));
+                  cl::setKernelArg(data_, argPos++, arg{0}.size, arg{0}.data()));
     if(arg{0}.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg{0}.arg2.void_));""".format(n) for n in xrange(N)]) + """
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg{0}.arg2.void_));""".format(n) for n in xrange(N)]) + """
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
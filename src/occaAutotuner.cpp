@@ -0,0 +1,350 @@
+#include "occaAutotuner.hpp"
+
+#include <fstream>
+#include <cstdio>
+
+namespace occa {
+  //---[ Autotuner ]------------------
+  autotuneSetup::autotuneSetup() :
+    dims(0),
+    timeTaken(-1) {}
+
+  autotuneSetup::autotuneSetup(const autotuneSetup &s) :
+    dims(s.dims),
+    inner(s.inner),
+    outer(s.outer),
+
+    defineNames(s.defineNames),
+    defineValues(s.defineValues),
+
+    timeTaken(s.timeTaken) {}
+
+  autotuneSetup& autotuneSetup::operator = (const autotuneSetup &s){
+    dims  = s.dims;
+    inner = s.inner;
+    outer = s.outer;
+
+    defineNames  = s.defineNames;
+    defineValues = s.defineValues;
+
+    timeTaken = s.timeTaken;
+
+    return *this;
+  }
+
+  kernelInfo autotuneSetup::getKernelInfo(const kernelInfo &baseInfo) const {
+    kernelInfo info = baseInfo;
+
+    const int defines = defineNames.size();
+
+    for(int i = 0; i < defines; ++i)
+      info.addDefine(defineNames[i], defineValues[i]);
+
+    return info;
+  }
+
+  // dims
+  // inner.x inner.y inner.z
+  // outer.x outer.y outer.z
+  // defines
+  // name value (one per line)
+  std::string autotuneSetup::toString() const {
+    std::stringstream ss;
+
+    ss << dims << '\n'
+       << inner.x << ' ' << inner.y << ' ' << inner.z << '\n'
+       << outer.x << ' ' << outer.y << ' ' << outer.z << '\n'
+       << defineNames.size() << '\n';
+
+    const int defines = defineNames.size();
+
+    for(int i = 0; i < defines; ++i)
+      ss << defineNames[i] << ' ' << defineValues[i] << '\n';
+
+    ss << timeTaken << '\n';
+
+    return ss.str();
+  }
+
+  bool autotuneSetup::load(const std::string &content){
+    std::stringstream ss(content);
+
+    int defines = 0;
+
+    ss >> dims
+       >> inner.x >> inner.y >> inner.z
+       >> outer.x >> outer.y >> outer.z
+       >> defines;
+
+    if(!ss || (dims < 0) || (3 < dims) || (defines < 0))
+      return false;
+
+    defineNames.resize(defines);
+    defineValues.resize(defines);
+
+    for(int i = 0; i < defines; ++i){
+      ss >> defineNames[i];
+      ss.get();
+      std::getline(ss, defineValues[i]);
+    }
+
+    ss >> timeTaken;
+
+    return !ss.fail();
+  }
+
+  std::ostream& operator << (std::ostream &out, const autotuneSetup &s){
+    if(s.dims){
+      out << "inner = [" << s.inner.x << ", " << s.inner.y << ", " << s.inner.z << "], "
+          << "outer = [" << s.outer.x << ", " << s.outer.y << ", " << s.outer.z << "]";
+
+      if(s.defineNames.size())
+        out << ", ";
+    }
+
+    const int defines = s.defineNames.size();
+
+    for(int i = 0; i < defines; ++i){
+      if(i)
+        out << ", ";
+
+      out << s.defineNames[i] << " = " << s.defineValues[i];
+    }
+
+    return out;
+  }
+
+  autotuner::autotuner(occa::device dev_,
+                       const std::string &filename_,
+                       const std::string &functionName_,
+                       const kernelInfo &info_) :
+    dev(dev_),
+
+    filename(filename_),
+    functionName(functionName_),
+    info(info_),
+
+    warmupRuns(2),
+    timedRuns(10),
+    verbose(true),
+
+    dims(0),
+
+    argumentCount(0) {}
+
+  void autotuner::setGlobalDims(const int dims_, const dim &globalDims_){
+    OCCA_CHECK((0 < dims_) && (dims_ <= 3));
+
+    dims       = dims_;
+    globalDims = globalDims_;
+  }
+
+  void autotuner::addInnerDims(const dim &inner){
+    innerDims.push_back(inner);
+  }
+
+  void autotuner::addDefineValue(const std::string &name, const std::string &value){
+    const int defines = defineNames.size();
+
+    for(int i = 0; i < defines; ++i){
+      if(defineNames[i] == name){
+        defineValues[i].push_back(value);
+        return;
+      }
+    }
+
+    defineNames.push_back(name);
+    defineValues.push_back(std::vector<std::string>(1, value));
+  }
+
+  void autotuner::addArgument(const int argPos, const kernelArg &arg){
+    OCCA_CHECK((0 <= argPos) && (argPos < OCCA_MAX_ARGS));
+
+    if(argumentCount < (argPos + 1))
+      argumentCount = (argPos + 1);
+
+    arguments[argPos] = arg;
+  }
+
+  std::string autotuner::getCacheFilename(){
+    std::stringstream salt;
+
+    salt << "autotuner"
+         << dev.mode()
+         << dev.getIdentifier().flattenFlagMap()
+         << functionName
+         << info.salt();
+
+    // Different search spaces are tuned separately
+    salt << dims << '|'
+         << globalDims.x << ' ' << globalDims.y << ' ' << globalDims.z << '|';
+
+    for(size_t i = 0; i < innerDims.size(); ++i)
+      salt << innerDims[i].x << ' ' << innerDims[i].y << ' ' << innerDims[i].z << '|';
+
+    for(size_t i = 0; i < defineNames.size(); ++i){
+      salt << defineNames[i];
+
+      for(size_t j = 0; j < defineValues[i].size(); ++j)
+        salt << '|' << defineValues[i][j];
+    }
+
+    return getMidCachedBinaryName(getCachedName(filename, salt.str()), "t");
+  }
+
+  bool autotuner::loadFromCache(){
+    const std::string cachedSetup = getCacheFilename();
+
+    if(!fileExists(cachedSetup))
+      return false;
+
+    autotuneSetup setup;
+
+    if(!setup.load(readFile(cachedSetup)))
+      return false;
+
+    best = setup;
+
+    return true;
+  }
+
+  void autotuner::saveToCache(){
+    const std::string cachedSetup = getCacheFilename();
+    const std::string tmpSetup    = cachedSetup + ".tmp";
+
+    if(!haveFile(cachedSetup)){
+      waitForFile(cachedSetup);
+      return;
+    }
+
+    std::ofstream fs;
+    fs.open(tmpSetup.c_str());
+
+    fs << best.toString();
+
+    fs.close();
+
+    // Readers never see a partially written setup
+    ::rename(tmpSetup.c_str(), cachedSetup.c_str());
+
+    releaseFile(cachedSetup);
+  }
+
+  int autotuner::setupCount(){
+    int count = (innerDims.size() ? innerDims.size() : 1);
+
+    const int defines = defineNames.size();
+
+    for(int i = 0; i < defines; ++i)
+      count *= defineValues[i].size();
+
+    return count;
+  }
+
+  autotuneSetup autotuner::getSetup(const int id){
+    autotuneSetup setup;
+
+    int id_ = id;
+
+    const int defines = defineNames.size();
+
+    for(int i = 0; i < defines; ++i){
+      const int valueCount = defineValues[i].size();
+
+      setup.defineNames.push_back(defineNames[i]);
+      setup.defineValues.push_back(defineValues[i][id_ % valueCount]);
+
+      id_ /= valueCount;
+    }
+
+    if(innerDims.size()){
+      setup.dims  = dims;
+      setup.inner = innerDims[id_];
+
+      for(int i = 0; i < 3; ++i){
+        if(i < dims){
+          const uintptr_t innerDim = (setup.inner[i] ? setup.inner[i] : 1);
+
+          setup.outer[i] = ((globalDims[i] + innerDim - 1) / innerDim);
+        }
+        else
+          setup.outer[i] = setup.inner[i] = 1;
+      }
+    }
+
+    return setup;
+  }
+
+  double autotuner::benchmark(kernel &k){
+    k.clearArgumentList();
+
+    for(int i = 0; i < argumentCount; ++i)
+      k.addArgument(i, arguments[i]);
+
+    for(int i = 0; i < warmupRuns; ++i)
+      k.runFromArguments();
+
+    dev.finish();
+
+    const double start = currentTime();
+
+    for(int i = 0; i < timedRuns; ++i)
+      k.runFromArguments();
+
+    dev.finish();
+
+    return ((currentTime() - start) / (timedRuns ? timedRuns : 1));
+  }
+
+  void autotuner::tune(){
+    OCCA_CHECK((innerDims.size() == 0) || (0 < dims));
+
+    const int setups = setupCount();
+
+    best = autotuneSetup();
+
+    for(int i = 0; i < setups; ++i){
+      autotuneSetup setup = getSetup(i);
+
+      kernel k = dev.buildKernelFromSource(filename,
+                                           functionName,
+                                           setup.getKernelInfo(info));
+
+      if(setup.dims)
+        k.setWorkingDims(setup.dims, setup.inner, setup.outer);
+
+      setup.timeTaken = benchmark(k);
+
+      k.free();
+
+      if(verbose)
+        std::cout << "[Autotuner] " << functionName << " (" << setup << "): "
+                  << (1.0e3 * setup.timeTaken) << " ms\n";
+
+      if((best.timeTaken < 0) ||
+         (setup.timeTaken < best.timeTaken)){
+
+        best = setup;
+      }
+    }
+
+    saveToCache();
+  }
+
+  kernel autotuner::build(){
+    if(!loadFromCache())
+      tune();
+    else if(verbose)
+      std::cout << "[Autotuner] " << functionName << " (" << best << "): cached\n";
+
+    kernel k = dev.buildKernelFromSource(filename,
+                                         functionName,
+                                         best.getKernelInfo(info));
+
+    if(best.dims)
+      k.setWorkingDims(best.dims, best.inner, best.outer);
+
+    return k;
+  }
+  //==================================
+};
@@ -1,4 +1,5 @@
 #include "occa.hpp"
+#include "occaOpenMP.hpp"
 
 // Use events for timing!
 
@@ -20,10 +21,11 @@ namespace occa {
   const int int32FormatIndex  = 5;
   const int halfFormatIndex   = 6;
   const int floatFormatIndex  = 7;
+  const int bfloat16FormatIndex = 8;
 
-  const int sizeOfFormats[8] = {1, 2, 4,
+  const int sizeOfFormats[9] = {1, 2, 4,
                                 1, 2, 4,
-                                2, 4};
+                                2, 4, 2};
 
   formatType::formatType(const int format__, const int count__){
     format_ = format__;
@@ -42,6 +44,10 @@ namespace occa {
     return *this;
   }
 
+  int formatType::formatIndex() const {
+    return format_;
+  }
+
   int formatType::count() const {
     return count_;
   }
@@ -85,6 +91,10 @@ namespace occa {
   const occa::formatType floatx2Format(floatFormatIndex, 2);
   const occa::formatType floatx4Format(floatFormatIndex, 4);
 
+  const occa::formatType bfloat16Format(bfloat16FormatIndex  , 1);
+  const occa::formatType bfloat16x2Format(bfloat16FormatIndex, 2);
+  const occa::formatType bfloat16x4Format(bfloat16FormatIndex, 4);
+
   //---[ Device :: Arg Info ]-
   argInfo::argInfo() :
     info(""),
@@ -117,13 +127,21 @@ namespace occa {
     mode_(),
     strMode(""),
 
-    kHandle(NULL) {}
+    kHandle(NULL),
+
+    argumentCount(0) {}
 
   kernel::kernel(const kernel &k) :
     mode_(k.mode_),
     strMode(k.strMode),
 
-    kHandle(k.kHandle) {}
+    kHandle(k.kHandle),
+
+    argumentCount(k.argumentCount) {
+
+    for(int i = 0; i < argumentCount; ++i)
+      arguments[i] = k.arguments[i];
+  }
 
   kernel& kernel::operator = (const kernel &k){
     mode_   = k.mode_;
@@ -131,6 +149,11 @@ namespace occa {
 
     kHandle = k.kHandle;
 
+    argumentCount = k.argumentCount;
+
+    for(int i = 0; i < argumentCount; ++i)
+      arguments[i] = k.arguments[i];
+
     return *this;
   }
 
@@ -375,6 +398,57 @@ namespace occa {
     mHandle->copyTo(dest.mHandle, bytes, destOffset, srcOffset);
   }
 
+  // Converted in place through map(), zero-copy in CPU modes
+  void memory::copyFrom(const float *source,
+                        const occa::formatType &format,
+                        const uintptr_t entries,
+                        const uintptr_t offset){
+    const int formatIndex = format.formatIndex();
+
+    OCCA_CHECK((formatIndex == halfFormatIndex) ||
+               (formatIndex == bfloat16FormatIndex));
+    OCCA_CHECK(offset <= mHandle->size);
+
+    const uintptr_t entries_ = (entries == 0) ? ((mHandle->size - offset) / 2) : entries;
+
+    if(entries_ == 0)
+      return;
+
+    uint16_t *ptr = (uint16_t*) map(2*entries_, offset);
+
+    if(formatIndex == halfFormatIndex)
+      floatToHalf(source, ptr, entries_);
+    else
+      floatToBfloat16(source, ptr, entries_);
+
+    unmap();
+  }
+
+  void memory::copyTo(float *dest,
+                      const occa::formatType &format,
+                      const uintptr_t entries,
+                      const uintptr_t offset){
+    const int formatIndex = format.formatIndex();
+
+    OCCA_CHECK((formatIndex == halfFormatIndex) ||
+               (formatIndex == bfloat16FormatIndex));
+    OCCA_CHECK(offset <= mHandle->size);
+
+    const uintptr_t entries_ = (entries == 0) ? ((mHandle->size - offset) / 2) : entries;
+
+    if(entries_ == 0)
+      return;
+
+    const uint16_t *ptr = (const uint16_t*) map(2*entries_, offset);
+
+    if(formatIndex == halfFormatIndex)
+      halfToFloat(ptr, dest, entries_);
+    else
+      bfloat16ToFloat(ptr, dest, entries_);
+
+    unmap();
+  }
+
   void memory::asyncCopyFrom(const void *source,
                              const uintptr_t bytes,
                              const uintptr_t offset){
@@ -401,6 +475,196 @@ namespace occa {
     mHandle->asyncCopyTo(dest.mHandle, bytes, destOffset, srcOffset);
   }
 
+  // Fills in packed pitches and checks both layouts, [bytes] of 0 skips
+  //   the bounds check for host pointers. Returns false if [region] is empty
+  static bool setupRects(const occa::dim &region,
+                         const occa::rect &destRect,
+                         const occa::rect &srcRect,
+                         const uintptr_t destBytes,
+                         const uintptr_t srcBytes,
+                         occa::rect &dest,
+                         occa::rect &src){
+    if((region.x == 0) ||
+       (region.y == 0) ||
+       (region.z == 0)){
+
+      return false;
+    }
+
+    dest = destRect;
+    src  = srcRect;
+
+    occa::rect *rects[2] = {&dest, &src};
+    const uintptr_t bytes[2] = {destBytes, srcBytes};
+
+    for(int i = 0; i < 2; ++i){
+      occa::rect &r = *(rects[i]);
+
+      if(r.rowPitch == 0)
+        r.rowPitch = region.x;
+
+      if(r.slicePitch == 0)
+        r.slicePitch = r.rowPitch * region.y;
+
+      // Same rules as clEnqueueCopyBufferRect
+      OCCA_CHECK(region.x <= r.rowPitch);
+      OCCA_CHECK((r.rowPitch * region.y) <= r.slicePitch);
+
+      if(bytes[i])
+        OCCA_CHECK(r.end(region) <= bytes[i]);
+    }
+
+    return true;
+  }
+
+  void memory::copyRectFrom(const void *source,
+                            const occa::dim &region,
+                            const occa::rect &destRect,
+                            const occa::rect &srcRect){
+    occa::rect dest, src;
+
+    OCCA_CHECK(mHandle->isTexture == false);
+
+    if(setupRects(region, destRect, srcRect, mHandle->size, 0, dest, src))
+      mHandle->copyRectFrom(source, region, dest, src);
+  }
+
+  void memory::copyRectFrom(const memory &source,
+                            const occa::dim &region,
+                            const occa::rect &destRect,
+                            const occa::rect &srcRect){
+    occa::rect dest, src;
+
+    OCCA_CHECK(mHandle->isTexture == false);
+    OCCA_CHECK(source.mHandle->isTexture == false);
+
+    if(setupRects(region, destRect, srcRect, mHandle->size, source.mHandle->size, dest, src))
+      mHandle->copyRectFrom(source.mHandle, region, dest, src);
+  }
+
+  void memory::copyRectTo(void *dest,
+                          const occa::dim &region,
+                          const occa::rect &destRect,
+                          const occa::rect &srcRect){
+    occa::rect dest_, src;
+
+    OCCA_CHECK(mHandle->isTexture == false);
+
+    if(setupRects(region, destRect, srcRect, 0, mHandle->size, dest_, src))
+      mHandle->copyRectTo(dest, region, dest_, src);
+  }
+
+  void memory::copyRectTo(memory &dest,
+                          const occa::dim &region,
+                          const occa::rect &destRect,
+                          const occa::rect &srcRect){
+    dest.copyRectFrom(*this, region, destRect, srcRect);
+  }
+
+  void memory::asyncCopyRectFrom(const void *source,
+                                 const occa::dim &region,
+                                 const occa::rect &destRect,
+                                 const occa::rect &srcRect){
+    occa::rect dest, src;
+
+    OCCA_CHECK(mHandle->isTexture == false);
+
+    if(setupRects(region, destRect, srcRect, mHandle->size, 0, dest, src))
+      mHandle->asyncCopyRectFrom(source, region, dest, src);
+  }
+
+  void memory::asyncCopyRectFrom(const memory &source,
+                                 const occa::dim &region,
+                                 const occa::rect &destRect,
+                                 const occa::rect &srcRect){
+    occa::rect dest, src;
+
+    OCCA_CHECK(mHandle->isTexture == false);
+    OCCA_CHECK(source.mHandle->isTexture == false);
+
+    if(setupRects(region, destRect, srcRect, mHandle->size, source.mHandle->size, dest, src))
+      mHandle->asyncCopyRectFrom(source.mHandle, region, dest, src);
+  }
+
+  void memory::asyncCopyRectTo(void *dest,
+                               const occa::dim &region,
+                               const occa::rect &destRect,
+                               const occa::rect &srcRect){
+    occa::rect dest_, src;
+
+    OCCA_CHECK(mHandle->isTexture == false);
+
+    if(setupRects(region, destRect, srcRect, 0, mHandle->size, dest_, src))
+      mHandle->asyncCopyRectTo(dest, region, dest_, src);
+  }
+
+  void memory::asyncCopyRectTo(memory &dest,
+                               const occa::dim &region,
+                               const occa::rect &destRect,
+                               const occa::rect &srcRect){
+    dest.asyncCopyRectFrom(*this, region, destRect, srcRect);
+  }
+
+  // Forking a team costs a few microseconds, small halos are copied
+  //   by the calling thread
+  static const uintptr_t cpuCopyRectMinThreadedBytes = (256 << 10);
+  static const uintptr_t cpuCopyRectChunkBytes       = (64 << 10);
+
+  void cpuCopyRect(void *dest,
+                   const void *src,
+                   const occa::dim &region,
+                   const occa::rect &destRect,
+                   const occa::rect &srcRect,
+                   const int part,
+                   const int parts){
+    const uintptr_t chunkBytes = cpuCopyRectChunkBytes;
+
+    char *destPtr      = ((char*) dest)       + destRect.offset();
+    const char *srcPtr = ((const char*) src) + srcRect.offset();
+
+    uintptr_t rowBytes = region.x;
+    uintptr_t rows     = region.y;
+    uintptr_t slices   = region.z;
+
+    const uintptr_t destRowPitch = destRect.rowPitch, destSlicePitch = destRect.slicePitch;
+    const uintptr_t srcRowPitch  = srcRect.rowPitch , srcSlicePitch  = srcRect.slicePitch;
+
+    // Packed rows and slices turn into longer rows
+    if((destRowPitch == rowBytes) && (srcRowPitch == rowBytes)){
+      rowBytes *= rows;
+      rows      = 1;
+
+      if((destSlicePitch == rowBytes) && (srcSlicePitch == rowBytes)){
+        rowBytes *= slices;
+        slices    = 1;
+      }
+    }
+
+    // Long rows are split so packed copies still use every thread
+    const uintptr_t chunks = ((rowBytes + chunkBytes - 1) / chunkBytes);
+    const uintptr_t work   = (rows * slices * chunks);
+
+    const uintptr_t wStart = ((work * part)       / parts);
+    const uintptr_t wEnd   = ((work * (part + 1)) / parts);
+
+    for(uintptr_t w = wStart; w < wEnd; ++w){
+      const uintptr_t line  = (w / chunks);
+      const uintptr_t start = (w % chunks) * chunkBytes;
+      const uintptr_t bytes = std::min(chunkBytes, rowBytes - start);
+
+      const uintptr_t row   = (line % rows);
+      const uintptr_t slice = (line / rows);
+
+      ::memcpy(destPtr + row*destRowPitch + slice*destSlicePitch + start,
+               srcPtr  + row*srcRowPitch  + slice*srcSlicePitch  + start,
+               bytes);
+    }
+  }
+
+  bool cpuCopyRectIsLarge(const occa::dim &region){
+    return (cpuCopyRectMinThreadedBytes <= (region.x * region.y * region.z));
+  }
+
   void memcpy(memory &dest,
               const void *source,
               const uintptr_t bytes,
@@ -461,6 +725,90 @@ namespace occa {
     source.asyncCopyTo(dest, bytes, destOffset, srcOffset);
   }
 
+  memory memory::slice(const uintptr_t offset,
+                       const uintptr_t bytes){
+    OCCA_CHECK(mHandle->isTexture == false);
+    OCCA_CHECK(offset <= mHandle->size);
+
+    const uintptr_t bytes_ = (bytes == 0) ? (mHandle->size - offset) : bytes;
+
+    OCCA_CHECK((bytes_ + offset) <= mHandle->size);
+
+    // Slices of slices view the original allocation
+    memory_v *root = (mHandle->parent ? mHandle->parent : mHandle);
+    const uintptr_t rootOffset = mHandle->parentOffset + offset;
+
+    memory m;
+
+    m.mode_   = mode_;
+    m.strMode = strMode;
+
+    m.mHandle = root->slice(rootOffset, bytes_);
+
+    m.mHandle->parent       = root;
+    m.mHandle->parentOffset = rootOffset;
+
+    ++(root->sliceRefs);
+
+    return m;
+  }
+
+  uintptr_t memory::signalPeers(){
+    OCCA_CHECK(isShared());
+
+    mHandle->dev->finish();
+
+    return cpuSignalShared(mHandle->handle, mHandle->mappedBytes);
+  }
+
+  void memory::waitForPeers(const uintptr_t value){
+    OCCA_CHECK(isShared());
+
+    cpuWaitForShared(mHandle->handle, mHandle->mappedBytes, value);
+  }
+
+  void memory::sync(const uintptr_t bytes,
+                    const uintptr_t offset){
+    const uintptr_t bytes_ = (bytes == 0) ? (mHandle->size - offset) : bytes;
+
+    OCCA_CHECK((bytes_ + offset) <= mHandle->size);
+
+    mHandle->dev->finish();
+
+    // Slices of a mapped file share its pages
+    memory_v *root = (mHandle->parent ? mHandle->parent : mHandle);
+
+    if(root->mappedBytes)
+      cpuSyncMapped(mHandle->handle, bytes_, offset);
+  }
+
+  void* memory::map(const uintptr_t bytes,
+                    const uintptr_t offset){
+    OCCA_CHECK(mHandle->isTexture == false);
+    OCCA_CHECK(mHandle->mapPtr == NULL);
+    OCCA_CHECK(offset <= mHandle->size);
+
+    const uintptr_t bytes_ = (bytes == 0) ? (mHandle->size - offset) : bytes;
+
+    OCCA_CHECK((bytes_ + offset) <= mHandle->size);
+
+    mHandle->mapPtr    = mHandle->map(bytes_, offset);
+    mHandle->mapBytes  = bytes_;
+    mHandle->mapOffset = offset;
+
+    return mHandle->mapPtr;
+  }
+
+  void memory::unmap(){
+    OCCA_CHECK(mHandle->mapPtr != NULL);
+
+    mHandle->unmap();
+
+    mHandle->mapPtr    = NULL;
+    mHandle->mapBytes  = 0;
+    mHandle->mapOffset = 0;
+  }
+
   void memory::swap(memory &m){
     occa::mode mode2 = m.mode_;
     m.mode_        = mode_;
@@ -476,8 +824,29 @@ namespace occa {
   }
 
   void memory::free(){
+    if(mHandle->mapPtr != NULL)
+      unmap();
+
+    memory_v *root = mHandle->parent;
+
+    if(root == NULL){
+      if(mHandle->sliceRefs){
+        mHandle->freePending = true;
+        return;
+      }
+
+      mHandle->free();
+      delete mHandle;
+      return;
+    }
+
     mHandle->free();
     delete mHandle;
+
+    if((--(root->sliceRefs) == 0) && root->freePending){
+      root->free();
+      delete root;
+    }
   }
   //==================================
 
@@ -763,6 +1132,10 @@ namespace occa {
     dHandle->waitFor(tag_);
   }
 
+  void device::streamWaitFor(tag tag_){
+    dHandle->streamWaitFor(tag_);
+  }
+
   stream device::createStream(){
     streams.push_back( dHandle->createStream() );
     return streams.back();
@@ -788,6 +1161,10 @@ namespace occa {
     return dHandle->timeBetween(startTag, endTag);
   }
 
+  void device::freeTag(tag tag_){
+    dHandle->freeTag(tag_);
+  }
+
   void device::free(stream s){
     dHandle->freeStream(s);
   }
@@ -805,11 +1182,23 @@ namespace occa {
     kernel_v *&k = ker.kHandle;
 
     if(usingParser){
-      k               = new kernel_t<OpenMP>;
-      k->dev          = new device;
-      k->dev->dHandle = new device_t<OpenMP>();
+      k = new kernel_t<OpenMP>;
+
+      // OpenMP launchers use the device's thread team
+      if(mode_ == OpenMP)
+        k->dev = this;
+      else{
+        k->dev          = new device;
+        k->dev->dHandle = new device_t<OpenMP>();
+      }
+
+      // OpenMP nested kernels run inside the launcher's parallel region
+      kernelInfo nestedInfo = info_;
 
-      kernelInfo info = info_;
+      if(mode_ == OpenMP)
+        nestedInfo.addDefine("OCCA_USING_OPENMP_REGION", 1);
+
+      kernelInfo info = nestedInfo;
 
       std::string cachedBinary = k->getCachedBinaryName(filename, info);
 
@@ -826,13 +1215,21 @@ namespace occa {
         k->buildFromBinary(cachedBinary, functionName);
       }
       else
-        k->buildFromSource(filename, functionName, info_);
+        k->buildFromSource(filename, functionName, nestedInfo);
+
+      // kernel_t<OpenMP> opens the team the launcher runs in
+      if(mode_ == OpenMP)
+        ((OpenMPKernelData_t*) k->data)->usesRegion = kInfo.usesRegion;
 
       k->nestedKernelCount = kInfo.nestedKernels;
 
       std::stringstream ss;
       k->nestedKernels = new kernel[kInfo.nestedKernels];
 
+      // Nested kernels share one binary, the rest are loaded from the first.
+      //   OpenMP devices compiled it with the launcher
+      kernel_v *binaryKernel = ((mode_ == OpenMP) ? k : NULL);
+
       for(int ki = 0; ki < kInfo.nestedKernels; ++ki){
         ss << ki;
 
@@ -841,9 +1238,15 @@ namespace occa {
         sKer.mode_   = mode_;
         sKer.strMode = strMode;
 
-        sKer.kHandle = dHandle->buildKernelFromSource(filename,
-                                                      kInfo.baseName + ss.str(),
-                                                      info_);
+        if(binaryKernel == NULL){
+          sKer.kHandle = dHandle->buildKernelFromSource(filename,
+                                                        kInfo.baseName + ss.str(),
+                                                        nestedInfo);
+
+          binaryKernel = sKer.kHandle;
+        }
+        else
+          sKer.kHandle = binaryKernel->buildSibling(kInfo.baseName + ss.str());
 
         ss.str("");
       }
@@ -856,6 +1259,28 @@ namespace occa {
     return ker;
   }
 
+  kernel device::buildKernelFromString(const std::string &content,
+                                       const std::string &functionName,
+                                       const kernelInfo &info_,
+                                       const int language){
+    std::string extension;
+
+    if(language & usingOKL)
+      extension = "okl";
+    else if(language & usingOFL)
+      extension = "ofl";
+    else
+      extension = "occa";
+
+    const std::string filename = setStringSource(content, extension);
+
+    kernel ker = buildKernelFromSource(filename, functionName, info_);
+
+    releaseStringSource(filename);
+
+    return ker;
+  }
+
   kernel device::buildKernelFromBinary(const std::string &filename,
                                        const std::string &functionName){
     kernel ker;
@@ -958,6 +1383,19 @@ namespace occa {
     return mem;
   }
 
+  memory device::wrapHostMemory(void *ptr,
+                                const uintptr_t bytes){
+    memory mem;
+
+    mem.mode_   = mode_;
+    mem.strMode = strMode;
+
+    mem.mHandle = dHandle->wrapHostMemory(ptr, bytes);
+    mem.mHandle->dev = this;
+
+    return mem;
+  }
+
   memory device::wrapTexture(void *handle_,
                              const int dim, const occa::dim &dims,
                              occa::formatType type, const int permissions){
@@ -980,18 +1418,75 @@ namespace occa {
   }
 
   memory device::malloc(const uintptr_t bytes,
-                        void *source){
+                        void *source,
+                        const int pages){
     memory mem;
 
     mem.mode_   = mode_;
     mem.strMode = strMode;
 
-    mem.mHandle      = dHandle->malloc(bytes, source);
+    mem.mHandle      = dHandle->malloc(bytes, source, pages);
     mem.mHandle->dev = this;
 
     return mem;
   }
 
+  static void checkCPUMode(const occa::mode mode_, const std::string &feature){
+    if((mode_ != OpenMP) && (mode_ != Pthreads)){
+      std::cout << feature << " is only supported in OpenMP and Pthreads modes\n";
+      throw 1;
+    }
+  }
+
+  memory device::mallocShared(const std::string &name,
+                              const uintptr_t bytes,
+                              void *source){
+    checkCPUMode(mode_, "Shared memory");
+
+    uintptr_t mappedBytes;
+    void *ptr = cpuMallocShared(name, bytes, mappedBytes);
+
+    if(source != NULL)
+      ::memcpy(ptr, source, bytes);
+
+    memory mem = wrapMemory(ptr, bytes);
+
+    mem.mHandle->mappedBytes    = mappedBytes;
+    mem.mHandle->sharedName     = name;
+    mem.mHandle->ownsSharedName = true;
+
+    return mem;
+  }
+
+  memory device::wrapSharedMemory(const std::string &name){
+    checkCPUMode(mode_, "Shared memory");
+
+    uintptr_t bytes, mappedBytes;
+    void *ptr = cpuOpenShared(name, bytes, mappedBytes);
+
+    memory mem = wrapMemory(ptr, bytes);
+
+    mem.mHandle->mappedBytes = mappedBytes;
+    mem.mHandle->sharedName  = name;
+
+    return mem;
+  }
+
+  memory device::mmapFile(const std::string &filename,
+                          const uintptr_t bytes,
+                          const int flags){
+    checkCPUMode(mode_, "Mapping files");
+
+    uintptr_t bytes_ = bytes;
+    void *ptr = cpuMmapFile(filename, bytes_, flags);
+
+    memory mem = wrapMemory(ptr, bytes_);
+
+    mem.mHandle->mappedBytes = bytes_;
+
+    return mem;
+  }
+
   memory device::talloc(const int dim, const occa::dim &dims,
                         void *source,
                         occa::formatType type, const int permissions){
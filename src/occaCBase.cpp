@@ -29,6 +29,10 @@ extern "C" {
   const uintptr_t occaAutoSize = 0;
   const uintptr_t occaNoOffset = 0;
 
+  const int occaUsingOKL    = occa::usingOKL;
+  const int occaUsingOFL    = occa::usingOFL;
+  const int occaUsingNative = occa::usingNative;
+
   const uintptr_t occaTypeSize[OCCA_TYPE_COUNT] = {
     sizeof(void*),
     sizeof(int),
@@ -198,6 +202,33 @@ extern "C" {
     return (occaKernel) kernel;
   }
 
+  occaKernel LIBOCCA_CALLINGCONV occaBuildKernelFromString(occaDevice device,
+                                                            const char *str,
+                                                            const char *functionName,
+                                                            occaKernelInfo info,
+                                                            const int language){
+    occa::device &device_  = *((occa::device*) device);
+
+    occa::kernel *kernel = new occa::kernel();
+
+    if(info != occaNoKernelInfo){
+      occa::kernelInfo &info_ = *((occa::kernelInfo*) info);
+
+      *kernel = device_.buildKernelFromString(str,
+                                              functionName,
+                                              info_,
+                                              language);
+    }
+    else{
+      *kernel = device_.buildKernelFromString(str,
+                                              functionName,
+                                              occa::defaultKernelInfo,
+                                              language);
+    }
+
+    return (occaKernel) kernel;
+  }
+
   occaKernel LIBOCCA_CALLINGCONV occaBuildKernelFromBinary(occaDevice device,
                                                             const char *filename,
                                                             const char *functionName){
@@ -309,6 +340,16 @@ extern "C" {
     return device_.timeBetween(startTag_, endTag_);
   }
 
+  void LIBOCCA_CALLINGCONV occaDeviceFreeTag(occaDevice device, occaTag tag){
+    occa::device &device_ = *((occa::device*) device);
+
+    occa::tag tag_;
+
+    ::memcpy(&tag_, &tag, sizeof(tag_));
+
+    device_.freeTag(tag_);
+  }
+
   void LIBOCCA_CALLINGCONV occaDeviceStreamFree(occaDevice device, occaStream stream){
     occa::device &device_ = *((occa::device*) device);
     occa::stream &stream_ = *((occa::stream*) stream);
@@ -5,6 +5,7 @@
 #endif
 
 #include "occaCOI.hpp"
+#include "occaGraph.hpp"
 
 namespace occa {
   //---[ Helper Functions ]-----------
@@ -365,6 +366,31 @@ namespace occa {
     return buildFromBinary(cache, functionName_);
   }
 
+  template <>
+  kernel_t<COI>* kernel_t<COI>::buildSibling(const std::string &functionName_){
+    OCCA_EXTRACT_DATA(COI, Kernel);
+
+    kernel_t<COI> *k = new kernel_t<COI>;
+
+    k->dev          = dev;
+    k->functionName = functionName_;
+
+    COIKernelData_t *kData = new COIKernelData_t;
+    k->data = kData;
+
+    kData->chiefID = data_.chiefID;
+
+    const char *c_functionName = functionName_.c_str();
+
+    OCCA_COI_CHECK("Kernel: Getting Handle",
+                   COIProcessGetFunctionHandles(kData->chiefID,
+                                                1,
+                                                &c_functionName,
+                                                &(kData->kernel)));
+
+    return k;
+  }
+
   // [-] Missing
   template <>
   int kernel_t<COI>::preferredDimSize(){
@@ -409,7 +435,23 @@ namespace occa {
     textureInfo.dim = 1;
     textureInfo.w = textureInfo.h = textureInfo.d = 0;
 
-    isAWrapper = false;
+    isAWrapper   = false;
+    wrapsHostPtr = false;
+
+    pageBytes   = 0;
+    mappedBytes = 0;
+
+    parent       = NULL;
+    parentOffset = 0;
+
+    sliceRefs   = 0;
+    freePending = false;
+
+    ownsSharedName = false;
+
+    mapPtr    = NULL;
+    mapBytes  = 0;
+    mapOffset = 0;
   }
 
   template <>
@@ -426,7 +468,24 @@ namespace occa {
     textureInfo.h = m.textureInfo.h;
     textureInfo.d = m.textureInfo.d;
 
-    isAWrapper = m.isAWrapper;
+    isAWrapper   = m.isAWrapper;
+    wrapsHostPtr = m.wrapsHostPtr;
+
+    pageBytes   = m.pageBytes;
+    mappedBytes = m.mappedBytes;
+
+    parent       = m.parent;
+    parentOffset = m.parentOffset;
+
+    sliceRefs   = m.sliceRefs;
+    freePending = m.freePending;
+
+    sharedName     = m.sharedName;
+    ownsSharedName = m.ownsSharedName;
+
+    mapPtr    = m.mapPtr;
+    mapBytes  = m.mapBytes;
+    mapOffset = m.mapOffset;
   }
 
   template <>
@@ -443,7 +502,24 @@ namespace occa {
     textureInfo.h = m.textureInfo.h;
     textureInfo.d = m.textureInfo.d;
 
-    isAWrapper = m.isAWrapper;
+    isAWrapper   = m.isAWrapper;
+    wrapsHostPtr = m.wrapsHostPtr;
+
+    pageBytes   = m.pageBytes;
+    mappedBytes = m.mappedBytes;
+
+    parent       = m.parent;
+    parentOffset = m.parentOffset;
+
+    sliceRefs   = m.sliceRefs;
+    freePending = m.freePending;
+
+    sharedName     = m.sharedName;
+    ownsSharedName = m.ownsSharedName;
+
+    mapPtr    = m.mapPtr;
+    mapBytes  = m.mapBytes;
+    mapOffset = m.mapOffset;
 
     return *this;
   }
@@ -681,6 +757,115 @@ namespace occa {
                                  &(stream.lastEvent)));
   }
 
+  // COI transfers are linear, rects are copied one row at a time
+  template <>
+  void memory_t<COI>::copyRectFrom(const void *source,
+                                   const occa::dim &region,
+                                   const occa::rect &destRect,
+                                   const occa::rect &srcRect){
+    asyncCopyRectFrom(source, region, destRect, srcRect);
+
+    dev->finish();
+  }
+
+  template <>
+  void memory_t<COI>::copyRectFrom(const memory_v *source,
+                                   const occa::dim &region,
+                                   const occa::rect &destRect,
+                                   const occa::rect &srcRect){
+    asyncCopyRectFrom(source, region, destRect, srcRect);
+
+    dev->finish();
+  }
+
+  template <>
+  void memory_t<COI>::copyRectTo(void *dest,
+                                 const occa::dim &region,
+                                 const occa::rect &destRect,
+                                 const occa::rect &srcRect){
+    asyncCopyRectTo(dest, region, destRect, srcRect);
+
+    dev->finish();
+  }
+
+  template <>
+  void memory_t<COI>::asyncCopyRectFrom(const void *source,
+                                        const occa::dim &region,
+                                        const occa::rect &destRect,
+                                        const occa::rect &srcRect){
+    for(uintptr_t z = 0; z < region.z; ++z){
+      for(uintptr_t y = 0; y < region.y; ++y){
+        const uintptr_t destOffset = destRect.offset() + y*destRect.rowPitch + z*destRect.slicePitch;
+        const uintptr_t srcOffset  = srcRect.offset()  + y*srcRect.rowPitch  + z*srcRect.slicePitch;
+
+        asyncCopyFrom(((const char*) source) + srcOffset,
+                      region.x,
+                      destOffset);
+      }
+    }
+  }
+
+  template <>
+  void memory_t<COI>::asyncCopyRectFrom(const memory_v *source,
+                                        const occa::dim &region,
+                                        const occa::rect &destRect,
+                                        const occa::rect &srcRect){
+    for(uintptr_t z = 0; z < region.z; ++z){
+      for(uintptr_t y = 0; y < region.y; ++y){
+        const uintptr_t destOffset = destRect.offset() + y*destRect.rowPitch + z*destRect.slicePitch;
+        const uintptr_t srcOffset  = srcRect.offset()  + y*srcRect.rowPitch  + z*srcRect.slicePitch;
+
+        asyncCopyFrom(source,
+                      region.x,
+                      destOffset, srcOffset);
+      }
+    }
+  }
+
+  template <>
+  void memory_t<COI>::asyncCopyRectTo(void *dest,
+                                      const occa::dim &region,
+                                      const occa::rect &destRect,
+                                      const occa::rect &srcRect){
+    for(uintptr_t z = 0; z < region.z; ++z){
+      for(uintptr_t y = 0; y < region.y; ++y){
+        const uintptr_t destOffset = destRect.offset() + y*destRect.rowPitch + z*destRect.slicePitch;
+        const uintptr_t srcOffset  = srcRect.offset()  + y*srcRect.rowPitch  + z*srcRect.slicePitch;
+
+        asyncCopyTo(((char*) dest) + destOffset,
+                    region.x,
+                    srcOffset);
+      }
+    }
+  }
+
+  template <>
+  memory_v* memory_t<COI>::slice(const uintptr_t offset,
+                                 const uintptr_t bytes){
+    std::cout << "COI buffers can't be sliced, copy the range into a new buffer instead\n";
+    throw 1;
+
+    return NULL;
+  }
+
+  template <>
+  void* memory_t<COI>::map(const uintptr_t bytes,
+                           const uintptr_t offset){
+    // Staged through host memory, copied back in unmap()
+    char *ptr = new char[bytes];
+
+    copyTo(ptr, bytes, offset);
+
+    return ptr;
+  }
+
+  template <>
+  void memory_t<COI>::unmap(){
+    copyFrom(mapPtr, mapBytes, mapOffset);
+
+    delete [] (char*) mapPtr;
+  }
+
   template <>
   void memory_t<COI>::free(){
     OCCA_COI_CHECK("Memory: free",
@@ -856,6 +1041,11 @@ namespace occa {
     finish(); // [-] Not done
   }
 
+  template <>
+  void device_t<COI>::streamWaitFor(tag tag_){
+    finish();
+  }
+
   template <>
   stream device_t<COI>::createStream(){
     OCCA_EXTRACT_DATA(COI, Device);
@@ -906,6 +1096,9 @@ namespace occa {
     return (endTag.tagTime - startTag.tagTime);
   }
 
+  template <>
+  void device_t<COI>::freeTag(tag tag_){}
+
   template <>
   kernel_v* device_t<COI>::buildKernelFromSource(const std::string &filename,
                                                  const std::string &functionName,
@@ -1016,6 +1209,15 @@ namespace occa {
     return k;
   }
 
+  template <>
+  void device_t<COI>::runGraph(occa::graph &g){
+    // Launches are queued on the stream, replaying in order is enough
+    const int nodeCount = g.size();
+
+    for(int i = 0; i < nodeCount; ++i)
+      g.runNode(g.nodes[i]);
+  }
+
   template <>
   memory_v* device_t<COI>::wrapMemory(void *handle_,
                                       const uintptr_t bytes){
@@ -1030,6 +1232,15 @@ namespace occa {
     return mem;
   }
 
+  template <>
+  memory_v* device_t<COI>::wrapHostMemory(void *ptr,
+                                          const uintptr_t bytes){
+    std::cout << "COI devices can't wrap host memory, use [malloc] and [map] instead\n";
+    throw 1;
+
+    return NULL;
+  }
+
   template <>
   memory_v* device_t<COI>::wrapTexture(void *handle_,
                                        const int dim, const occa::dim &dims,
@@ -1042,7 +1253,8 @@ namespace occa {
 
   template <>
   memory_v* device_t<COI>::malloc(const uintptr_t bytes,
-                                  void *source){
+                                  void *source,
+                                  const int pages){
     OCCA_EXTRACT_DATA(COI, Device);
 
     memory_v *mem = new memory_t<COI>;
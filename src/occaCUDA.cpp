@@ -1,6 +1,7 @@
 #if OCCA_CUDA_ENABLED
 
 #include "occaCUDA.hpp"
+#include "occaGraph.hpp"
 
 namespace occa {
   //---[ Helper Functions ]-----------
@@ -42,14 +43,15 @@ namespace occa {
     }
   };
 
-  const CUarray_format cudaFormats[8] = {CU_AD_FORMAT_UNSIGNED_INT8,
+  const CUarray_format cudaFormats[9] = {CU_AD_FORMAT_UNSIGNED_INT8,
                                          CU_AD_FORMAT_UNSIGNED_INT16,
                                          CU_AD_FORMAT_UNSIGNED_INT32,
                                          CU_AD_FORMAT_SIGNED_INT8,
                                          CU_AD_FORMAT_SIGNED_INT16,
                                          CU_AD_FORMAT_SIGNED_INT32,
                                          CU_AD_FORMAT_HALF,
-                                         CU_AD_FORMAT_FLOAT};
+                                         CU_AD_FORMAT_FLOAT,
+                                         CU_AD_FORMAT_UNSIGNED_INT16};
 
   template <>
   void* formatType::format<occa::CUDA>() const {
@@ -314,6 +316,24 @@ namespace occa {
     return this;
   }
 
+  template <>
+  kernel_t<CUDA>* kernel_t<CUDA>::buildSibling(const std::string &functionName_){
+    OCCA_EXTRACT_DATA(CUDA, Kernel);
+
+    kernel_t<CUDA> *k = new kernel_t<CUDA>;
+
+    k->dev          = dev;
+    k->functionName = functionName_;
+
+    CUDAKernelData_t *kData = new CUDAKernelData_t(data_);
+    k->data = kData;
+
+    OCCA_CUDA_CHECK("Kernel (" + functionName_ + ") : Loading Function",
+                    cuModuleGetFunction(&(kData->function), data_.module, functionName_.c_str()));
+
+    return k;
+  }
+
   template <>
   int kernel_t<CUDA>::preferredDimSize(){
     preferredDimSize_ = 32;
@@ -365,7 +385,23 @@ namespace occa {
     textureInfo.dim = 1;
     textureInfo.w = textureInfo.h = textureInfo.d = 0;
 
-    isAWrapper = false;
+    isAWrapper   = false;
+    wrapsHostPtr = false;
+
+    pageBytes   = 0;
+    mappedBytes = 0;
+
+    parent       = NULL;
+    parentOffset = 0;
+
+    sliceRefs   = 0;
+    freePending = false;
+
+    ownsSharedName = false;
+
+    mapPtr    = NULL;
+    mapBytes  = 0;
+    mapOffset = 0;
   }
 
   template <>
@@ -381,7 +417,24 @@ namespace occa {
     textureInfo.h = m.textureInfo.h;
     textureInfo.d = m.textureInfo.d;
 
-    isAWrapper = m.isAWrapper;
+    isAWrapper   = m.isAWrapper;
+    wrapsHostPtr = m.wrapsHostPtr;
+
+    pageBytes   = m.pageBytes;
+    mappedBytes = m.mappedBytes;
+
+    parent       = m.parent;
+    parentOffset = m.parentOffset;
+
+    sliceRefs   = m.sliceRefs;
+    freePending = m.freePending;
+
+    sharedName     = m.sharedName;
+    ownsSharedName = m.ownsSharedName;
+
+    mapPtr    = m.mapPtr;
+    mapBytes  = m.mapBytes;
+    mapOffset = m.mapOffset;
   }
 
   template <>
@@ -397,7 +450,24 @@ namespace occa {
     textureInfo.h = m.textureInfo.h;
     textureInfo.d = m.textureInfo.d;
 
-    isAWrapper = m.isAWrapper;
+    isAWrapper   = m.isAWrapper;
+    wrapsHostPtr = m.wrapsHostPtr;
+
+    pageBytes   = m.pageBytes;
+    mappedBytes = m.mappedBytes;
+
+    parent       = m.parent;
+    parentOffset = m.parentOffset;
+
+    sliceRefs   = m.sliceRefs;
+    freePending = m.freePending;
+
+    sharedName     = m.sharedName;
+    ownsSharedName = m.ownsSharedName;
+
+    mapPtr    = m.mapPtr;
+    mapBytes  = m.mapBytes;
+    mapOffset = m.mapOffset;
 
     return *this;
   }
@@ -721,8 +791,223 @@ namespace occa {
     }
   }
 
+  // [dest] and [src] are host pointers or point to a CUdeviceptr,
+  //   [stream] is NULL for blocking copies. cuMemcpy3D takes slice
+  //   pitches as a row count, other layouts are copied slice by slice
+  static void cudaCopyRect(void *dest, const bool destIsHost,
+                           const void *src, const bool srcIsHost,
+                           const occa::dim &region,
+                           const occa::rect &destRect,
+                           const occa::rect &srcRect,
+                           const CUstream *stream){
+    const bool rowSlices = (((destRect.slicePitch % destRect.rowPitch) == 0) &&
+                            ((srcRect.slicePitch  % srcRect.rowPitch)  == 0));
+
+    if(rowSlices){
+      CUDA_MEMCPY3D info;
+      memset(&info, 0, sizeof(info));
+
+      if(srcIsHost){
+        info.srcMemoryType = CU_MEMORYTYPE_HOST;
+        info.srcHost       = src;
+      }
+      else{
+        info.srcMemoryType = CU_MEMORYTYPE_DEVICE;
+        info.srcDevice     = *((CUdeviceptr*) src);
+      }
+
+      info.srcXInBytes = srcRect.origin.x;
+      info.srcY        = srcRect.origin.y;
+      info.srcZ        = srcRect.origin.z;
+      info.srcPitch    = srcRect.rowPitch;
+      info.srcHeight   = (srcRect.slicePitch / srcRect.rowPitch);
+
+      if(destIsHost){
+        info.dstMemoryType = CU_MEMORYTYPE_HOST;
+        info.dstHost       = dest;
+      }
+      else{
+        info.dstMemoryType = CU_MEMORYTYPE_DEVICE;
+        info.dstDevice     = *((CUdeviceptr*) dest);
+      }
+
+      info.dstXInBytes = destRect.origin.x;
+      info.dstY        = destRect.origin.y;
+      info.dstZ        = destRect.origin.z;
+      info.dstPitch    = destRect.rowPitch;
+      info.dstHeight   = (destRect.slicePitch / destRect.rowPitch);
+
+      info.WidthInBytes = region.x;
+      info.Height       = region.y;
+      info.Depth        = region.z;
+
+      if(stream == NULL)
+        OCCA_CUDA_CHECK("Memory: Copy Rect",
+                        cuMemcpy3D(&info) );
+      else
+        OCCA_CUDA_CHECK("Memory: Asynchronous Copy Rect",
+                        cuMemcpy3DAsync(&info, *stream) );
+
+      return;
+    }
+
+    for(uintptr_t z = 0; z < region.z; ++z){
+      const uintptr_t srcSlice  = (srcRect.origin.z  + z) * srcRect.slicePitch;
+      const uintptr_t destSlice = (destRect.origin.z + z) * destRect.slicePitch;
+
+      CUDA_MEMCPY2D info;
+      memset(&info, 0, sizeof(info));
+
+      if(srcIsHost){
+        info.srcMemoryType = CU_MEMORYTYPE_HOST;
+        info.srcHost       = ((const char*) src) + srcSlice;
+      }
+      else{
+        info.srcMemoryType = CU_MEMORYTYPE_DEVICE;
+        info.srcDevice     = *((CUdeviceptr*) src) + srcSlice;
+      }
+
+      info.srcXInBytes = srcRect.origin.x;
+      info.srcY        = srcRect.origin.y;
+      info.srcPitch    = srcRect.rowPitch;
+
+      if(destIsHost){
+        info.dstMemoryType = CU_MEMORYTYPE_HOST;
+        info.dstHost       = ((char*) dest) + destSlice;
+      }
+      else{
+        info.dstMemoryType = CU_MEMORYTYPE_DEVICE;
+        info.dstDevice     = *((CUdeviceptr*) dest) + destSlice;
+      }
+
+      info.dstXInBytes = destRect.origin.x;
+      info.dstY        = destRect.origin.y;
+      info.dstPitch    = destRect.rowPitch;
+
+      info.WidthInBytes = region.x;
+      info.Height       = region.y;
+
+      if(stream == NULL)
+        OCCA_CUDA_CHECK("Memory: Copy Rect",
+                        cuMemcpy2D(&info) );
+      else
+        OCCA_CUDA_CHECK("Memory: Asynchronous Copy Rect",
+                        cuMemcpy2DAsync(&info, *stream) );
+    }
+  }
+
+  template <>
+  void memory_t<CUDA>::copyRectFrom(const void *source,
+                                    const occa::dim &region,
+                                    const occa::rect &destRect,
+                                    const occa::rect &srcRect){
+    cudaCopyRect(handle, false,
+                 source, true,
+                 region, destRect, srcRect,
+                 NULL);
+  }
+
+  template <>
+  void memory_t<CUDA>::copyRectFrom(const memory_v *source,
+                                    const occa::dim &region,
+                                    const occa::rect &destRect,
+                                    const occa::rect &srcRect){
+    cudaCopyRect(handle, false,
+                 source->handle, false,
+                 region, destRect, srcRect,
+                 NULL);
+  }
+
+  template <>
+  void memory_t<CUDA>::copyRectTo(void *dest,
+                                  const occa::dim &region,
+                                  const occa::rect &destRect,
+                                  const occa::rect &srcRect){
+    cudaCopyRect(dest, true,
+                 handle, false,
+                 region, destRect, srcRect,
+                 NULL);
+  }
+
+  template <>
+  void memory_t<CUDA>::asyncCopyRectFrom(const void *source,
+                                         const occa::dim &region,
+                                         const occa::rect &destRect,
+                                         const occa::rect &srcRect){
+    const CUstream &stream = *((CUstream*) dev->currentStream);
+
+    cudaCopyRect(handle, false,
+                 source, true,
+                 region, destRect, srcRect,
+                 &stream);
+  }
+
+  template <>
+  void memory_t<CUDA>::asyncCopyRectFrom(const memory_v *source,
+                                         const occa::dim &region,
+                                         const occa::rect &destRect,
+                                         const occa::rect &srcRect){
+    const CUstream &stream = *((CUstream*) dev->currentStream);
+
+    cudaCopyRect(handle, false,
+                 source->handle, false,
+                 region, destRect, srcRect,
+                 &stream);
+  }
+
+  template <>
+  void memory_t<CUDA>::asyncCopyRectTo(void *dest,
+                                       const occa::dim &region,
+                                       const occa::rect &destRect,
+                                       const occa::rect &srcRect){
+    const CUstream &stream = *((CUstream*) dev->currentStream);
+
+    cudaCopyRect(dest, true,
+                 handle, false,
+                 region, destRect, srcRect,
+                 &stream);
+  }
+
+  template <>
+  memory_v* memory_t<CUDA>::slice(const uintptr_t offset,
+                                  const uintptr_t bytes){
+    memory_v *mem = new memory_t<CUDA>;
+
+    mem->dev    = dev;
+    mem->handle = new CUdeviceptr;
+    mem->size   = bytes;
+
+    *((CUdeviceptr*) mem->handle) = (*((CUdeviceptr*) handle) + offset);
+
+    return mem;
+  }
+
+  template <>
+  void* memory_t<CUDA>::map(const uintptr_t bytes,
+                            const uintptr_t offset){
+    // Staged through host memory, copied back in unmap()
+    char *ptr = new char[bytes];
+
+    copyTo(ptr, bytes, offset);
+
+    return ptr;
+  }
+
+  template <>
+  void memory_t<CUDA>::unmap(){
+    copyFrom(mapPtr, mapBytes, mapOffset);
+
+    delete [] (char*) mapPtr;
+  }
+
   template <>
   void memory_t<CUDA>::free(){
+    if(parent != NULL){
+      delete (CUdeviceptr*) handle;
+      size = 0;
+      return;
+    }
+
     if(!isTexture){
       cuMemFree(*((CUdeviceptr*) handle));
 
@@ -915,6 +1200,13 @@ namespace occa {
     cuEventSynchronize(tag_.cuEvent);
   }
 
+  template <>
+  void device_t<CUDA>::streamWaitFor(tag tag_){
+    OCCA_CUDA_CHECK("Device: Stream Wait For Tag",
+                    cuStreamWaitEvent(*((CUstream*) dev->currentStream),
+                                      tag_.cuEvent, 0));
+  }
+
   template <>
   stream device_t<CUDA>::createStream(){
     OCCA_EXTRACT_DATA(CUDA, Device);
@@ -944,7 +1236,7 @@ namespace occa {
     tag ret;
 
     cuEventCreate(&(ret.cuEvent), CU_EVENT_DEFAULT);
-    cuEventRecord(ret.cuEvent, 0);
+    cuEventRecord(ret.cuEvent, *((CUstream*) dev->currentStream));
 
     return ret;
   }
@@ -959,6 +1251,12 @@ namespace occa {
     return (double) (1.0e-3 * (double) msTimeTaken);
   }
 
+  template <>
+  void device_t<CUDA>::freeTag(tag tag_){
+    OCCA_CUDA_CHECK("Device: Free Tag",
+                    cuEventDestroy(tag_.cuEvent));
+  }
+
   template <>
   kernel_v* device_t<CUDA>::buildKernelFromSource(const std::string &filename,
                                                  const std::string &functionName,
@@ -1065,6 +1363,15 @@ namespace occa {
     return k;
   }
 
+  template <>
+  void device_t<CUDA>::runGraph(occa::graph &g){
+    // Launches are queued on the stream, replaying in order is enough
+    const int nodeCount = g.size();
+
+    for(int i = 0; i < nodeCount; ++i)
+      g.runNode(g.nodes[i]);
+  }
+
   template <>
   memory_v* device_t<CUDA>::wrapMemory(void *handle_,
                                        const uintptr_t bytes){
@@ -1080,6 +1387,15 @@ namespace occa {
     return mem;
   }
 
+  template <>
+  memory_v* device_t<CUDA>::wrapHostMemory(void *ptr,
+                                           const uintptr_t bytes){
+    std::cout << "CUDA devices can't wrap host memory, use [malloc] and [map] instead\n";
+    throw 1;
+
+    return NULL;
+  }
+
   template <>
   memory_v* device_t<CUDA>::wrapTexture(void *handle_,
                                         const int dim, const occa::dim &dims,
@@ -1106,7 +1422,8 @@ namespace occa {
 
   template <>
   memory_v* device_t<CUDA>::malloc(const uintptr_t bytes,
-                                   void *source){
+                                   void *source,
+                                   const int pages){
     OCCA_EXTRACT_DATA(CUDA, Device);
 
     memory_v *mem = new memory_t<CUDA>;
@@ -20,6 +20,7 @@ module occa
     occaDeviceSetStream,        &
     occaDeviceTagStream,        &
     occaDeviceTimeBetweenTags,  &
+    occaDeviceFreeTag,          &
     occaDeviceStreamFree,       &
     occaDeviceFree,             &
     occaKernelPreferredDimSize, &
@@ -160,6 +161,16 @@ module occa
     module procedure occaDeviceTagStream_func
   end interface occaDeviceTagStream
 
+  interface occaDeviceFreeTag
+    subroutine occaDeviceFreeTag_fc(device, tag)
+      use occaFTypes_m
+
+      implicit none
+      type(occaDevice), intent(inout) :: device
+      type(occaTag),    intent(in)    :: tag
+    end subroutine occaDeviceFreeTag_fc
+  end interface occaDeviceFreeTag
+
   interface occaDeviceStreamFree
     subroutine occaDeviceStreamFree_fc(device, stream)
       use occaFTypes_m
@@ -124,6 +124,7 @@ do {\
 #define  OCCADEVICESETSTREAM_FC          OCCA_F2C_GLOBAL_(occadevicesetstream_fc        , OCCADEVICESETSTREAM_FC)
 #define  OCCADEVICETAGSTREAM_FC          OCCA_F2C_GLOBAL_(occadevicetagstream_fc        , OCCADEVICETAGSTREAM_FC)
 #define  OCCADEVICETIMEBETWEENTAGS_FC    OCCA_F2C_GLOBAL_(occadevicetimebetweentags_fc  , OCCADEVICETIMEBETWEENTAGS_FC)
+#define  OCCADEVICEFREETAG_FC            OCCA_F2C_GLOBAL_(occadevicefreetag_fc          , OCCADEVICEFREETAG_FC)
 #define  OCCADEVICESTREAMFREE_FC         OCCA_F2C_GLOBAL_(occadevicestreamfree_fc       , OCCADEVICESTREAMFREE_FC)
 #define  OCCADEVICEFREE_FC               OCCA_F2C_GLOBAL_(occadevicefree_fc             , OCCADEVICEFREE_FC)
 #define  OCCAKERNELMODE_FC               OCCA_F2C_GLOBAL_(occakernelmode_fc             , OCCAKERNELMODE_FC)
@@ -408,6 +409,9 @@ extern "C" {
                                       occaTag *startTag, occaTag *endTag){
     *time = occaDeviceTimeBetweenTags(*device, *startTag, *endTag);
   }
+  void OCCADEVICEFREETAG_FC(occaDevice *device, occaTag *tag){
+    occaDeviceFreeTag(*device, *tag);
+  }
 
   void OCCADEVICESTREAMFREE_FC(occaDevice *device, occaStream *stream){
     occaDeviceStreamFree(*device, *stream);
@@ -0,0 +1,281 @@
+#include "occaGraph.hpp"
+
+namespace occa {
+  //---[ Graph ]----------------------
+  graphNode_t::graphNode_t() :
+    type(graphNode::kernelLaunch),
+
+    dims(0),
+
+    hostPtr(NULL),
+    bytes(0),
+    destOffset(0),
+    srcOffset(0),
+    async(false),
+
+    hasTag(false) {}
+
+  graphNode_t::graphNode_t(const graphNode_t &n) :
+    type(n.type),
+
+    k(n.k),
+
+    dims(n.dims),
+    inner(n.inner),
+    outer(n.outer),
+
+    dest(n.dest),
+    src(n.src),
+    hostPtr(n.hostPtr),
+    bytes(n.bytes),
+    destOffset(n.destOffset),
+    srcOffset(n.srcOffset),
+    async(n.async),
+
+    streamTag(n.streamTag),
+    hasTag(n.hasTag) {}
+
+  graphNode_t& graphNode_t::operator = (const graphNode_t &n){
+    type = n.type;
+
+    k = n.k;
+
+    dims  = n.dims;
+    inner = n.inner;
+    outer = n.outer;
+
+    dest       = n.dest;
+    src        = n.src;
+    hostPtr    = n.hostPtr;
+    bytes      = n.bytes;
+    destOffset = n.destOffset;
+    srcOffset  = n.srcOffset;
+    async      = n.async;
+
+    streamTag = n.streamTag;
+    hasTag    = n.hasTag;
+
+    return *this;
+  }
+
+  graph::graph(){}
+
+  graph::graph(occa::device dev_) :
+    dev(dev_) {}
+
+  // Tags stay owned by [g]
+  static void disownTags(std::vector<graphNode_t> &nodes){
+    const int nodeCount = nodes.size();
+
+    for(int i = 0; i < nodeCount; ++i)
+      nodes[i].hasTag = false;
+  }
+
+  graph::graph(const graph &g) :
+    dev(g.dev),
+    nodes(g.nodes) {
+
+    disownTags(nodes);
+  }
+
+  graph& graph::operator = (const graph &g){
+    if(this == &g)
+      return *this;
+
+    clear();
+
+    dev   = g.dev;
+    nodes = g.nodes;
+
+    disownTags(nodes);
+
+    return *this;
+  }
+
+  void graph::setDevice(occa::device dev_){
+    dev = dev_;
+  }
+
+  int graph::size() const {
+    return nodes.size();
+  }
+
+  void graph::clear(){
+    const int nodeCount = nodes.size();
+
+    for(int i = 0; i < nodeCount; ++i){
+      if(nodes[i].hasTag)
+        dev.freeTag(nodes[i].streamTag);
+    }
+
+    nodes.clear();
+  }
+
+  int graph::addKernel(occa::kernel &k){
+    graphNode_t node;
+
+    node.type = graphNode::kernelLaunch;
+    node.k    = k;
+
+    node.k.clearArgumentList();
+
+    nodes.push_back(node);
+
+    return (nodes.size() - 1);
+  }
+
+  int graph::addKernel(occa::kernel &k,
+                       const int dims, const dim &inner, const dim &outer){
+    const int nodeID = addKernel(k);
+
+    setWorkingDims(nodeID, dims, inner, outer);
+
+    return nodeID;
+  }
+
+  void graph::setArgument(const int nodeID,
+                          const int argPos,
+                          const kernelArg &arg){
+    OCCA_CHECK((0 <= nodeID) && (nodeID < (int) nodes.size()));
+    OCCA_CHECK(nodes[nodeID].type == graphNode::kernelLaunch);
+
+    nodes[nodeID].k.addArgument(argPos, arg);
+  }
+
+  void graph::setWorkingDims(const int nodeID,
+                             const int dims, const dim &inner, const dim &outer){
+    OCCA_CHECK((0 <= nodeID) && (nodeID < (int) nodes.size()));
+    OCCA_CHECK(nodes[nodeID].type == graphNode::kernelLaunch);
+    OCCA_CHECK((0 < dims) && (dims <= 3));
+
+    graphNode_t &node = nodes[nodeID];
+
+    node.dims  = dims;
+    node.inner = inner;
+    node.outer = outer;
+  }
+
+  int graph::addCopy(occa::memory &dest,
+                     occa::memory &src,
+                     const uintptr_t bytes,
+                     const uintptr_t destOffset,
+                     const uintptr_t srcOffset,
+                     const bool async){
+    graphNode_t node;
+
+    node.type       = graphNode::copy;
+    node.dest       = dest;
+    node.src        = src;
+    node.bytes      = bytes;
+    node.destOffset = destOffset;
+    node.srcOffset  = srcOffset;
+    node.async      = async;
+
+    nodes.push_back(node);
+
+    return (nodes.size() - 1);
+  }
+
+  int graph::addCopyFrom(occa::memory &dest,
+                         const void *src,
+                         const uintptr_t bytes,
+                         const uintptr_t offset,
+                         const bool async){
+    graphNode_t node;
+
+    node.type       = graphNode::copyFrom;
+    node.dest       = dest;
+    node.hostPtr    = const_cast<void*>(src);
+    node.bytes      = bytes;
+    node.destOffset = offset;
+    node.async      = async;
+
+    nodes.push_back(node);
+
+    return (nodes.size() - 1);
+  }
+
+  int graph::addCopyTo(void *dest,
+                       occa::memory &src,
+                       const uintptr_t bytes,
+                       const uintptr_t offset,
+                       const bool async){
+    graphNode_t node;
+
+    node.type      = graphNode::copyTo;
+    node.src       = src;
+    node.hostPtr   = dest;
+    node.bytes     = bytes;
+    node.srcOffset = offset;
+    node.async     = async;
+
+    nodes.push_back(node);
+
+    return (nodes.size() - 1);
+  }
+
+  int graph::addTag(){
+    graphNode_t node;
+
+    node.type = graphNode::tagStream;
+
+    nodes.push_back(node);
+
+    return (nodes.size() - 1);
+  }
+
+  occa::tag graph::getTag(const int nodeID) const {
+    OCCA_CHECK((0 <= nodeID) && (nodeID < (int) nodes.size()));
+    OCCA_CHECK(nodes[nodeID].type == graphNode::tagStream);
+
+    return nodes[nodeID].streamTag;
+  }
+
+  void graph::run(){
+    OCCA_CHECK(dev.dHandle != NULL);
+
+    dev.dHandle->runGraph(*this);
+  }
+
+  void graph::runNode(graphNode_t &node){
+    switch(node.type){
+    case graphNode::kernelLaunch:
+      // Kernels can be shared between nodes with different dims
+      if(node.dims)
+        node.k.setWorkingDims(node.dims, node.inner, node.outer);
+
+      node.k.runFromArguments();
+      break;
+
+    case graphNode::copy:
+      if(node.async)
+        node.dest.asyncCopyFrom(node.src, node.bytes, node.destOffset, node.srcOffset);
+      else
+        node.dest.copyFrom(node.src, node.bytes, node.destOffset, node.srcOffset);
+      break;
+
+    case graphNode::copyFrom:
+      if(node.async)
+        node.dest.asyncCopyFrom(node.hostPtr, node.bytes, node.destOffset);
+      else
+        node.dest.copyFrom(node.hostPtr, node.bytes, node.destOffset);
+      break;
+
+    case graphNode::copyTo:
+      if(node.async)
+        node.src.asyncCopyTo(node.hostPtr, node.bytes, node.srcOffset);
+      else
+        node.src.copyTo(node.hostPtr, node.bytes, node.srcOffset);
+      break;
+
+    case graphNode::tagStream:
+      if(node.hasTag)
+        dev.freeTag(node.streamTag);
+
+      node.streamTag = dev.tagStream();
+      node.hasTag    = true;
+      break;
+    }
+  }
+  //==================================
+};
@@ -1,6 +1,7 @@
 #if OCCA_OPENCL_ENABLED
 
 #include "occaOpenCL.hpp"
+#include "occaGraph.hpp"
 
 namespace occa {
   //---[ Helper Functions ]-----------
@@ -171,6 +172,31 @@ namespace occa {
       return ret;
     }
 
+    bool deviceSharesHostMemory(cl_device_id clDID){
+      cl_device_type clDeviceType;
+
+      OCCA_CL_CHECK("OpenCL: Get Device Type",
+                    clGetDeviceInfo(clDID,
+                                    CL_DEVICE_TYPE,
+                                    sizeof(clDeviceType), &clDeviceType, NULL));
+
+      if(clDeviceType & CL_DEVICE_TYPE_CPU)
+        return true;
+
+#ifdef CL_DEVICE_HOST_UNIFIED_MEMORY
+      cl_bool unified;
+
+      OCCA_CL_CHECK("OpenCL: Get Device Host Unified Memory",
+                    clGetDeviceInfo(clDID,
+                                    CL_DEVICE_HOST_UNIFIED_MEMORY,
+                                    sizeof(unified), &unified, NULL));
+
+      return (unified == CL_TRUE);
+#else
+      return false;
+#endif
+    }
+
     int deviceCoreCount(int pID, int dID){
       cl_device_id clDID = deviceID(pID, dID);
       cl_uint ret;
@@ -261,6 +287,8 @@ namespace occa {
 
       OCCA_CL_CHECK("Kernel (" + functionName + "): Creating Kernel", error);
 
+      clearArgumentCache(data_);
+
       if(iCachedBinary.size()){
         std::cout << "OpenCL compiled " << functionName << " from [" << iCachedBinary << "]";
 
@@ -318,6 +346,61 @@ namespace occa {
 
       data_.kernel = clCreateKernel(data_.program, functionName.c_str(), &error);
       OCCA_CL_CHECK("Kernel (" + functionName + "): Creating Kernel", error);
+
+      clearArgumentCache(data_);
+    }
+
+    static uintptr_t freedMemoryCount = 0;
+    static uintptr_t skippedBinds     = 0;
+
+    uintptr_t skippedArgumentBinds(){
+      return skippedBinds;
+    }
+
+    void clearArgumentCache(OpenCLKernelData_t &data_){
+      data_.boundFrees = freedMemoryCount;
+
+      for(int i = 0; i < maxArgumentSlots; ++i)
+        data_.boundBytes[i] = 0;
+    }
+
+    cl_int setKernelArg(OpenCLKernelData_t &data_,
+                        const int argPos,
+                        const uintptr_t bytes,
+                        const void *value){
+      static const char nullValue[cachedArgumentBytes] = {0};
+
+      if(data_.boundFrees != freedMemoryCount)
+        clearArgumentCache(data_);
+
+      const bool cached = ((argPos < maxArgumentSlots) &&
+                           (bytes <= (uintptr_t) cachedArgumentBytes));
+
+      // NULL buffers are bound as a zeroed handle
+      const void *value_ = (value ? value : nullValue);
+
+      if(cached                                &&
+         (data_.boundBytes[argPos] == bytes) &&
+         (::memcmp(data_.boundValues[argPos], value_, bytes) == 0)){
+
+        ++skippedBinds;
+        return CL_SUCCESS;
+      }
+
+      const cl_int error = clSetKernelArg(data_.kernel, argPos, bytes, value);
+
+      if(cached){
+        if(error == CL_SUCCESS){
+          data_.boundBytes[argPos] = bytes;
+          ::memcpy(data_.boundValues[argPos], value_, bytes);
+        }
+        else
+          data_.boundBytes[argPos] = 0;
+      }
+      else if(argPos < maxArgumentSlots)
+        data_.boundBytes[argPos] = 0;
+
+      return error;
     }
 
     void saveProgramBinary(OpenCLKernelData_t &data_,
@@ -371,6 +454,9 @@ namespace occa {
       devData.platformID = platformID;
       devData.deviceID   = deviceID;
       devData.context    = context;
+
+      devData.sharesHostMemory = deviceSharesHostMemory(deviceID);
+      devData.outOfOrder       = false;
       //======================
 
       dev.modelID_ = library::deviceModelID(dev.getIdentifier());
@@ -382,14 +468,15 @@ namespace occa {
     }
   };
 
-  const cl_channel_type clFormats[8] = {CL_UNSIGNED_INT8,
+  const cl_channel_type clFormats[9] = {CL_UNSIGNED_INT8,
                                         CL_UNSIGNED_INT16,
                                         CL_UNSIGNED_INT32,
                                         CL_SIGNED_INT8,
                                         CL_SIGNED_INT16,
                                         CL_SIGNED_INT32,
                                         CL_HALF_FLOAT,
-                                        CL_FLOAT};
+                                        CL_FLOAT,
+                                        CL_UNSIGNED_INT16};
 
   template <>
   void* formatType::format<occa::OpenCL>() const {
@@ -523,11 +610,12 @@ namespace occa {
       return buildFromBinary(cachedBinary, functionName);
     }
 
-    std::string iCachedBinary = createIntermediateSource(filename,
-                                                         cachedBinary,
-                                                         info);
+    // clCreateProgramWithSource takes the parsed source from memory
+    const std::string iCachedBinary = getMidCachedBinaryName(cachedBinary, "i");
 
-    std::string cFunction = readFile(iCachedBinary);
+    std::string cFunction = getIntermediateSource(filename,
+                                                  cachedBinary,
+                                                  info);
 
     std::string catFlags = info.flags + dev->dHandle->compilerFlags;
 
@@ -578,6 +666,28 @@ namespace occa {
     return this;
   }
 
+  template <>
+  kernel_t<OpenCL>* kernel_t<OpenCL>::buildSibling(const std::string &functionName_){
+    OCCA_EXTRACT_DATA(OpenCL, Kernel);
+
+    kernel_t<OpenCL> *k = new kernel_t<OpenCL>;
+    cl_int error;
+
+    k->dev          = dev;
+    k->functionName = functionName_;
+
+    OpenCLKernelData_t *kData = new OpenCLKernelData_t(data_);
+    k->data = kData;
+
+    // Shares the built program
+    kData->kernel = clCreateKernel(data_.program, functionName_.c_str(), &error);
+    OCCA_CL_CHECK("Kernel (" + functionName_ + "): Creating Kernel", error);
+
+    cl::clearArgumentCache(*kData);
+
+    return k;
+  }
+
   template <>
   int kernel_t<OpenCL>::preferredDimSize(){
     if(preferredDimSize_)
@@ -653,7 +763,23 @@ namespace occa {
     textureInfo.dim = 1;
     textureInfo.w = textureInfo.h = textureInfo.d = 0;
 
-    isAWrapper = false;
+    isAWrapper   = false;
+    wrapsHostPtr = false;
+
+    pageBytes   = 0;
+    mappedBytes = 0;
+
+    parent       = NULL;
+    parentOffset = 0;
+
+    sliceRefs   = 0;
+    freePending = false;
+
+    ownsSharedName = false;
+
+    mapPtr    = NULL;
+    mapBytes  = 0;
+    mapOffset = 0;
   }
 
   template <>
@@ -669,7 +795,24 @@ namespace occa {
     textureInfo.h = m.textureInfo.h;
     textureInfo.d = m.textureInfo.d;
 
-    isAWrapper = m.isAWrapper;
+    isAWrapper   = m.isAWrapper;
+    wrapsHostPtr = m.wrapsHostPtr;
+
+    pageBytes   = m.pageBytes;
+    mappedBytes = m.mappedBytes;
+
+    parent       = m.parent;
+    parentOffset = m.parentOffset;
+
+    sliceRefs   = m.sliceRefs;
+    freePending = m.freePending;
+
+    sharedName     = m.sharedName;
+    ownsSharedName = m.ownsSharedName;
+
+    mapPtr    = m.mapPtr;
+    mapBytes  = m.mapBytes;
+    mapOffset = m.mapOffset;
   }
 
   template <>
@@ -685,7 +828,24 @@ namespace occa {
     textureInfo.h = m.textureInfo.h;
     textureInfo.d = m.textureInfo.d;
 
-    isAWrapper = m.isAWrapper;
+    isAWrapper   = m.isAWrapper;
+    wrapsHostPtr = m.wrapsHostPtr;
+
+    pageBytes   = m.pageBytes;
+    mappedBytes = m.mappedBytes;
+
+    parent       = m.parent;
+    parentOffset = m.parentOffset;
+
+    sliceRefs   = m.sliceRefs;
+    freePending = m.freePending;
+
+    sharedName     = m.sharedName;
+    ownsSharedName = m.ownsSharedName;
+
+    mapPtr    = m.mapPtr;
+    mapBytes  = m.mapBytes;
+    mapOffset = m.mapOffset;
 
     return *this;
   }
@@ -951,8 +1111,213 @@ namespace occa {
                                         0, NULL, NULL));
   }
 
+  // The buffer origin and row/slice offsets for the clEnqueue*Rect calls
+  static inline void clRectArrays(const occa::dim &region,
+                                  const occa::rect &destRect,
+                                  const occa::rect &srcRect,
+                                  size_t *destOrigin,
+                                  size_t *srcOrigin,
+                                  size_t *region_){
+    for(int i = 0; i < 3; ++i){
+      destOrigin[i] = destRect.origin.data[i];
+      srcOrigin[i]  = srcRect.origin.data[i];
+      region_[i]    = region.data[i];
+    }
+  }
+
+  template <>
+  void memory_t<OpenCL>::copyRectFrom(const void *source,
+                                      const occa::dim &region,
+                                      const occa::rect &destRect,
+                                      const occa::rect &srcRect){
+    const cl_command_queue &stream = *((cl_command_queue*) dev->currentStream);
+
+    size_t destOrigin[3], srcOrigin[3], region_[3];
+
+    clRectArrays(region, destRect, srcRect,
+                 destOrigin, srcOrigin, region_);
+
+    OCCA_CL_CHECK("Memory: Copy Rect From",
+                  clEnqueueWriteBufferRect(stream, *((cl_mem*) handle),
+                                           CL_TRUE,
+                                           destOrigin, srcOrigin, region_,
+                                           destRect.rowPitch, destRect.slicePitch,
+                                           srcRect.rowPitch , srcRect.slicePitch,
+                                           source,
+                                           0, NULL, NULL));
+  }
+
+  template <>
+  void memory_t<OpenCL>::copyRectFrom(const memory_v *source,
+                                      const occa::dim &region,
+                                      const occa::rect &destRect,
+                                      const occa::rect &srcRect){
+    const cl_command_queue &stream = *((cl_command_queue*) dev->currentStream);
+
+    size_t destOrigin[3], srcOrigin[3], region_[3];
+
+    clRectArrays(region, destRect, srcRect,
+                 destOrigin, srcOrigin, region_);
+
+    OCCA_CL_CHECK("Memory: Copy Rect From",
+                  clEnqueueCopyBufferRect(stream,
+                                          *((cl_mem*) source->handle),
+                                          *((cl_mem*) handle),
+                                          srcOrigin, destOrigin, region_,
+                                          srcRect.rowPitch , srcRect.slicePitch,
+                                          destRect.rowPitch, destRect.slicePitch,
+                                          0, NULL, NULL));
+  }
+
+  template <>
+  void memory_t<OpenCL>::copyRectTo(void *dest,
+                                    const occa::dim &region,
+                                    const occa::rect &destRect,
+                                    const occa::rect &srcRect){
+    const cl_command_queue &stream = *((cl_command_queue*) dev->currentStream);
+
+    size_t destOrigin[3], srcOrigin[3], region_[3];
+
+    clRectArrays(region, destRect, srcRect,
+                 destOrigin, srcOrigin, region_);
+
+    OCCA_CL_CHECK("Memory: Copy Rect To",
+                  clEnqueueReadBufferRect(stream, *((cl_mem*) handle),
+                                          CL_TRUE,
+                                          srcOrigin, destOrigin, region_,
+                                          srcRect.rowPitch , srcRect.slicePitch,
+                                          destRect.rowPitch, destRect.slicePitch,
+                                          dest,
+                                          0, NULL, NULL));
+  }
+
+  template <>
+  void memory_t<OpenCL>::asyncCopyRectFrom(const void *source,
+                                           const occa::dim &region,
+                                           const occa::rect &destRect,
+                                           const occa::rect &srcRect){
+    const cl_command_queue &stream = *((cl_command_queue*) dev->currentStream);
+
+    size_t destOrigin[3], srcOrigin[3], region_[3];
+
+    clRectArrays(region, destRect, srcRect,
+                 destOrigin, srcOrigin, region_);
+
+    OCCA_CL_CHECK("Memory: Asynchronous Copy Rect From",
+                  clEnqueueWriteBufferRect(stream, *((cl_mem*) handle),
+                                           CL_FALSE,
+                                           destOrigin, srcOrigin, region_,
+                                           destRect.rowPitch, destRect.slicePitch,
+                                           srcRect.rowPitch , srcRect.slicePitch,
+                                           source,
+                                           0, NULL, NULL));
+  }
+
+  template <>
+  void memory_t<OpenCL>::asyncCopyRectFrom(const memory_v *source,
+                                           const occa::dim &region,
+                                           const occa::rect &destRect,
+                                           const occa::rect &srcRect){
+    const cl_command_queue &stream = *((cl_command_queue*) dev->currentStream);
+
+    size_t destOrigin[3], srcOrigin[3], region_[3];
+
+    clRectArrays(region, destRect, srcRect,
+                 destOrigin, srcOrigin, region_);
+
+    OCCA_CL_CHECK("Memory: Asynchronous Copy Rect From",
+                  clEnqueueCopyBufferRect(stream,
+                                          *((cl_mem*) source->handle),
+                                          *((cl_mem*) handle),
+                                          srcOrigin, destOrigin, region_,
+                                          srcRect.rowPitch , srcRect.slicePitch,
+                                          destRect.rowPitch, destRect.slicePitch,
+                                          0, NULL, NULL));
+  }
+
+  template <>
+  void memory_t<OpenCL>::asyncCopyRectTo(void *dest,
+                                         const occa::dim &region,
+                                         const occa::rect &destRect,
+                                         const occa::rect &srcRect){
+    const cl_command_queue &stream = *((cl_command_queue*) dev->currentStream);
+
+    size_t destOrigin[3], srcOrigin[3], region_[3];
+
+    clRectArrays(region, destRect, srcRect,
+                 destOrigin, srcOrigin, region_);
+
+    OCCA_CL_CHECK("Memory: Asynchronous Copy Rect To",
+                  clEnqueueReadBufferRect(stream, *((cl_mem*) handle),
+                                          CL_FALSE,
+                                          srcOrigin, destOrigin, region_,
+                                          srcRect.rowPitch , srcRect.slicePitch,
+                                          destRect.rowPitch, destRect.slicePitch,
+                                          dest,
+                                          0, NULL, NULL));
+  }
+
+  template <>
+  memory_v* memory_t<OpenCL>::slice(const uintptr_t offset,
+                                    const uintptr_t bytes){
+    memory_v *mem = new memory_t<OpenCL>;
+
+    cl_int error;
+    cl_buffer_region region;
+
+    region.origin = offset;
+    region.size   = bytes;
+
+    mem->dev    = dev;
+    mem->handle = new cl_mem;
+    mem->size   = bytes;
+
+    // [offset] must be aligned to CL_DEVICE_MEM_BASE_ADDR_ALIGN
+    *((cl_mem*) mem->handle) = clCreateSubBuffer(*((cl_mem*) handle),
+                                                 CL_MEM_READ_WRITE,
+                                                 CL_BUFFER_CREATE_TYPE_REGION,
+                                                 &region,
+                                                 &error);
+
+    OCCA_CL_CHECK("Memory: Slice", error);
+
+    return mem;
+  }
+
+  template <>
+  void* memory_t<OpenCL>::map(const uintptr_t bytes,
+                              const uintptr_t offset){
+    cl_command_queue &stream = *((cl_command_queue*) dev->currentStream);
+    cl_int error;
+
+    // Returns the buffer's own pages when they live on the host
+    void *ptr = clEnqueueMapBuffer(stream, *((cl_mem*) handle),
+                                   CL_TRUE,
+                                   CL_MAP_READ | CL_MAP_WRITE,
+                                   offset, bytes,
+                                   0, NULL, NULL,
+                                   &error);
+
+    OCCA_CL_CHECK("Memory: Map", error);
+
+    return ptr;
+  }
+
+  template <>
+  void memory_t<OpenCL>::unmap(){
+    cl_command_queue &stream = *((cl_command_queue*) dev->currentStream);
+
+    OCCA_CL_CHECK("Memory: Unmap",
+                  clEnqueueUnmapMemObject(stream, *((cl_mem*) handle),
+                                          mapPtr,
+                                          0, NULL, NULL));
+  }
+
   template <>
   void memory_t<OpenCL>::free(){
+    // Kernels rebind their arguments in case the handle is recycled
+    ++(cl::freedMemoryCount);
+
     clReleaseMemObject(*((cl_mem*) handle));
 
     if(!isAWrapper)
@@ -1049,6 +1414,10 @@ namespace occa {
 
     data_.context = clCreateContext(NULL, 1, &data_.deviceID, NULL, NULL, &error);
     OCCA_CL_CHECK("Device: Creating Context", error);
+
+    data_.sharesHostMemory = cl::deviceSharesHostMemory(data_.deviceID);
+
+    data_.outOfOrder = (aim.has("outOfOrder") && aim.iGet("outOfOrder"));
   }
 
   template <>
@@ -1135,6 +1504,19 @@ namespace occa {
     clWaitForEvents(1, &(tag_.clEvent));
   }
 
+  template <>
+  void device_t<OpenCL>::streamWaitFor(tag tag_){
+    cl_command_queue &stream = *((cl_command_queue*) dev->currentStream);
+
+#ifdef CL_VERSION_1_2
+    OCCA_CL_CHECK("Device: Stream Wait For Tag",
+                  clEnqueueBarrierWithWaitList(stream, 1, &(tag_.clEvent), NULL));
+#else
+    OCCA_CL_CHECK("Device: Stream Wait For Tag",
+                  clEnqueueWaitForEvents(stream, 1, &(tag_.clEvent)));
+#endif
+  }
+
   template <>
   stream device_t<OpenCL>::createStream(){
     OCCA_EXTRACT_DATA(OpenCL, Device);
@@ -1142,7 +1524,12 @@ namespace occa {
 
     cl_command_queue *retStream = new cl_command_queue;
 
-    *retStream = clCreateCommandQueue(data_.context, data_.deviceID, CL_QUEUE_PROFILING_ENABLE, &error);
+    cl_command_queue_properties properties = CL_QUEUE_PROFILING_ENABLE;
+
+    if(data_.outOfOrder)
+      properties |= CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE;
+
+    *retStream = clCreateCommandQueue(data_.context, data_.deviceID, properties, &error);
     OCCA_CL_CHECK("Device: createStream", error);
 
     return retStream;
@@ -1194,12 +1581,15 @@ namespace occa {
                                            sizeof(cl_ulong),
                                            &end, NULL) );
 
-    clReleaseEvent(startTag.clEvent);
-    clReleaseEvent(endTag.clEvent);
-
     return (double) (1.0e-9 * (double)(end - start));
   }
 
+  template <>
+  void device_t<OpenCL>::freeTag(tag tag_){
+    OCCA_CL_CHECK("Device: Free Tag",
+                  clReleaseEvent(tag_.clEvent));
+  }
+
   template <>
   kernel_v* device_t<OpenCL>::buildKernelFromSource(const std::string &filename,
                                                    const std::string &functionName,
@@ -1274,14 +1664,7 @@ namespace occa {
 
     std::string cachedBinary = getCachedName(filename, salt.str());
 
-    std::string prefix, name;
-    getFilePrefixAndName(cachedBinary, prefix, name);
-
-    std::string extension = getFileExtension(filename);
-
-    const std::string iCachedBinary = prefix + "i_" + name;
-
-    std::string contents = readFile(iCachedBinary);
+    std::string contents = getIntermediateSource(filename, cachedBinary, info);
     //==================================
 
     library::infoID_t infoID;
@@ -1329,6 +1712,15 @@ namespace occa {
     return k;
   }
 
+  template <>
+  void device_t<OpenCL>::runGraph(occa::graph &g){
+    // Launches are queued on the stream, replaying in order is enough
+    const int nodeCount = g.size();
+
+    for(int i = 0; i < nodeCount; ++i)
+      g.runNode(g.nodes[i]);
+  }
+
   template <>
   memory_v* device_t<OpenCL>::wrapMemory(void *handle_,
                                          const uintptr_t bytes){
@@ -1343,6 +1735,30 @@ namespace occa {
     return mem;
   }
 
+  template <>
+  memory_v* device_t<OpenCL>::wrapHostMemory(void *ptr,
+                                             const uintptr_t bytes){
+    OCCA_EXTRACT_DATA(OpenCL, Device);
+
+    memory_v *mem = new memory_t<OpenCL>;
+    cl_int error;
+
+    mem->dev    = dev;
+    mem->handle = new cl_mem;
+    mem->size   = bytes;
+
+    // Devices sharing host memory use [ptr] directly, others may cache it
+    *((cl_mem*) mem->handle) = clCreateBuffer(data_.context,
+                                              CL_MEM_READ_WRITE | CL_MEM_USE_HOST_PTR,
+                                              bytes, ptr, &error);
+
+    OCCA_CL_CHECK("Device: Wrapping host memory", error);
+
+    mem->wrapsHostPtr = true;
+
+    return mem;
+  }
+
   template <>
   memory_v* device_t<OpenCL>::wrapTexture(void *handle_,
                                           const int dim, const occa::dim &dims,
@@ -1419,7 +1835,8 @@ namespace occa {
 
   template <>
   memory_v* device_t<OpenCL>::malloc(const uintptr_t bytes,
-                                     void *source){
+                                     void *source,
+                                     const int pages){
     OCCA_EXTRACT_DATA(OpenCL, Device);
 
     memory_v *mem = new memory_t<OpenCL>;
@@ -1429,14 +1846,20 @@ namespace occa {
     mem->handle = new cl_mem;
     mem->size   = bytes;
 
+    // Host-allocated buffers make map() zero-copy on CPU/integrated devices
+    cl_mem_flags flags = CL_MEM_READ_WRITE;
+
+    if(data_.sharesHostMemory)
+      flags |= CL_MEM_ALLOC_HOST_PTR;
+
     if(source == NULL){
       *((cl_mem*) mem->handle) = clCreateBuffer(data_.context,
-                                                CL_MEM_READ_WRITE,
+                                                flags,
                                                 bytes, NULL, &error);
     }
     else{
       *((cl_mem*) mem->handle) = clCreateBuffer(data_.context,
-                                                CL_MEM_READ_WRITE | CL_MEM_COPY_HOST_PTR,
+                                                flags | CL_MEM_COPY_HOST_PTR,
                                                 bytes, source, &error);
 
       finish();
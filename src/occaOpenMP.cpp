@@ -1,6 +1,170 @@
 #include "occaOpenMP.hpp"
+#include "occaGraph.hpp"
+
+#if OCCA_OPENMP_ENABLED
+#  include <omp.h>
+#endif
+
+#if (OCCA_OS == LINUX_OS)
+#  include <pthread.h>
+#endif
 
 namespace occa {
+  //---[ Team ]-----------------------
+#if OCCA_OPENMP_ENABLED && (OCCA_OS == LINUX_OS)
+  // Every host thread launches on its own pool, pool threads keep their
+  //   affinity and are only re-pinned when a team on other cores launches
+  static pthread_key_t teamPinnedCoresKey;
+  static pthread_once_t teamPinnedCoresOnce = PTHREAD_ONCE_INIT;
+
+  static void freeTeamPinnedCores(void *cores){
+    delete (std::vector<int>*) cores;
+  }
+
+  static void createTeamPinnedCoresKey(){
+    pthread_key_create(&teamPinnedCoresKey, freeTeamPinnedCores);
+  }
+
+  static std::vector<int>& teamPinnedCores(){
+    pthread_once(&teamPinnedCoresOnce, createTeamPinnedCoresKey);
+
+    std::vector<int> *cores = (std::vector<int>*) pthread_getspecific(teamPinnedCoresKey);
+
+    if(cores == NULL){
+      cores = new std::vector<int>;
+      pthread_setspecific(teamPinnedCoresKey, cores);
+    }
+
+    return *cores;
+  }
+
+  static void pinToCore(const int core){
+    cpu_set_t cpuHandle;
+    CPU_ZERO(&cpuHandle);
+    CPU_SET(core, &cpuHandle);
+
+    sched_setaffinity(0, sizeof(cpu_set_t), &cpuHandle);
+  }
+
+  // The launching thread is pinned by its openMPTeamScope
+  static void pinOpenMPTeam(const std::vector<int> &cores){
+    const int threadCount = cores.size();
+
+#pragma omp parallel num_threads(threadCount)
+    {
+      const int t = omp_get_thread_num();
+
+      if(t)
+        pinToCore(cores[t]);
+    }
+
+    teamPinnedCores() = cores;
+  }
+#endif
+
+  // Launchers for other modes use a device_t<OpenMP> without setup()
+  static void copyOpenMPTeam(OpenMPTeam_t &team, void *deviceData){
+    if(deviceData){
+      team = ((OpenMPDeviceData_t*) deviceData)->team;
+      return;
+    }
+
+    team.threadCount = 0;
+    team.schedule    = 0;
+    team.chunk       = 0;
+
+    team.pinnedCores.clear();
+  }
+
+  openMPTeamScope::openMPTeamScope(const OpenMPTeam_t &team) :
+    changedICVs(false) {
+#if (OCCA_OS == LINUX_OS)
+    changedAffinity = false;
+#endif
+
+#if OCCA_OPENMP_ENABLED
+    // Nested kernels run inside the launcher's team
+    if(omp_in_parallel())
+      return;
+
+#  if (OCCA_OS == LINUX_OS)
+    if(team.pinnedCores.size()){
+      if(team.pinnedCores != teamPinnedCores())
+        pinOpenMPTeam(team.pinnedCores);
+
+      sched_getaffinity(0, sizeof(cpu_set_t), &affinity);
+      pinToCore(team.pinnedCores[0]);
+
+      changedAffinity = true;
+    }
+#  endif
+
+    if((team.threadCount == 0) && (team.schedule == 0))
+      return;
+
+    omp_sched_t schedule_;
+    omp_get_schedule(&schedule_, &chunk);
+
+    schedule    = schedule_;
+    threadCount = omp_get_max_threads();
+
+    if(team.threadCount)
+      omp_set_num_threads(team.threadCount);
+
+    if(team.schedule)
+      omp_set_schedule((omp_sched_t) team.schedule, team.chunk);
+
+    changedICVs = true;
+#endif
+  }
+
+  openMPTeamScope::~openMPTeamScope(){
+#if OCCA_OPENMP_ENABLED && (OCCA_OS == LINUX_OS)
+    if(changedAffinity)
+      sched_setaffinity(0, sizeof(cpu_set_t), &affinity);
+#endif
+
+#if OCCA_OPENMP_ENABLED
+    if(!changedICVs)
+      return;
+
+    omp_set_num_threads(threadCount);
+    omp_set_schedule((omp_sched_t) schedule, chunk);
+#endif
+  }
+
+  // Every thread runs the launchers, they share out their outer loops.
+  //   Copies and tags are run by one thread
+  static void runGraphInTeam(occa::graph &g, const int start, const int end){
+    for(int i = start; i < end; ++i){
+      graphNode_t &node = g.nodes[i];
+
+      if(node.type != graphNode::kernelLaunch){
+#pragma omp single
+        g.runNode(node);
+
+        continue;
+      }
+
+      if(node.dims){
+#pragma omp single
+        node.k.setWorkingDims(node.dims, node.inner, node.outer);
+      }
+
+      node.k.runFromArguments();
+    }
+  }
+
+  bool openMPLaunchOpensTeam(OpenMPKernelData_t &kData){
+#if OCCA_OPENMP_ENABLED
+    return (kData.usesRegion && !omp_in_parallel());
+#else
+    return false;
+#endif
+  }
+  //==================================
+
+
   //---[ Kernel ]---------------------
   template <>
   kernel_t<OpenMP>::kernel_t(){
@@ -77,8 +241,6 @@ namespace occa {
     info_.addIncludeDefine("omp.h");
 #endif
 
-    info_.addOCCAKeywords(occaOpenMPDefines);
-
     std::stringstream salt;
 
     salt << "OpenMP"
@@ -86,7 +248,8 @@ namespace occa {
          << parser::version
          << dev->dHandle->compilerEnvScript
          << dev->dHandle->compiler
-         << dev->dHandle->compilerFlags;
+         << dev->dHandle->compilerFlags
+         << isaName(getHostISA());
 
     std::string cachedBinary = getCachedName(filename, salt.str());
 
@@ -115,58 +278,57 @@ namespace occa {
 
     data = new OpenMPKernelData_t;
 
-    //---[ Create Intermediate ]--------
     const std::string iCachedBinary = getMidCachedBinaryName(cachedBinary, "i");
+    const std::string iSource       = getIntermediateSource(filename, cachedBinary, info);
 
-    {
-      struct stat buffer;
-      bool fileExists = (stat(iCachedBinary.c_str(), &buffer) == 0);
+    const std::string occaDir = getOCCADir();
 
-      if(!fileExists){
-        std::ofstream fs;
-        fs.open(iCachedBinary.c_str());
+    std::stringstream flags;
 
-        fs << info.occaKeywords << info.header << readFile(filename);
+    flags << dev->dHandle->compilerFlags
+          << ' '   << isaCompilerFlags(getHostISA(),
+                                       dev->dHandle->compiler,
+                                       dev->dHandle->compilerFlags)
+          << ' '   << info.flags
+          << " -I" << occaDir << "/include";
 
-        fs.close();
-      }
-    }
-    //==================================
+    const std::string &sFlags = flags.str();
 
-    const std::string occaDir = getOCCADir();
+    const std::string preludeFile = getCachedPrelude(getCPUPrelude(occaOpenMPDefines, iSource),
+                                                     dev->dHandle->compilerEnvScript,
+                                                     dev->dHandle->compiler,
+                                                     sFlags);
 
+    // The source goes through stdin unless it's kept for debugging
     std::stringstream command;
 
-    if(dev->dHandle->compilerEnvScript.size())
-      command << dev->dHandle->compilerEnvScript << " && ";
-
     command << dev->dHandle->compiler
 #if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
             << " -x c++ -w -fPIC -shared"
 #else
             << " /TP /LD /D MC_CL_EXE"
 #endif
-            << ' '    << dev->dHandle->compilerFlags
-            << ' '    << info.flags
-            << " -I"  << occaDir << "/include"
+            << ' '    << sFlags
             << " -L"  << occaDir << "/lib -locca"
-            << ' '    << iCachedBinary
 #if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
-            << " -o " << cachedBinary
+            << " -include " << preludeFile
+#else
+            << " /FI\"" << preludeFile << '"'
+#endif
+            << ' '    << (keepIntermediateFiles() ? iCachedBinary : "-")
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+            << " -o " << cachedBinary;
 #else
-            << " /link /OUT:" << cachedBinary
+            << " /link /OUT:" << cachedBinary;
 #endif
-            << std::endl;
 
     const std::string &sCommand = command.str();
 
     std::cout << "Compiling [" << functionName << "]\n" << sCommand << "\n";
 
-#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
-    const int compileError = system(sCommand.c_str());
-#else
-    const int compileError = system(("\"" +  sCommand + "\"").c_str());
-#endif
+    const int compileError = runCompiler(dev->dHandle->compilerEnvScript,
+                                         sCommand,
+                                         iSource);
 
     if(compileError){
       releaseFile(cachedBinary);
@@ -175,6 +337,11 @@ namespace occa {
 
     OCCA_EXTRACT_DATA(OpenMP, Kernel);
 
+    data_.ownsLibrary = true;
+    data_.usesRegion  = false;
+
+    copyOpenMPTeam(data_.team, dev->dHandle->data);
+
 #if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
     data_.dlHandle = dlopen(cachedBinary.c_str(), RTLD_NOW);
 
@@ -224,6 +391,11 @@ namespace occa {
 
     OCCA_EXTRACT_DATA(OpenMP, Kernel);
 
+    data_.ownsLibrary = true;
+    data_.usesRegion  = false;
+
+    copyOpenMPTeam(data_.team, dev->dHandle->data);
+
     functionName = functionName_;
 
 #if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
@@ -263,11 +435,46 @@ namespace occa {
     return buildFromBinary(cache, functionName_);
   }
 
+  template <>
+  kernel_t<OpenMP>* kernel_t<OpenMP>::buildSibling(const std::string &functionName_){
+    OCCA_EXTRACT_DATA(OpenMP, Kernel);
+
+    kernel_t<OpenMP> *k = new kernel_t<OpenMP>;
+
+    k->dev          = dev;
+    k->functionName = functionName_;
+
+    OpenMPKernelData_t *kData = new OpenMPKernelData_t(data_);
+    k->data = kData;
+
+    kData->ownsLibrary = false;
+    kData->usesRegion  = false;
+
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    kData->handle = dlsym(data_.dlHandle, functionName_.c_str());
+
+    char *dlError;
+    if ((dlError = dlerror()) != NULL)  {
+      fputs(dlError, stderr);
+      throw 1;
+    }
+#else
+    kData->handle = GetProcAddress((HMODULE) (data_.dlHandle), functionName_.c_str());
+
+    if(kData->handle == NULL) {
+      fputs("unable to load function", stderr);
+      throw 1;
+    }
+#endif
+
+    return k;
+  }
+
   // [-] Missing
   template <>
   int kernel_t<OpenMP>::preferredDimSize(){
-    preferredDimSize_ = OCCA_SIMD_WIDTH;
-    return OCCA_SIMD_WIDTH;
+    preferredDimSize_ = dev->simdWidth();
+    return preferredDimSize_;
   }
 
 #include "operators/occaOpenMPKernelOperators.cpp"
@@ -293,6 +500,11 @@ namespace occa {
     // [-] Fix later
     OCCA_EXTRACT_DATA(OpenMP, Kernel);
 
+    if(!data_.ownsLibrary){
+      delete (OpenMPKernelData_t*) data;
+      return;
+    }
+
 #if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
     dlclose(data_.dlHandle);
 #else
@@ -303,6 +515,30 @@ namespace occa {
 
 
   //---[ Memory ]---------------------
+  // Large regions are split across the device's team
+  static void openMPCopyRect(void *dest,
+                             const void *src,
+                             const occa::dim &region,
+                             const occa::rect &destRect,
+                             const occa::rect &srcRect,
+                             const OpenMPTeam_t &team){
+#if OCCA_OPENMP_ENABLED
+    if(cpuCopyRectIsLarge(region) && !omp_in_parallel()){
+      const int threads = (team.threadCount ? team.threadCount : omp_get_max_threads());
+
+#pragma omp parallel num_threads(threads)
+      cpuCopyRect(dest, src,
+                  region, destRect, srcRect,
+                  omp_get_thread_num(), omp_get_num_threads());
+
+      return;
+    }
+#endif
+
+    cpuCopyRect(dest, src,
+                region, destRect, srcRect);
+  }
+
   template <>
   memory_t<OpenMP>::memory_t(){
     handle = NULL;
@@ -314,7 +550,23 @@ namespace occa {
     textureInfo.dim = 1;
     textureInfo.w = textureInfo.h = textureInfo.d = 0;
 
-    isAWrapper = false;
+    isAWrapper   = false;
+    wrapsHostPtr = false;
+
+    pageBytes   = 0;
+    mappedBytes = 0;
+
+    parent       = NULL;
+    parentOffset = 0;
+
+    sliceRefs   = 0;
+    freePending = false;
+
+    ownsSharedName = false;
+
+    mapPtr    = NULL;
+    mapBytes  = 0;
+    mapOffset = 0;
   }
 
   template <>
@@ -334,7 +586,24 @@ namespace occa {
     if(isTexture)
       handle = &textureInfo;
 
-    isAWrapper = m.isAWrapper;
+    isAWrapper   = m.isAWrapper;
+    wrapsHostPtr = m.wrapsHostPtr;
+
+    pageBytes   = m.pageBytes;
+    mappedBytes = m.mappedBytes;
+
+    parent       = m.parent;
+    parentOffset = m.parentOffset;
+
+    sliceRefs   = m.sliceRefs;
+    freePending = m.freePending;
+
+    sharedName     = m.sharedName;
+    ownsSharedName = m.ownsSharedName;
+
+    mapPtr    = m.mapPtr;
+    mapBytes  = m.mapBytes;
+    mapOffset = m.mapOffset;
   }
 
   template <>
@@ -354,7 +623,24 @@ namespace occa {
     if(isTexture)
       handle = &textureInfo;
 
-    isAWrapper = m.isAWrapper;
+    isAWrapper   = m.isAWrapper;
+    wrapsHostPtr = m.wrapsHostPtr;
+
+    pageBytes   = m.pageBytes;
+    mappedBytes = m.mappedBytes;
+
+    parent       = m.parent;
+    parentOffset = m.parentOffset;
+
+    sliceRefs   = m.sliceRefs;
+    freePending = m.freePending;
+
+    sharedName     = m.sharedName;
+    ownsSharedName = m.ownsSharedName;
+
+    mapPtr    = m.mapPtr;
+    mapBytes  = m.mapBytes;
+    mapOffset = m.mapOffset;
 
     return *this;
   }
@@ -501,12 +787,106 @@ namespace occa {
     ::memcpy(destPtr, srcPtr, bytes_);
   }
 
+  template <>
+  void memory_t<OpenMP>::copyRectFrom(const void *source,
+                                      const occa::dim &region,
+                                      const occa::rect &destRect,
+                                      const occa::rect &srcRect){
+    dev->finish();
+
+    asyncCopyRectFrom(source, region, destRect, srcRect);
+  }
+
+  template <>
+  void memory_t<OpenMP>::copyRectFrom(const memory_v *source,
+                                      const occa::dim &region,
+                                      const occa::rect &destRect,
+                                      const occa::rect &srcRect){
+    dev->finish();
+
+    asyncCopyRectFrom(source, region, destRect, srcRect);
+  }
+
+  template <>
+  void memory_t<OpenMP>::copyRectTo(void *dest,
+                                    const occa::dim &region,
+                                    const occa::rect &destRect,
+                                    const occa::rect &srcRect){
+    dev->finish();
+
+    asyncCopyRectTo(dest, region, destRect, srcRect);
+  }
+
+  template <>
+  void memory_t<OpenMP>::asyncCopyRectFrom(const void *source,
+                                           const occa::dim &region,
+                                           const occa::rect &destRect,
+                                           const occa::rect &srcRect){
+    openMPCopyRect(handle, source,
+                   region, destRect, srcRect,
+                   ((OpenMPDeviceData_t*) dev->dHandle->data)->team);
+  }
+
+  template <>
+  void memory_t<OpenMP>::asyncCopyRectFrom(const memory_v *source,
+                                           const occa::dim &region,
+                                           const occa::rect &destRect,
+                                           const occa::rect &srcRect){
+    openMPCopyRect(handle, source->handle,
+                   region, destRect, srcRect,
+                   ((OpenMPDeviceData_t*) dev->dHandle->data)->team);
+  }
+
+  template <>
+  void memory_t<OpenMP>::asyncCopyRectTo(void *dest,
+                                         const occa::dim &region,
+                                         const occa::rect &destRect,
+                                         const occa::rect &srcRect){
+    openMPCopyRect(dest, handle,
+                   region, destRect, srcRect,
+                   ((OpenMPDeviceData_t*) dev->dHandle->data)->team);
+  }
+
+  template <>
+  memory_v* memory_t<OpenMP>::slice(const uintptr_t offset,
+                                const uintptr_t bytes){
+    memory_v *mem = new memory_t<OpenMP>;
+
+    mem->dev    = dev;
+    mem->handle = ((char*) handle) + offset;
+    mem->size   = bytes;
+
+    mem->pageBytes = pageBytes;
+
+    return mem;
+  }
+
+  template <>
+  void* memory_t<OpenMP>::map(const uintptr_t bytes,
+                              const uintptr_t offset){
+    dev->finish();
+
+    return (((char*) handle) + offset);
+  }
+
+  template <>
+  void memory_t<OpenMP>::unmap(){}
+
   template <>
   void memory_t<OpenMP>::free(){
+    // Slices and wrapped host pointers don't own their pointer
+    if((parent != NULL) || wrapsHostPtr){
+      size = 0;
+      return;
+    }
+
     if(isTexture)
       ::free(textureInfo.arg);
     else
-      ::free(handle);
+      cpuFree(handle, mappedBytes);
+
+    if(ownsSharedName)
+      cpuUnlinkShared(sharedName);
 
     size = 0;
   }
@@ -518,6 +898,7 @@ namespace occa {
   device_t<OpenMP>::device_t(){
     data            = NULL;
     memoryAllocated = 0;
+    simdWidth_      = 0;
 
     getEnvironmentVariables();
   }
@@ -526,6 +907,7 @@ namespace occa {
   device_t<OpenMP>::device_t(const device_t<OpenMP> &d){
     data            = d.data;
     memoryAllocated = d.memoryAllocated;
+    simdWidth_      = d.simdWidth_;
 
     compiler      = d.compiler;
     compilerFlags = d.compilerFlags;
@@ -535,6 +917,7 @@ namespace occa {
   device_t<OpenMP>& device_t<OpenMP>::operator = (const device_t<OpenMP> &d){
     data            = d.data;
     memoryAllocated = d.memoryAllocated;
+    simdWidth_      = d.simdWidth_;
 
     compiler      = d.compiler;
     compilerFlags = d.compilerFlags;
@@ -543,7 +926,100 @@ namespace occa {
   }
 
   template <>
-  void device_t<OpenMP>::setup(argInfoMap &aim){}
+  void device_t<OpenMP>::setup(argInfoMap &aim){
+    data = new OpenMPDeviceData_t;
+
+    OCCA_EXTRACT_DATA(OpenMP, Device);
+
+    OpenMPTeam_t &team = data_.team;
+
+    simdWidth_ = isaSimdWidth(getHostISA());
+
+    int coreCount = 1;
+
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    coreCount = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+
+    team.threadCount = (aim.has("threadCount") ? aim.iGet("threadCount") : 0);
+    team.chunk       = (aim.has("chunk")       ? aim.iGet("chunk")       : 0);
+
+    data_.pages = (aim.has("hugePages") ?
+                   pageTypeFromString(aim.get("hugePages")) :
+                   pageType::regular);
+
+    // [compact] and [scatter] pick the thread placement, loops stay static
+    const std::string schedule = (aim.has("schedule") ? aim.get("schedule") : "static");
+
+#if OCCA_OPENMP_ENABLED
+    if(schedule == "dynamic")
+      team.schedule = omp_sched_dynamic;
+    else if(schedule == "guided")
+      team.schedule = omp_sched_guided;
+    else if(schedule == "auto")
+      team.schedule = omp_sched_auto;
+    else
+      team.schedule = omp_sched_static;
+#else
+    team.schedule = 0;
+#endif
+
+    if(aim.has("pinnedCores")){
+      aim.iGets("pinnedCores", team.pinnedCores);
+
+      const int pinnedCount = team.pinnedCores.size();
+
+      if(team.threadCount == 0)
+        team.threadCount = pinnedCount;
+
+      if(pinnedCount != team.threadCount){
+        std::cout << "[OpenMP]: Mismatch between thread count and pinned cores\n"
+                  << "          Threads will not be pinned\n"
+                  << "  Thread Count: " << team.threadCount << '\n'
+                  << "  Pinned Cores: [";
+
+        if(pinnedCount){
+          std::cout << team.pinnedCores[0];
+
+          for(int i = 1; i < pinnedCount; ++i)
+            std::cout << ", " << team.pinnedCores[i];
+        }
+
+        std::cout << "]\n";
+
+        team.pinnedCores.clear();
+      }
+      else{
+        for(int i = 0; i < pinnedCount; ++i){
+          int &core = team.pinnedCores[i];
+
+          if((0 <= core) && (core < coreCount))
+            continue;
+
+          const int newCore = (((core % coreCount) + coreCount) % coreCount);
+
+          std::cout << "Trying to pin thread on core ["
+                    << core << "], changing it to ["
+                    << newCore << "]\n";
+
+          core = newCore;
+        }
+      }
+    }
+    else if((schedule == "compact") ||
+            (schedule == "scatter")){
+
+      if(team.threadCount == 0)
+        team.threadCount = coreCount;
+
+      for(int t = 0; t < team.threadCount; ++t){
+        if((schedule == "compact") || (coreCount <= team.threadCount))
+          team.pinnedCores.push_back(t % coreCount);
+        else
+          team.pinnedCores.push_back((t * coreCount) / team.threadCount);
+      }
+    }
+  }
 
   template <>
   deviceIdentifier device_t<OpenMP>::getIdentifier() const {
@@ -555,6 +1031,7 @@ namespace occa {
 
     dID.flagMap["compiler"]     = compiler;
     dID.flagMap["debugEnabled"] = (debugEnabled ? "true" : "false");
+    dID.flagMap["isa"]          = isaName(getHostISA());
 
     for(int i = 0; i <= 3; ++i){
       std::string flag = "-O";
@@ -596,6 +1073,12 @@ namespace occa {
 #  else
       compilerFlags = "";
 #  endif
+
+#  if OCCA_OPENMP_ENABLED
+      // Kernels share the library's OpenMP runtime
+      compilerFlags += ((compiler.find("icpc") != std::string::npos) ?
+                        " -qopenmp" : " -fopenmp");
+#  endif
     }
 #else
 #  if OCCA_DEBUG_ENABLED
@@ -668,6 +1151,9 @@ namespace occa {
   template <>
   void device_t<OpenMP>::waitFor(tag tag_){}
 
+  template <>
+  void device_t<OpenMP>::streamWaitFor(tag tag_){}
+
   template <>
   stream device_t<OpenMP>::createStream(){
     return NULL;
@@ -695,6 +1181,9 @@ namespace occa {
     return (endTag.tagTime - startTag.tagTime);
   }
 
+  template <>
+  void device_t<OpenMP>::freeTag(tag tag_){}
+
   template <>
   kernel_v* device_t<OpenMP>::buildKernelFromSource(const std::string &filename,
                                                     const std::string &functionName,
@@ -744,15 +1233,14 @@ namespace occa {
     info.addIncludeDefine("omp.h");
 #endif
 
-    info.addOCCAKeywords(occaOpenMPDefines);
-
     std::stringstream salt;
     salt << "OpenMP"
          << info.salt()
          << parser::version
          << compilerEnvScript
          << compiler
-         << compilerFlags;
+         << compilerFlags
+         << isaName(getHostISA());
 
     std::string cachedBinary = getCachedName(filename, salt.str());
 
@@ -793,6 +1281,48 @@ namespace occa {
     return k;
   }
 
+  template <>
+  void device_t<OpenMP>::runGraph(occa::graph &g){
+    const int nodeCount = g.size();
+
+    int start = 0;
+
+    while(start < nodeCount){
+      int end = start, teamKernels = 0;
+
+      for(; end < nodeCount; ++end){
+        graphNode_t &node = g.nodes[end];
+
+        if(node.type != graphNode::kernelLaunch)
+          continue;
+
+        if((node.k.mode_ != OpenMP) ||
+           !((OpenMPKernelData_t*) node.k.kHandle->data)->usesRegion){
+          break;
+        }
+
+        ++teamKernels;
+      }
+
+      if(teamKernels){
+        openMPTeamScope teamScope(((OpenMPDeviceData_t*) data)->team);
+
+#pragma omp parallel
+        runGraphInTeam(g, start, end);
+      }
+      else{
+        for(int i = start; i < end; ++i)
+          g.runNode(g.nodes[i]);
+      }
+
+      // Kernels with their own parallel for's are launched alone
+      if(end < nodeCount)
+        g.runNode(g.nodes[end++]);
+
+      start = end;
+    }
+  }
+
   template <>
   memory_v* device_t<OpenMP>::wrapMemory(void *handle_,
                                          const uintptr_t bytes){
@@ -807,6 +1337,16 @@ namespace occa {
     return mem;
   }
 
+  template <>
+  memory_v* device_t<OpenMP>::wrapHostMemory(void *ptr,
+                                             const uintptr_t bytes){
+    memory_v *mem = wrapMemory(ptr, bytes);
+
+    mem->wrapsHostPtr = true;
+
+    return mem;
+  }
+
   template <>
   memory_v* device_t<OpenMP>::wrapTexture(void *handle_,
                                           const int dim, const occa::dim &dims,
@@ -834,19 +1374,20 @@ namespace occa {
 
   template <>
   memory_v* device_t<OpenMP>::malloc(const uintptr_t bytes,
-                                     void *source){
+                                     void *source,
+                                     const int pages){
     memory_v *mem = new memory_t<OpenMP>;
 
     mem->dev  = dev;
     mem->size = bytes;
 
-#if   OCCA_OS == LINUX_OS
-    posix_memalign(&mem->handle, OCCA_MEM_ALIGN, bytes);
-#elif OCCA_OS == OSX_OS
-    mem->handle = ::malloc(bytes);
-#else
-    mem->handle = ::malloc(bytes);
-#endif
+    OpenMPDeviceData_t *dData = (OpenMPDeviceData_t*) data;
+
+    mem->handle = cpuMalloc(bytes,
+                            pages,
+                            (dData ? dData->pages : pageType::regular),
+                            mem->pageBytes,
+                            mem->mappedBytes);
 
     if(source != NULL)
       ::memcpy(mem->handle, source, bytes);
@@ -888,12 +1429,22 @@ namespace occa {
   }
 
   template <>
-  void device_t<OpenMP>::free(){}
+  void device_t<OpenMP>::free(){
+    if(data == NULL)
+      return;
+
+    delete (OpenMPDeviceData_t*) data;
+    data = NULL;
+  }
 
   template <>
   int device_t<OpenMP>::simdWidth(){
-    simdWidth_ = OCCA_SIMD_WIDTH;
-    return OCCA_SIMD_WIDTH;
+    if(simdWidth_)
+      return simdWidth_;
+
+    simdWidth_ = isaSimdWidth(getHostISA());
+
+    return simdWidth_;
   }
   //==================================
 };
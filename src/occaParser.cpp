@@ -3,13 +3,34 @@
 namespace occa {
   namespace parserNS {
     parserBase::parserBase(){
+      arenaScope scope(arena);
+
       parsingC = true;
 
       macrosAreInitialized = false;
+      macroDepth = 0;
+
       globalScope = new statement(*this);
 
       warnForMissingBarriers     = true;
       warnForBarrierConditionals = true;
+
+      const char *c_reportBarriers = getenv("OCCA_REPORT_BARRIERS");
+
+      warnForRemovedBarriers = ((c_reportBarriers != NULL) &&
+                                atoi(c_reportBarriers));
+    }
+
+    parserBase::~parserBase(){
+      kernelInfoIterator kIt = kernelInfoMap.begin();
+
+      while(kIt != kernelInfoMap.end()){
+        delete kIt->second;
+        ++kIt;
+      }
+
+      // Nodes are not freed individually, the whole translation goes at once
+      arena.release();
     }
 
     const std::string parserBase::parseFile(const std::string &filename,
@@ -26,7 +47,16 @@ namespace occa {
       return parsedContent;
     }
 
+    const std::string parserBase::parseSource(const std::string &source,
+                                              const bool parsingC_){
+      parsingC = parsingC_;
+
+      return parseSource(source.c_str());
+    }
+
     const std::string parserBase::parseSource(const char *cRoot){
+      arenaScope scope(arena);
+
       strNode *nodeRoot = splitAndPreprocessContent(cRoot);
       // nodeRoot->print();
       // throw 1;
@@ -46,6 +76,9 @@ namespace occa {
       // Broken
       // fixOccaForOrder();
 
+      if(parsingC)
+        minimizeBarriers();
+
       addOccaBarriers();
 
       addFunctionPrototypes();
@@ -61,8 +94,16 @@ namespace occa {
 
       loadKernelInfos();
 
+      // Exclusive declarations are checked before they become occaPrivate
+      applyToAllStatements(*globalScope, &parserBase::addSimdFors);
+
       applyToAllStatements(*globalScope, &parserBase::modifyExclusiveVariables);
 
+      addPointerArgQualifiers();
+
+      if(macroMap.has("OCCA_USING_CPU"))
+        copyScalarArgs();
+
       return (std::string) *globalScope;
     }
 
@@ -367,7 +408,7 @@ namespace occa {
         else if(stringsAreEqual(c, (cEnd - c), "ifdef")){
           std::string name = getMacroName(c);
 
-          if(macroMap.find(name) != macroMap.end())
+          if(macroMap.has(name))
             return (startHash | readUntilNextHash);
           else
             return (startHash | ignoreUntilNextHash);
@@ -376,7 +417,7 @@ namespace occa {
         else if(stringsAreEqual(c, (cEnd - c), "ifndef")){
           std::string name = getMacroName(c);
 
-          if(macroMap.find(name) != macroMap.end())
+          if(macroMap.has(name))
             return (startHash | ignoreUntilNextHash);
           else
             return (startHash | readUntilNextHash);
@@ -391,15 +432,15 @@ namespace occa {
             return state;
 
           std::string name = getMacroName(c);
-          int pos;
+          int pos = macroMap.find(name);
 
-          if(macroMap.find(name) == macroMap.end()){
+          if(pos == -1){
             pos = macros.size();
             macros.push_back( macroInfo() );
-            macroMap[name] = pos;
           }
-          else
-            pos = macroMap[name];
+
+          // Also invalidates memoized expansions
+          macroMap.set(name, pos);
 
           macroInfo &info = macros[pos];
           info.name = name;
@@ -415,8 +456,7 @@ namespace occa {
 
           std::string name = getMacroName(c);
 
-          if(macroMap.find(name) != macroMap.end())
-            macroMap.erase(name);
+          macroMap.erase(name);
 
           return state;
         }
@@ -443,103 +483,176 @@ namespace occa {
     }
 
     void parserBase::applyMacros(std::string &line){
-      const char *c = line.c_str();
-      std::string newLine = "";
+      std::string newLine;
+      newLine.reserve(line.size());
 
-      bool foundMacro = false;
+      expandMacros(line.c_str(), newLine);
+
+      line.swap(newLine);
+    }
 
+    // Expands [c] in one pass, macro bodies are expanded as they are
+    //   substituted rather than by rescanning the line
+    void parserBase::expandMacros(const char *c, std::string &newLine){
       while(*c != '\0'){
         const char *cStart = c;
 
         if(isAString(c)){
           skipString(c, parsingC);
 
-          newLine += std::string(cStart, (c - cStart));
+          newLine.append(cStart, (c - cStart));
           continue;
         }
 
         int delimeterChars = skipWord(c);
 
-        std::string word = std::string(cStart, c - cStart);
-
-        macroMapIterator it = macroMap.find(word);
+        int pos = macroMap.find(cStart, c - cStart);
 
         if((delimeterChars == 2) &&
-           stringsAreEqual(c, delimeterChars, "##") &&
-           it != macroMap.end()){
-          macroInfo &info = macros[it->second];
-          word = info.parts[0];
-        }
+           stringsAreEqual(c, delimeterChars, "##")){
 
-        while((delimeterChars == 2) &&
-              stringsAreEqual(c, delimeterChars, "##")){
-          c += 2;
+          std::string word = ((pos != -1) ?
+                              macros[pos].parts[0] :
+                              std::string(cStart, c - cStart));
 
-          cStart = c;
-          delimeterChars = skipWord(c);
+          while((delimeterChars == 2) &&
+                stringsAreEqual(c, delimeterChars, "##")){
+            c += 2;
 
-          std::string word2 = std::string(cStart, c - cStart);
+            cStart = c;
+            delimeterChars = skipWord(c);
 
-          it = macroMap.find(word2);
+            pos = macroMap.find(cStart, c - cStart);
 
-          if(it != macroMap.end()){
-            macroInfo &info = macros[it->second];
-            word += info.parts[0];
+            if(pos != -1)
+              word += macros[pos].parts[0];
+            else
+              word.append(cStart, c - cStart);
           }
-          else
-            word += word2;
-        }
-
-        it = macroMap.find(word);
 
-        if(it != macroMap.end()){
-          foundMacro = true;
+          pos = macroMap.find(word);
 
-          macroInfo &info = macros[it->second];
+          if(pos == -1)
+            newLine += word;
+        }
+        else if(pos == -1)
+          newLine.append(cStart, c - cStart);
 
-          if(!info.isAFunction)
-            newLine += info.parts[0];
+        if(pos != -1){
+          macroInfo &info = macros[pos];
 
+          // Self-referencing macros are left as-is
+          if(info.isExpanding)
+            newLine += info.name;
+          else if(!info.isAFunction)
+            expandObjectMacro(info, newLine);
           else{
-            std::vector<std::string> args;
-
-            ++c; // '('
+            const char *cArgs = c;
+            skipWhitespace(cArgs);
 
-            while(*c != '\0'){
-              skipWhitespace(c);
-              cStart = c;
-              skipWord(c);
-
-              args.push_back( std::string(cStart, c - cStart) );
-
-              skipWhitespace(c);
-
-              if(*(c++) == ')')
-                break;
+            if(*cArgs == '('){
+              c = cArgs;
+              expandFunctionMacro(info, c, newLine);
+              delimeterChars = 0;
             }
-
-            newLine += info.applyArgs(args);
+            else
+              newLine += info.name;
           }
         }
-        else
-          newLine += word;
 
         cStart = c;
         c += delimeterChars;
 
         if(cStart != c)
-          newLine += std::string(cStart, c - cStart);
+          newLine.append(cStart, c - cStart);
 
         if(isWhitespace(*c)){
           newLine += ' ';
           skipWhitespace(c);
         }
       }
+    }
+
+    // With [#define A B] and [#define B A x], B expands to [A x] inside A
+    //   but to [B x] on its own, so nested expansions aren't memoized
+    void parserBase::expandObjectMacro(macroInfo &info, std::string &newLine){
+      if(macroDepth){
+        ++macroDepth;
+        info.isExpanding = true;
+
+        expandMacros(info.parts[0].c_str(), newLine);
+
+        info.isExpanding = false;
+        --macroDepth;
+
+        return;
+      }
+
+      if(info.expandedGeneration != macroMap.generation){
+        std::string body;
+        body.reserve(info.parts[0].size());
+
+        ++macroDepth;
+        info.isExpanding = true;
+
+        expandMacros(info.parts[0].c_str(), body);
+
+        info.isExpanding = false;
+        --macroDepth;
+
+        info.expandedBody.swap(body);
+        info.expandedGeneration = macroMap.generation;
+      }
+
+      newLine += info.expandedBody;
+    }
+
+    void parserBase::expandFunctionMacro(macroInfo &info,
+                                         const char *&c,
+                                         std::string &newLine){
+      std::vector<std::string> args;
+
+      ++c; // '('
+
+      const char *cStart = c;
+      int depth = 0;
+
+      while(*c != '\0'){
+        if(isAString(c)){
+          skipString(c, parsingC);
+          continue;
+        }
+
+        if((*c == '(') || (*c == '[') || (*c == '{'))
+          ++depth;
+        else if(depth &&
+                ((*c == ')') || (*c == ']') || (*c == '}')))
+          --depth;
+        else if((depth == 0) &&
+                ((*c == ',') || (*c == ')'))){
+
+          args.push_back( strip(cStart, c - cStart) );
+
+          if(*(c++) == ')')
+            break;
+
+          cStart = c;
+          continue;
+        }
+
+        ++c;
+      }
+
+      // Substituted arguments are expanded along with the body
+      const std::string body = info.applyArgs(args);
 
-      line = newLine;
+      ++macroDepth;
+      info.isExpanding = true;
 
-      if(foundMacro)
-        applyMacros(line);
+      expandMacros(body.c_str(), newLine);
+
+      info.isExpanding = false;
+      --macroDepth;
     }
 
     strNode* parserBase::preprocessMacros(strNode *nodeRoot){
@@ -759,6 +872,9 @@ namespace occa {
         }
       }
 
+      globalScope->addTypedef("half");
+      globalScope->addTypedef("bfloat16");
+
       globalScope->addTypedef("void");
       globalScope->addTypedef("__builtin_va_list");
     }
@@ -1292,36 +1408,531 @@ namespace occa {
           statementNode *snPos     = firstLoop->right;
           lastLoop = statementPos;
 
-          while(snPos != lastLoop){
-            statement &s3 = *(snPos->value);
+          while(snPos != lastLoop){
+            statement &s3 = *(snPos->value);
+
+            if(s3.hasStatementWithBarrier())
+              break;
+
+            snPos = snPos->right;
+          }
+
+          if((snPos == lastLoop) &&
+             warnForMissingBarriers){
+
+            std::cout << "Warning: Placing a local barrier between:\n"
+                      << "---[ A ]--------------------------------\n"
+                      << *(firstLoop->value)
+                      << "---[ B ]--------------------------------\n"
+                      << *(lastLoop->value)
+                      << "========================================\n";
+
+            s.pushSourceLeftOf(lastLoop, "occaBarrier(occaLocalMemFence)");
+          }
+        }
+
+        statementPos = statementPos->right;
+      }
+    }
+
+    bool parserBase::statementHasBarrier(statement &s){
+      return s.hasBarrier();
+    }
+
+    //---[ Barrier Minimization ]-------
+    // Adjacent inner loops only separated by barriers are merged when
+    //   no work-item reads or writes what another one touched in the
+    //   other loop, removing the barriers and a sweep on CPU modes
+    void parserBase::minimizeBarriers(){
+      statementNode *statementPos = globalScope->statementStart;
+
+      while(statementPos){
+        statement *s = statementPos->value;
+
+        if(statementIsAKernel(*s)      && // Kernel
+           (s->statementStart != NULL)){  //   not empty
+
+          minimizeBarriersInStatement(*s);
+        }
+
+        statementPos = statementPos->right;
+      }
+    }
+
+    void parserBase::minimizeBarriersInStatement(statement &s){
+      statementNode *statementPos = s.statementStart;
+
+      while(statementPos){
+        statement &s2 = *(statementPos->value);
+
+        int occaType = statementOccaForNest(s2);
+
+        if((occaType == notAnOccaFor) ||
+           !(occaType & occaInnerForMask)){
+
+          minimizeBarriersInStatement(s2);
+
+          statementPos = statementPos->right;
+          continue;
+        }
+
+        // Only barriers can be between the loops
+        statementNode *snPos = statementPos->right;
+
+        int barriers = 0;
+        bool hasGlobalFence = false;
+
+        while(snPos                              &&
+              (snPos->value->statementStart == NULL) &&
+              snPos->value->hasBarrier()){
+
+          const std::string barrier = (std::string) snPos->value->expRoot;
+
+          if(barrier.find("occaGlobalMemFence") != std::string::npos)
+            hasGlobalFence = true;
+
+          ++barriers;
+          snPos = snPos->right;
+        }
+
+        if((snPos == NULL)                                   ||
+           !innerLoopsMatch(s2, *(snPos->value))              ||
+           !innerLoopsCanBeFused(s2, *(snPos->value), hasGlobalFence)){
+
+          statementPos = statementPos->right;
+          continue;
+        }
+
+        if(warnForRemovedBarriers){
+          std::cout << "Note: Merging inner-loops with no cross work-item dependence";
+
+          if(barriers)
+            std::cout << ", removing " << barriers
+                      << ((barriers == 1) ? " barrier" : " barriers");
+
+          std::cout << ":\n"
+                    << "---[ A ]--------------------------------\n"
+                    << s2
+                    << "---[ B ]--------------------------------\n"
+                    << *(snPos->value)
+                    << "========================================\n";
+        }
+
+        fuseInnerLoops(s, statementPos, snPos);
+
+        // Try merging the next loop too
+      }
+    }
+
+    // Follows [inner2] -> [inner1] -> [inner0] when each loop only holds the next one
+    statement* parserBase::getInnerMostOccaFor(statement &s){
+      statement *sPos = &s;
+
+      while((sPos->statementCount == 1) &&
+            statementIsAnOccaFor(*(sPos->statementStart->value))){
+
+        sPos = sPos->statementStart->value;
+      }
+
+      return sPos;
+    }
+
+    bool parserBase::innerLoopsMatch(statement &s1, statement &s2){
+      statement *sPos1 = &s1;
+      statement *sPos2 = &s2;
+
+      while(true){
+        const int occaType = statementOccaForNest(*sPos1);
+
+        if((occaType == notAnOccaFor)                ||
+           !(occaType & occaInnerForMask)            ||
+           (occaType != statementOccaForNest(*sPos2))){
+
+          return false;
+        }
+
+        for(int i = 0; i < 4; ++i){
+          const std::string forStatement1 = (std::string) *(sPos1->getForStatement(i));
+          const std::string forStatement2 = (std::string) *(sPos2->getForStatement(i));
+
+          if(forStatement1 != forStatement2)
+            return false;
+        }
+
+        // Work-items are only identified in [inner0]
+        if(occaType == (1 << occaInnerForShift))
+          return true;
+
+        if((sPos1->statementCount != 1) ||
+           (sPos2->statementCount != 1)){
+
+          return false;
+        }
+
+        sPos1 = sPos1->statementStart->value;
+        sPos2 = sPos2->statementStart->value;
+      }
+
+      return false;
+    }
+
+    bool parserBase::innerLoopsCanBeFused(statement &s1,
+                                          statement &s2,
+                                          const bool hasGlobalFence){
+      statement &sLoop1 = *(getInnerMostOccaFor(s1));
+      statement &sLoop2 = *(getInnerMostOccaFor(s2));
+
+      // Indices are only checked against the work-item for 1D loops
+      std::string iter;
+
+      if(&sLoop1 == &s1){
+        occaLoopInfo loopInfo(sLoop1, parsingC);
+        std::string start;
+
+        loopInfo.getLoopNode1Info(iter, start);
+      }
+
+      loopAccessVector_t accesses1, accesses2;
+
+      if(!addLoopAccesses(sLoop1, sLoop1, iter, false, accesses1) ||
+         !addLoopAccesses(sLoop2, sLoop2, iter, false, accesses2)){
+
+        return false;
+      }
+
+      const int accessCount1 = accesses1.size();
+      const int accessCount2 = accesses2.size();
+
+      for(int i = 0; i < accessCount1; ++i){
+        loopAccess_t &a1 = accesses1[i];
+
+        for(int j = 0; j < accessCount2; ++j){
+          loopAccess_t &a2 = accesses2[j];
+
+          if(!a1.isWrite && !a2.isWrite)
+            continue;
+
+          // Global pointers can alias each other if a global fence was asked for
+          const bool sameMemory = ((a1.var == a2.var) ||
+                                   (hasGlobalFence        &&
+                                    a1.var->pointerCount  &&
+                                    a2.var->pointerCount));
+
+          if(!sameMemory)
+            continue;
+
+          // Each work-item needs to stay on its own entry
+          if(!a1.isInjective ||
+             !a2.isInjective ||
+             (a1.index != a2.index)){
+
+            return false;
+          }
+        }
+      }
+
+      return true;
+    }
+
+    bool parserBase::addLoopAccesses(statement &s,
+                                     statement &sLoop,
+                                     const std::string &iter,
+                                     const bool inLoopScope,
+                                     loopAccessVector_t &accesses){
+      statementNode *statementPos = s.statementStart;
+
+      while(statementPos){
+        statement &s2 = *(statementPos->value);
+
+        const bool s2IsALoop = (inLoopScope ||
+                                (s2.info & (forStatementType   |
+                                            whileStatementType |
+                                            doWhileStatementType)));
+
+        const expNode &root = s2.expRoot;
+
+        // Leaving the work-item early would skip the other loop's body
+        if((root.info & (expType::return_ | expType::goto_)) ||
+           (((root.value == "break") || (root.value == "continue")) && !inLoopScope)){
+
+          return false;
+        }
+
+        expNode &flatRoot = *(s2.expRoot.makeFlatHandle());
+
+        // a[0] -> {a, [ {0}}, names are checked through their access
+        std::vector<expNode*> indexedNames;
+
+        for(int i = 0; i < flatRoot.leafCount; ++i){
+          expNode &n = flatRoot[i];
+
+          if((n.info & (expType::variable | expType::unknown)) &&
+             (n.value.size() == 0)                             &&
+             (1 < n.leafCount)){
+
+            indexedNames.push_back(n.leaves[0]);
+          }
+        }
+
+        bool isSafe = true;
+
+        for(int i = 0; i < flatRoot.leafCount; ++i){
+          expNode &n = flatRoot[i];
+
+          if((n.value == "occaBarrier") ||
+             (n.value == "return")      ||
+             (n.value == "goto")        ||
+             (((n.value == "break") || (n.value == "continue")) && !inLoopScope)){
+
+            isSafe = false;
+            break;
+          }
+
+          if(!(n.info & (expType::variable | expType::unknown)))
+            continue;
+
+          const bool isIndexed = ((n.value.size() == 0) && (1 < n.leafCount));
+
+          if(!isIndexed &&
+             ((n.leafCount != 0)      ||
+              (n.value.size() == 0)   ||
+              (std::find(indexedNames.begin(), indexedNames.end(), &n) != indexedNames.end()))){
+
+            continue;
+          }
+
+          const std::string &varName = (isIndexed ? n.leaves[0]->value : n.value);
+
+          varInfo *var = hasVariableInKernelScope(s2, varName);
+
+          // Unknown memory, can't tell which entries are touched
+          if((var == NULL) && isIndexed){
+            isSafe = false;
+            break;
+          }
+
+          if((var == NULL)                          ||
+             var->hasQualifier("exclusive")         ||
+             varIsLocalToLoop(*var, s2, sLoop)){
+
+            continue;
+          }
+
+          loopAccess_t access;
+
+          access.var         = var;
+          access.isWrite     = false;
+          access.isInjective = false;
+
+          if(isIndexed){
+            expNode &brackets = n[1];
+
+            access.index = (std::string) brackets;
+
+            if(iter.size()                 &&
+               (n.leafCount == 2)          &&
+               (brackets.leafCount == 1)   &&
+               (brackets[0].leafCount == 1)){
+
+              access.isInjective = indexIsInjective(brackets[0][0], s2, sLoop, iter);
+            }
+          }
+          else if(var->pointerCount || var->stackPointerCount){
+            // Passed or offset without an index, anything can be touched
+            access.isWrite = true;
+          }
+
+          expNode *upNode = &n;
+
+          while(upNode->up                       &&
+                ((upNode->up->value == ".") ||
+                 (upNode->up->value == "->"))   &&
+                (upNode->up->leaves[0] == upNode)){
+
+            upNode = upNode->up;
+          }
+
+          if(upNode->up){
+            const std::string &op = upNode->up->value;
+
+            if((isAnAssOperator(op) && (upNode->up->leaves[0] == upNode)) ||
+               (op == "++") ||
+               (op == "--")){
+
+              access.isWrite = true;
+            }
+            else if((op == "&") && (upNode->up->leafCount == 1)){
+              access.isWrite     = true;
+              access.isInjective = false;
+            }
+          }
+
+          accesses.push_back(access);
+        }
+
+        expNode::freeFlatHandle(flatRoot);
+
+        if(!isSafe ||
+           !addLoopAccesses(s2, sLoop, iter, s2IsALoop, accesses)){
+
+          return false;
+        }
+
+        statementPos = statementPos->right;
+      }
+
+      return true;
+    }
+
+    // [iter + c], [c + iter] and [iter - c] with [c] fixed in the loop
+    bool parserBase::indexIsInjective(expNode &exp,
+                                      statement &s,
+                                      statement &sLoop,
+                                      const std::string &iter){
+      if(exp.leafCount == 0)
+        return (exp.value == iter);
+
+      if((exp.value == "(") && (exp.leafCount == 1))
+        return indexIsInjective(exp[0], s, sLoop, iter);
+
+      if(exp.leafCount != 2)
+        return false;
+
+      if((exp.value == "+") || (exp.value == "-")){
+        if(indexIsInjective(exp[0], s, sLoop, iter) &&
+           expIsLoopInvariant(exp[1], s, sLoop, iter)){
+
+          return true;
+        }
+      }
+
+      if(exp.value == "+"){
+        if(expIsLoopInvariant(exp[0], s, sLoop, iter) &&
+           indexIsInjective(exp[1], s, sLoop, iter)){
+
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    bool parserBase::expIsLoopInvariant(expNode &exp,
+                                        statement &s,
+                                        statement &sLoop,
+                                        const std::string &iter){
+      if(exp.leafCount == 0){
+        if(exp.value == iter)
+          return false;
+
+        varInfo *var = hasVariableInKernelScope(s, exp.value);
+
+        return ((var == NULL) || !varIsLocalToLoop(*var, s, sLoop));
+      }
+
+      for(int i = 0; i < exp.leafCount; ++i){
+        if(!expIsLoopInvariant(exp[i], s, sLoop, iter))
+          return false;
+      }
+
+      return true;
+    }
+
+    // Kernel arguments are only kept in the kernel's varInfo
+    varInfo* parserBase::hasVariableInKernelScope(statement &s,
+                                                  const std::string &varName){
+      varInfo *var = s.hasVariableInScope(varName);
+
+      if(var)
+        return var;
+
+      statement *sKernel = getStatementKernel(s);
+
+      if(sKernel == NULL)
+        return NULL;
+
+      const int argc = sKernel->getFunctionArgCount();
+
+      for(int i = 0; i < argc; ++i){
+        varInfo &argVar = *(sKernel->getFunctionArgVar(i));
+
+        if(argVar.name == varName)
+          return &argVar;
+      }
+
+      return NULL;
+    }
+
+    bool parserBase::varIsLocalToLoop(varInfo &var,
+                                      statement &s,
+                                      statement &sLoop){
+      statement *sPos = &s;
+
+      while(sPos){
+        cScopeVarMapIterator it = sPos->scopeVarMap.find(var.name);
+
+        if((it != sPos->scopeVarMap.end()) &&
+           (it->second == &var)){
+
+          return true;
+        }
+
+        if(sPos == &sLoop)
+          break;
+
+        sPos = sPos->up;
+      }
+
+      return false;
+    }
+
+    void parserBase::fuseInnerLoops(statement &origin,
+                                    statementNode *snLoop1,
+                                    statementNode *snLoop2){
+      statement &sLoop1 = *(getInnerMostOccaFor(*(snLoop1->value)));
+      statement &sLoop2 = *(getInnerMostOccaFor(*(snLoop2->value)));
+
+      // The second body keeps its own scope, minus the loop iterator
+      statement &block = *(new statement(sLoop1.depth + 1,
+                                         blockStatementType,
+                                         &sLoop1));
+
+      block.scopeVarMap = sLoop2.scopeVarMap;
+
+      occaLoopInfo loopInfo(sLoop2, parsingC);
+      std::string iter, start;
+
+      loopInfo.getLoopNode1Info(iter, start);
+      block.scopeVarMap.erase(iter);
+
+      statementNode *snPos = sLoop2.statementStart;
+
+      while(snPos){
+        applyToAllStatements(*(snPos->value), &parserBase::incrementDepth);
+        block.addStatement(snPos->value);
+
+        snPos = snPos->right;
+      }
 
-            if(s3.hasStatementWithBarrier())
-              break;
+      sLoop1.addStatement(&block);
 
-            snPos = snPos->right;
-          }
+      // Remove the barriers and the second loop
+      statementNode *snEnd = snLoop2->right;
+      snPos = snLoop1->right;
 
-          if((snPos == lastLoop) &&
-             warnForMissingBarriers){
+      while(snPos != snEnd){
+        statementNode *snNext = snPos->right;
 
-            std::cout << "Warning: Placing a local barrier between:\n"
-                      << "---[ A ]--------------------------------\n"
-                      << *(firstLoop->value)
-                      << "---[ B ]--------------------------------\n"
-                      << *(lastLoop->value)
-                      << "========================================\n";
+        if(origin.statementEnd == snPos)
+          origin.statementEnd = snPos->left;
 
-            s.pushSourceLeftOf(lastLoop, "occaBarrier(occaLocalMemFence)");
-          }
-        }
+        snPos->pop();
+        --(origin.statementCount);
 
-        statementPos = statementPos->right;
+        snPos = snNext;
       }
     }
-
-    bool parserBase::statementHasBarrier(statement &s){
-      return s.hasBarrier();
-    }
+    //==================================
 
     void parserBase::fixOccaForStatementOrder(statement &origin,
                                               statementNode *sn){
@@ -1536,6 +2147,12 @@ namespace occa {
             if(argVar.pointerCount){
               if(!argVar.hasQualifier("occaPointer"))
                 argVar.addQualifier("occaPointer", 0);
+
+              // Alignment can't be set on arguments, it's passed to the SIMD loops
+              if(argVar.hasQualifier("occaAligned")){
+                argVar.removeQualifier("occaAligned");
+                argVar.info |= varType::alignedPointer;
+              }
             }
             else{
               if(!argVar.hasRightQualifier("occaVariable"))
@@ -1558,6 +2175,266 @@ namespace occa {
       }
     }
 
+    // Scalars are passed by reference in CPU modes (occaVariable), the
+    //   kernel works on a by-value copy so stores through pointer
+    //   arguments can't alias them
+    void parserBase::copyScalarArgs(){
+      statementNode *statementPos = globalScope->statementStart;
+
+      while(statementPos){
+        statement &s = *(statementPos->value);
+
+        if((s.info & functionDefinitionType) &&
+           (s.functionHasQualifier("occaKernel")) &&
+           (s.statementStart != NULL)){
+
+          const int argc = s.getFunctionArgCount();
+
+          for(int i = (argc - 1); 0 < i; --i){
+            varInfo &argVar = *(s.getFunctionArgVar(i));
+
+            if(argVar.pointerCount                          ||
+               (argVar.baseType == NULL)                    ||
+               (argVar.name.size() == 0)                    ||
+               !argVar.hasRightQualifier("occaVariable")){
+
+              continue;
+            }
+
+            const std::string argName = argVar.name;
+            const std::string refName = obfuscate("arg", argName);
+
+            std::string copySource;
+
+            const int qualifiers = argVar.leftQualifierCount();
+
+            for(int q = 0; q < qualifiers; ++q)
+              copySource += argVar.getLeftQualifier(q) + " ";
+
+            copySource += argVar.baseType->name + " " + argName + " = " + refName + ";";
+
+            // The copy takes the argument's name in the kernel scope
+            s.scopeVarMap.erase(argName);
+
+            argVar.name = refName;
+            s.scopeVarMap[refName] = &argVar;
+
+            s.pushSourceLeftOf(s.statementStart, copySource);
+          }
+        }
+
+        statementPos = statementPos->right;
+      }
+    }
+
+    //---[ Pointer Argument Uses ]------
+    namespace pointerArgUse {
+      static const int read    = 0;
+      static const int written = 1;
+      static const int escapes = 2; // Copied, offset or passed along
+    };
+
+    static bool isMemberAccess(expNode &e){
+      return ((e.info == expType::LR) &&
+              ((e.value == ".") || (e.value == "->")));
+    }
+
+    static bool isStrayOperator(expNode *e, const char *op){
+      return (e                                &&
+              (e->info & expType::qualifier) &&
+              (e->leafCount == 0)              &&
+              (e->value == op));
+    }
+
+    // [path] holds the argument's node and its ancestors, [prevLeaf] is
+    //   the leaf before it in the source
+    // The parser leaves unary & and * as leaves before their operand
+    // Only a[...] and *a accesses are tracked, anything else escapes
+    static int pointerArgUseAt(std::vector<expNode*> &path,
+                               expNode *prevLeaf){
+      int pos = (path.size() - 1);
+
+      // s.a is a member, not the argument
+      if(pos &&
+         isMemberAccess(*(path[pos - 1])) &&
+         (path[pos - 1]->leaves[1] == path[pos])){
+
+        return pointerArgUse::read;
+      }
+
+      if((pos == 0) || isStrayOperator(prevLeaf, "&"))
+        return pointerArgUse::escapes;
+
+      expNode &up = *(path[pos - 1]);
+
+      const bool subscripted = ((up.info & expType::variable) &&
+                                (1 < up.leafCount)            &&
+                                (up.leaves[0] == path[pos]));
+
+      const bool derefNode = ((up.info == expType::L) && (up.value == "*"));
+
+      if(subscripted || derefNode)
+        --pos;
+      else if(!isStrayOperator(prevLeaf, "*"))
+        return pointerArgUse::escapes;
+
+      // a[i].x
+      while(pos &&
+            isMemberAccess(*(path[pos - 1])) &&
+            (path[pos - 1]->leaves[0] == path[pos])){
+
+        --pos;
+      }
+
+      if(pos == 0)
+        return pointerArgUse::read;
+
+      expNode &user = *(path[pos - 1]);
+
+      // Calling through an element can write through it
+      for(int i = 0; i < (user.leafCount - 1); ++i){
+        if((user.leaves[i] == path[pos])             &&
+           (user.leaves[i + 1]->info & expType::C) &&
+           (user.leaves[i + 1]->value == "(")){
+
+          return pointerArgUse::escapes;
+        }
+      }
+
+      if(((user.info == expType::L) || (user.info == expType::R)) &&
+         ((user.value == "++") || (user.value == "--"))){
+
+        // *a++ moves the pointer
+        return ((subscripted || derefNode) ?
+                pointerArgUse::written : pointerArgUse::escapes);
+      }
+
+      if((user.info == expType::LR)    &&
+         (user.leaves[0] == path[pos]) &&
+         isAnAssOperator(user.value)){
+
+        return pointerArgUse::written;
+      }
+
+      return pointerArgUse::read;
+    }
+
+    static int pointerArgUseIn(expNode &e,
+                               const std::string &name,
+                               std::vector<expNode*> &path,
+                               expNode *&prevLeaf){
+      if(e.info & (expType::varInfo |
+                   expType::typeInfo)){
+
+        return pointerArgUse::read;
+      }
+
+      path.push_back(&e);
+
+      int use = pointerArgUse::read;
+
+      if((e.leafCount == 0)                                   &&
+         (e.info & (expType::variable | expType::unknown)) &&
+         (e.value == name)){
+
+        use = pointerArgUseAt(path, prevLeaf);
+      }
+
+      // Leaves are visited in source order, -a and (a) start with [e]
+      if((e.info == expType::L) ||
+         ((e.info & expType::C) && !(e.info & expType::R))){
+
+        prevLeaf = &e;
+      }
+
+      for(int i = 0; (i < e.leafCount) && (use != pointerArgUse::escapes); ++i){
+        use = std::max(use, pointerArgUseIn(*(e.leaves[i]), name, path, prevLeaf));
+
+        // a + b
+        if((i == 0) && (e.info == expType::LR))
+          prevLeaf = &e;
+      }
+
+      // Casts count as one leaf so (T*) a isn't a dereference
+      if((e.leafCount == 0) || (e.info & expType::cast_))
+        prevLeaf = &e;
+
+      path.pop_back();
+
+      return use;
+    }
+
+    static int pointerArgUseIn(statementNode *snPos,
+                               const std::string &name){
+      std::vector<expNode*> path;
+      int use = pointerArgUse::read;
+
+      while(snPos && (use != pointerArgUse::escapes)){
+        statement &s = *(snPos->value);
+        expNode *prevLeaf = NULL;
+
+        use = std::max(use, pointerArgUseIn(s.expRoot, name, path, prevLeaf));
+
+        if(use != pointerArgUse::escapes)
+          use = std::max(use, pointerArgUseIn(s.statementStart, name));
+
+        snPos = snPos->right;
+      }
+
+      return use;
+    }
+    //==================================
+
+    // Pointers only read are marked const, restrict is added with
+    //   OCCA_RESTRICT_ARGS since aliasing between arguments is up to the caller
+    void parserBase::addPointerArgQualifiers(){
+      const bool addRestrict = macroMap.has("OCCA_RESTRICT_ARGS");
+
+      statementNode *statementPos = globalScope->statementStart;
+
+      while(statementPos){
+        statement &s = *(statementPos->value);
+
+        if((s.info & functionDefinitionType) &&
+           (s.functionHasQualifier("occaKernel"))){
+
+          const int argc = s.getFunctionArgCount();
+
+          for(int i = 1; i < argc; ++i){
+            varInfo &argVar = *(s.getFunctionArgVar(i));
+
+            if((argVar.pointerCount != 1)           ||
+               (argVar.name.size() == 0)            ||
+               !argVar.hasQualifier("occaPointer")){
+
+              continue;
+            }
+
+            const int use = pointerArgUseIn(s.statementStart, argVar.name);
+
+            if(use == pointerArgUse::escapes)
+              continue;
+
+            if((use == pointerArgUse::read)      &&
+               !argVar.hasQualifier("occaConst") &&
+               !argVar.hasQualifier("const")){
+
+              argVar.addQualifier("occaConst",
+                                  argVar.hasQualifier("occaPointer") ? 1 : 0);
+            }
+
+            if(addRestrict &&
+               !argVar.hasRightQualifier("occaRestrict")){
+
+              argVar.addRightQualifier("occaRestrict");
+            }
+          }
+        }
+
+        statementPos = statementPos->right;
+      }
+    }
+
     void parserBase::modifyExclusiveVariables(statement &s){
       if( !(s.info & declareStatementType)   ||
           (getStatementKernel(s) == NULL)    ||
@@ -1578,7 +2455,7 @@ namespace occa {
       newVar0.leftQualifiers.clear();
       newVar0.baseType = NULL;
 
-      bool *keepVar = new bool[argc];
+      bool *keepVar = arenaNewArray<bool>(argc);
       int varsKept = 0;
 
       for(int i = 0; i < argc; ++i){
@@ -1673,6 +2550,174 @@ namespace occa {
       s.statementCount = 0;
     }
 
+    // Tags [occaInnerFor0] loops with [occaSimdFor0] on CPU modes
+    //   Work-items between barriers are independent, the loop is only
+    //   left alone if it can't be a SIMD loop (break, return, goto, barriers)
+    //   or if exclusive variables are in scope, occaPrivate indexes through
+    //   references to the inner ids which [omp simd] privatizes
+    void parserBase::addSimdFors(statement &s){
+      if(scopeHasExclusives(s))
+        return;
+
+      statementNode *statementPos = s.statementStart;
+
+      while(statementPos){
+        statement &s2 = *(statementPos->value);
+
+        if((s2.info == occaForType)              &&
+           (s2.expRoot.value == "occaInnerFor0") &&
+           !statementHasExclusives(s2)           &&
+           statementIsSimdSafe(s2, false)){
+
+          statement *sKernel = getStatementKernel(s2);
+
+          if((sKernel == NULL) ||
+             statementKernelUsesNativeOCCA(s2)){
+
+            statementPos = statementPos->right;
+            continue;
+          }
+
+          std::string alignedArgs;
+
+          const int argc = sKernel->getFunctionArgCount();
+
+          for(int i = 0; i < argc; ++i){
+            varInfo &argVar = *(sKernel->getFunctionArgVar(i));
+
+            if(argVar.info & varType::alignedPointer){
+
+              if(alignedArgs.size())
+                alignedArgs += ", ";
+
+              alignedArgs += argVar.name;
+            }
+          }
+
+          if(alignedArgs.size())
+            s.pushSourceLeftOf(statementPos, "occaAlignedSimdFor0(" + alignedArgs + ")");
+          else
+            s.pushSourceLeftOf(statementPos, "occaSimdFor0");
+        }
+
+        statementPos = statementPos->right;
+      }
+    }
+
+    bool parserBase::scopeHasExclusives(statement &s){
+      statement *sUp = &s;
+
+      while(sUp){
+        statementNode *statementPos = sUp->statementStart;
+
+        while(statementPos){
+          statement &s2 = *(statementPos->value);
+
+          if((s2.info & declareStatementType) &&
+             s2.hasQualifier("exclusive")){
+
+            return true;
+          }
+
+          statementPos = statementPos->right;
+        }
+
+        sUp = sUp->up;
+      }
+
+      return false;
+    }
+
+    // Exclusive variables declared or used in [s], nested blocks included
+    bool parserBase::statementHasExclusives(statement &s){
+      if((s.info & declareStatementType) &&
+         s.hasQualifier("exclusive")){
+
+        return true;
+      }
+
+      expNode &flatRoot = *(s.expRoot.makeFlatHandle());
+
+      bool hasExclusives = false;
+
+      for(int i = 0; i < flatRoot.leafCount; ++i){
+        expNode &n = flatRoot[i];
+        varInfo *var = NULL;
+
+        if(n.info & expType::varInfo)
+          var = &(n.getVarInfo());
+        else if(n.info & (expType::variable | expType::unknown))
+          var = s.hasVariableInScope(n.value);
+
+        if(var && var->hasQualifier("exclusive")){
+          hasExclusives = true;
+          break;
+        }
+      }
+
+      expNode::freeFlatHandle(flatRoot);
+
+      if(hasExclusives)
+        return true;
+
+      statementNode *statementPos = s.statementStart;
+
+      while(statementPos){
+        if(statementHasExclusives(*(statementPos->value)))
+          return true;
+
+        statementPos = statementPos->right;
+      }
+
+      return false;
+    }
+
+    bool parserBase::statementIsSimdSafe(statement &s, const bool inBreakableScope){
+      statementNode *statementPos = s.statementStart;
+
+      while(statementPos){
+        statement &s2 = *(statementPos->value);
+
+        const bool s2IsBreakable = (inBreakableScope                   ||
+                                    (s2.info & (forStatementType   |
+                                                whileStatementType |
+                                                switchStatementType)));
+
+        // Keyword-only statements have no leaves to flatten
+        if((s2.expRoot.info & (expType::return_ | expType::goto_)) ||
+           ((s2.expRoot.value == "break") && !inBreakableScope)){
+
+          return false;
+        }
+
+        expNode &flatRoot = *(s2.expRoot.makeFlatHandle());
+
+        bool isSafe = true;
+
+        for(int i = 0; i < flatRoot.leafCount; ++i){
+          const std::string &value = flatRoot[i].value;
+
+          if((value == "occaBarrier") ||
+             (value == "return")      ||
+             (value == "goto")        ||
+             ((value == "break") && !inBreakableScope)){
+
+            isSafe = false;
+            break;
+          }
+        }
+
+        expNode::freeFlatHandle(flatRoot);
+
+        if(!isSafe || !statementIsSimdSafe(s2, s2IsBreakable))
+          return false;
+
+        statementPos = statementPos->right;
+      }
+
+      return true;
+    }
+
     void parserBase::modifyTextureVariables(){
     }
 
@@ -1687,6 +2732,8 @@ namespace occa {
       statementVector_t loopStatements;
       intVector_t loopStatementIDs, loopOffsets, innerDims, outerDims;
 
+      std::vector<statementNode*> launchNodes;
+
       std::stringstream ss;
 
       sKernel.setStatementIdMap(idMap);
@@ -1929,6 +2976,8 @@ namespace occa {
 
           blockStatement->addStatementsFromSource(ss.str());
 
+          launchNodes.push_back(blockStatement->statementEnd->left);
+
           ss.str("");
 
           blockStatement = NULL;
@@ -1938,6 +2987,23 @@ namespace occa {
       sKernel.statementStart = newStatementStart.right;
       sKernel.statementEnd   = lastNode(sKernel.statementStart);
 
+      //---[ Add OpenMP region ]--------
+      // With OCCA_USING_OPENMP_REGION, every thread of the team opened by
+      //   kernel_t<OpenMP> runs the launcher and the outer loops of the
+      //   nested kernels become omp for's
+      if(loopCount){
+        info.usesRegion = true;
+
+        // Only one thread sets the working dims
+        const int launches = launchNodes.size();
+
+        for(int i = 0; i < launches; ++i){
+          statement &block = *(launchNodes[i]->value->up);
+
+          block.pushSourceLeftOf(launchNodes[i], "occaParallelSingle");
+        }
+      }
+
       //---[ Add kernel guards ]--------
       sKernel.up->pushSourceLeftOf(snKernel , "#if OCCA_USING_OPENMP");
       sKernel.up->pushSourceRightOf(snKernel, "#endif");
@@ -2544,7 +3610,7 @@ namespace occa {
       if(argPos){
         statement &s = origin.pushNewStatementLeft(declareStatementType);
         s.expRoot.info      = origin.expRoot.info;
-        s.expRoot.leaves    = new expNode*[argPos];
+        s.expRoot.leaves    = arenaNewArray<expNode*>(argPos);
         s.expRoot.leafCount = argPos;
 
         for(int i = 0; i < argPos; ++i){
@@ -2560,7 +3626,7 @@ namespace occa {
 
         statement &s = origin.pushNewStatementLeft(declareStatementType);
         s.expRoot.info      = origin.expRoot.info;
-        s.expRoot.leaves    = new expNode*[newLeafCount];
+        s.expRoot.leaves    = arenaNewArray<expNode*>(newLeafCount);
         s.expRoot.leafCount = newLeafCount;
 
         for(int i = 0; i < newLeafCount; ++i){
@@ -3461,6 +4527,10 @@ namespace occa {
         cKeywordType[std::string("double") + suffix[i]] = specifierType;
       }
 
+      // Storage-only 16-bit floats
+      cKeywordType["half"]     = specifierType;
+      cKeywordType["bfloat16"] = specifierType;
+
       cKeywordType["void"]          = specifierType;
       cKeywordType["__attribute__"] = specifierType; // [--]
 
@@ -0,0 +1,148 @@
+#include "occaParserArena.hpp"
+
+namespace occa {
+  namespace parserNS {
+    //---[ Parser Arena ]---------------------------
+    // Keep the payload 16-byte aligned
+    const size_t parserArena::headerBytes       = ((sizeof(allocHeader_t) + 15) & ~((size_t) 15));
+    const size_t parserArena::blockHeaderBytes  = ((sizeof(block_t)       + 15) & ~((size_t) 15));
+    const size_t parserArena::defaultBlockBytes = (256 << 10);
+
+    parserArena *parserArena::current = NULL;
+
+    parserArena::parserArena() :
+      blocks(NULL),
+      allocs(NULL),
+
+      bytesAllocated(0),
+      bytesReserved(0),
+      liveAllocs(0) {}
+
+    parserArena::~parserArena(){
+      release();
+    }
+
+    void* parserArena::allocate(const size_t bytes,
+                                arenaDestructor_t destructor){
+      const size_t allocBytes = ((headerBytes + bytes + 15) & ~((size_t) 15));
+
+      block_t *block = blocks;
+
+      if((block == NULL) ||
+         (block->bytes < (block->used + allocBytes))){
+
+        block = newBlock((defaultBlockBytes < allocBytes) ?
+                         allocBytes : defaultBlockBytes);
+
+        // Oversized allocations get their own block,
+        //   keep the partially-used block in front
+        if(blocks && (defaultBlockBytes < allocBytes)){
+          block->next  = blocks->next;
+          blocks->next = block;
+        }
+        else{
+          block->next = blocks;
+          blocks      = block;
+        }
+      }
+
+      allocHeader_t *header = (allocHeader_t*) (((char*) block) + blockHeaderBytes + block->used);
+
+      block->used += allocBytes;
+
+      header->arena      = this;
+      header->destructor = destructor;
+      header->next       = allocs;
+      header->isAlive    = 1;
+
+      allocs = header;
+
+      bytesAllocated += allocBytes;
+      ++liveAllocs;
+
+      return (((char*) header) + headerBytes);
+    }
+
+    parserArena::block_t* parserArena::newBlock(const size_t bytes){
+      block_t *block = (block_t*) ::malloc(blockHeaderBytes + bytes);
+
+      if(block == NULL){
+        std::cout << "Parser arena could not allocate [" << bytes << "] bytes\n";
+        throw 1;
+      }
+
+      block->next  = NULL;
+      block->bytes = bytes;
+      block->used  = 0;
+
+      bytesReserved += bytes;
+
+      return block;
+    }
+
+    void parserArena::release(){
+      // Destructors only free members (strings, maps, ...),
+      //   node links are never followed
+      allocHeader_t *header = allocs;
+
+      while(header){
+        if(header->isAlive && header->destructor)
+          header->destructor(((char*) header) + headerBytes);
+
+        header = header->next;
+      }
+
+      while(blocks){
+        block_t *next = blocks->next;
+        ::free(blocks);
+        blocks = next;
+      }
+
+      allocs = NULL;
+
+      bytesAllocated = 0;
+      bytesReserved  = 0;
+      liveAllocs     = 0;
+    }
+
+    void* parserArena::alloc(const size_t bytes,
+                             arenaDestructor_t destructor){
+      if(current)
+        return current->allocate(bytes, destructor);
+
+      allocHeader_t *header = (allocHeader_t*) ::malloc(headerBytes + bytes);
+
+      if(header == NULL){
+        std::cout << "Parser could not allocate [" << bytes << "] bytes\n";
+        throw 1;
+      }
+
+      header->arena      = NULL;
+      header->destructor = destructor;
+      header->next       = NULL;
+      header->isAlive    = 1;
+
+      return (((char*) header) + headerBytes);
+    }
+
+    void parserArena::dealloc(void *ptr){
+      if(ptr == NULL)
+        return;
+
+      allocHeader_t *header = headerOf(ptr);
+
+      // Arena memory is reclaimed when the arena is released
+      if(header->arena){
+        header->isAlive = 0;
+        --(header->arena->liveAllocs);
+      }
+      else
+        ::free(header);
+    }
+
+    parserArena::allocHeader_t* parserArena::headerOf(void *ptr){
+      return (allocHeader_t*) (((char*) ptr) - headerBytes);
+    }
+    //==============================================
+  };
+};
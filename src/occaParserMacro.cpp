@@ -648,7 +648,9 @@ namespace occa {
 
 
     //---[ Macro Info ]-----------------------------
-    macroInfo::macroInfo(){};
+    macroInfo::macroInfo() :
+      expandedGeneration(-1),
+      isExpanding(false) {};
 
     std::string macroInfo::applyArgs(const std::vector<std::string> &args){
         if(argc != args.size()){
@@ -691,5 +693,123 @@ namespace occa {
         return out;
       }
     //==============================================
+
+
+    //---[ Macro Table ]----------------------------
+    macroTable::macroTable() :
+      buckets(64, -1),
+      generation(0) {}
+
+    // FNV-1a
+    unsigned int macroTable::hash(const char *c, const size_t chars){
+      unsigned int h = 2166136261u;
+
+      for(size_t i = 0; i < chars; ++i){
+        h ^= (unsigned char) c[i];
+        h *= 16777619u;
+      }
+
+      return h;
+    }
+
+    int macroTable::find(const char *c, const size_t chars) const {
+      if(chars == 0)
+        return -1;
+
+      const unsigned int h = hash(c, chars);
+
+      int e = buckets[h & (buckets.size() - 1)];
+
+      while(e != -1){
+        const entry_t &entry = entries[e];
+
+        if((entry.hash == h)            &&
+           (entry.name.size() == chars) &&
+           (entry.name.compare(0, chars, c, chars) == 0)){
+
+          return entry.pos;
+        }
+
+        e = entry.next;
+      }
+
+      return -1;
+    }
+
+    int macroTable::find(const std::string &name) const {
+      return find(name.c_str(), name.size());
+    }
+
+    bool macroTable::has(const std::string &name) const {
+      return (find(name) != -1);
+    }
+
+    void macroTable::set(const std::string &name, const int pos){
+      ++generation;
+
+      const unsigned int h = hash(name.c_str(), name.size());
+
+      int e = buckets[h & (buckets.size() - 1)];
+
+      // Reuse the entry if the name was seen before (even if #undef'd)
+      while(e != -1){
+        entry_t &entry = entries[e];
+
+        if((entry.hash == h) && (entry.name == name)){
+          entry.pos = pos;
+          return;
+        }
+
+        e = entry.next;
+      }
+
+      if(buckets.size() <= entries.size())
+        rehash(2 * buckets.size());
+
+      entry_t entry;
+      entry.name = name;
+      entry.hash = h;
+      entry.pos  = pos;
+
+      int &bucket = buckets[h & (buckets.size() - 1)];
+
+      entry.next = bucket;
+      bucket     = entries.size();
+
+      entries.push_back(entry);
+    }
+
+    void macroTable::erase(const std::string &name){
+      ++generation;
+
+      const unsigned int h = hash(name.c_str(), name.size());
+
+      int e = buckets[h & (buckets.size() - 1)];
+
+      while(e != -1){
+        entry_t &entry = entries[e];
+
+        if((entry.hash == h) && (entry.name == name)){
+          entry.pos = -1;
+          return;
+        }
+
+        e = entry.next;
+      }
+    }
+
+    void macroTable::rehash(const int bucketCount){
+      buckets.assign(bucketCount, -1);
+
+      const int entryCount = entries.size();
+
+      for(int e = 0; e < entryCount; ++e){
+        int &bucket = buckets[entries[e].hash & (bucketCount - 1)];
+
+        entries[e].next = bucket;
+        bucket          = e;
+      }
+    }
+    //==============================================
   };
 };
@@ -566,11 +566,11 @@ namespace occa {
 
       delete &((*this)[0][0]);
       delete &((*this)[0]);
-      delete [] leaves;
+      arenaDeleteArray(leaves);
 
       info = expType::return_;
 
-      leaves    = new expNode*[2];
+      leaves    = arenaNewArray<expNode*>(2);
       leafCount = 2;
 
       leaves[0] = new expNode(*this);
@@ -783,7 +783,7 @@ namespace occa {
 
       nodePos = nodeRoot;
 
-      leaves = new expNode*[leafCount];
+      leaves = arenaNewArray<expNode*>(leafCount);
       int leafPos = 0;
 
       while(nodePos){
@@ -875,7 +875,7 @@ namespace occa {
 
       nodePos = nodeRoot;
 
-      leaves = new expNode*[leafCount];
+      leaves = arenaNewArray<expNode*>(leafCount);
       int leafPos = 0;
 
       while(nodePos){
@@ -1111,7 +1111,7 @@ namespace occa {
       newLeaf->up        = this;
       newLeaf->info      = newLeafType;
       newLeaf->leafCount = (leafPosEnd - leafPosStart + 1);
-      newLeaf->leaves    = new expNode*[newLeaf->leafCount];
+      newLeaf->leaves    = arenaNewArray<expNode*>(newLeaf->leafCount);
 
       for(int i = 0; i < newLeaf->leafCount; ++i){
         newLeaf->leaves[i]     = leaves[leafPosStart + i];
@@ -1326,7 +1326,7 @@ namespace occa {
             newLeaf->up        = this;
             newLeaf->info      = expType::variable;
             newLeaf->leafCount = 2;
-            newLeaf->leaves    = new expNode*[2];
+            newLeaf->leaves    = arenaNewArray<expNode*>(2);
           }
 
           expNode *sNewLeaf = new expNode(*newLeaf);
@@ -1334,7 +1334,7 @@ namespace occa {
           sNewLeaf->up        = newLeaf;
           sNewLeaf->info      = expType::qualifier;
           sNewLeaf->leafCount = brackets;
-          sNewLeaf->leaves    = new expNode*[brackets];
+          sNewLeaf->leaves    = arenaNewArray<expNode*>(brackets);
 
           if(inserting){
             newLeaf->addNode(expType::qualifier);
@@ -1392,7 +1392,7 @@ namespace occa {
 
       leaf->info      = expType::L;
       leaf->leafCount = 1;
-      leaf->leaves    = new expNode*[1];
+      leaf->leaves    = arenaNewArray<expNode*>(1);
       leaf->leaves[0] = sLeaf;
 
       sLeaf->up = leaf;
@@ -1417,7 +1417,7 @@ namespace occa {
 
       leaf->info      = expType::R;
       leaf->leafCount = 1;
-      leaf->leaves    = new expNode*[1];
+      leaf->leaves    = arenaNewArray<expNode*>(1);
       leaf->leaves[0] = sLeaf;
 
       sLeaf->up = leaf;
@@ -1443,7 +1443,7 @@ namespace occa {
 
       leaf->info      = (expType::L | expType::R);
       leaf->leafCount = 2;
-      leaf->leaves    = new expNode*[2];
+      leaf->leaves    = arenaNewArray<expNode*>(2);
       leaf->leaves[0] = sLeafL;
       leaf->leaves[1] = sLeafR;
 
@@ -1472,7 +1472,7 @@ namespace occa {
 
       leaf->info      = (expType::L | expType::C | expType::R);
       leaf->leafCount = 3;
-      leaf->leaves    = new expNode*[3];
+      leaf->leaves    = arenaNewArray<expNode*>(3);
       leaf->leaves[0] = sLeafL;
       leaf->leaves[1] = sLeafC;
       leaf->leaves[2] = sLeafR;
@@ -1616,7 +1616,7 @@ namespace occa {
               leaf.value = "[";
 
               if(leaf.leafCount){
-                delete [] leaf.leaves;
+                arenaDeleteArray(leaf.leaves);
                 leaf.leafCount = 0;
               }
 
@@ -1660,7 +1660,7 @@ namespace occa {
               lcpLeaf.addNode(expType::presetValue, "1");
             }
 
-            delete [] newExp.leaves;
+            arenaDeleteArray(newExp.leaves);
 
             leafPos += (entries - 1);
           }
@@ -1837,7 +1837,7 @@ namespace occa {
         }
 
         if(leafCount){
-          newExp.leaves = new expNode*[leafCount];
+          newExp.leaves = arenaNewArray<expNode*>(leafCount);
 
           for(int i = 0; i < leafCount; ++i)
             newExp.leaves[i] = newExp.clone(leaves[i]);
@@ -1903,7 +1903,7 @@ namespace occa {
         return flatNode;
 
       flatNode->info   = expType::printLeaves;
-      flatNode->leaves = new expNode*[nestedLeafCount()];
+      flatNode->leaves = arenaNewArray<expNode*>(nestedLeafCount());
 
       int offset = 0;
       makeFlatHandle(offset, flatNode->leaves);
@@ -1971,7 +1971,7 @@ namespace occa {
 
     void expNode::freeFlatHandle(expNode &flatRoot){
       if(flatRoot.leafCount)
-        delete [] flatRoot.leaves;
+        arenaDeleteArray(flatRoot.leaves);
 
       delete &flatRoot;
     }
@@ -2025,7 +2025,7 @@ namespace occa {
     void expNode::reserveAndShift(const int pos,
                                   const int count){
 
-      expNode **newLeaves = new expNode*[leafCount + count];
+      expNode **newLeaves = arenaNewArray<expNode*>(leafCount + count);
 
       //---[ Add Leaves ]-----
       for(int i = 0; i < pos; ++i)
@@ -2036,7 +2036,7 @@ namespace occa {
       //======================
 
       if(leafCount)
-        delete [] leaves;
+        arenaDeleteArray(leaves);
 
       leaves = newLeaves;
 
@@ -2442,7 +2442,7 @@ namespace occa {
         if(info & expType::typeInfo)
           delete (typeInfo*) leaves[0];
 
-        delete [] leaves;
+        arenaDeleteArray(leaves);
 
         return;
       }
@@ -2453,7 +2453,7 @@ namespace occa {
       }
 
       leafCount = 0;
-      delete [] leaves;
+      arenaDeleteArray(leaves);
     }
 
     void expNode::print(const std::string &tab){
@@ -2863,14 +2863,14 @@ namespace occa {
                    (leafCount - leafPos));
 
       expNode **trueLeaves = leaves;
-      leaves = new expNode*[leafCount];
+      leaves = arenaNewArray<expNode*>(leafCount);
 
       for(int i = 0; i < leafCount; ++i)
         leaves[i] = trueLeaves[leafPos + i];
 
       std::string ret = (std::string) *this;
 
-      delete [] leaves;
+      arenaDeleteArray(leaves);
 
       info = trueInfo;
 
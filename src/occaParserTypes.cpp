@@ -778,7 +778,7 @@ namespace occa {
       }
 
       if(argumentCount){
-        v.argumentVarInfos = new varInfo*[argumentCount];
+        v.argumentVarInfos = arenaNewArray<varInfo*>(argumentCount);
 
         for(int i = 0; i < argumentCount; ++i)
           v.argumentVarInfos[i] = new varInfo(argumentVarInfos[i]->clone());
@@ -1014,7 +1014,7 @@ namespace occa {
         int sLeafPos  = 0;
 
         argumentCount    = 1 + typeInfo::delimeterCount(leaf, ",");
-        argumentVarInfos = new varInfo*[argumentCount];
+        argumentVarInfos = arenaNewArray<varInfo*>(argumentCount);
 
         for(int i = 0; i < argumentCount; ++i){
           argumentVarInfos[i] = new varInfo();
@@ -1050,7 +1050,7 @@ namespace occa {
           argumentCount = (leaf.leafCount + 1)/2;
 
           if(argumentCount)
-            argumentVarInfos = new varInfo*[argumentCount];
+            argumentVarInfos = arenaNewArray<varInfo*>(argumentCount);
 
           for(int i = 0; i < argumentCount; ++i){
             argumentVarInfos[i] = new varInfo();
@@ -1204,7 +1204,7 @@ namespace occa {
       stackExp.info  = expType::C;
       stackExp.value = "[";
 
-      stackExp.leaves    = new expNode*[1];
+      stackExp.leaves    = arenaNewArray<expNode*>(1);
       stackExp.leafCount = 1;
 
       stackExp.leaves[0] = &valueExp;
@@ -1404,7 +1404,7 @@ namespace occa {
         nodePos = nodePos->down;
 
         argumentCount    = variablesInStatement(nodePos);
-        argumentVarInfos = new varInfo*[argumentCount];
+        argumentVarInfos = arenaNewArray<varInfo*>(argumentCount);
 
         for(int i = 0; i < argumentCount; ++i){
           argumentVarInfos[i] = new varInfo();
@@ -1441,7 +1441,7 @@ namespace occa {
         argumentCount = variablesInStatement(downNode);
 
         if(argumentCount)
-          argumentVarInfos = new varInfo*[argumentCount];
+          argumentVarInfos = arenaNewArray<varInfo*>(argumentCount);
 
         for(int i = 0; i < argumentCount; ++i){
           argumentVarInfos[i] = new varInfo();
@@ -1698,7 +1698,7 @@ namespace occa {
     }
 
     void varInfo::addArgument(const int pos, varInfo &arg){
-      varInfo **newArgumentVarInfos = new varInfo*[argumentCount + 1];
+      varInfo **newArgumentVarInfos = arenaNewArray<varInfo*>(argumentCount + 1);
 
       for(int i = 0; i < pos; ++i)
         newArgumentVarInfos[i] = argumentVarInfos[i];
@@ -1709,7 +1709,7 @@ namespace occa {
         newArgumentVarInfos[i + 1] = argumentVarInfos[i];
 
       if(argumentCount)
-        delete [] argumentVarInfos;
+        arenaDeleteArray(argumentVarInfos);
 
       argumentVarInfos = newArgumentVarInfos;
       ++argumentCount;
@@ -1,8 +1,154 @@
 #if OCCA_PTHREADS_ENABLED
 
 #include "occaPthreads.hpp"
+#include "occaGraph.hpp"
 
 namespace occa {
+  //---[ Batch ]----------------------
+  static PthreadBatch_t* newPthreadBatch(const int count){
+    PthreadBatch_t *batch = new PthreadBatch_t;
+
+    batch->count     = count;
+    batch->arrived   = 0;
+    batch->finished  = 0;
+    batch->barrierID = 0;
+
+    pthread_mutex_init(&(batch->mutex), NULL);
+
+    return batch;
+  }
+
+  static void freePthreadBatch(PthreadBatch_t *batch){
+    pthread_mutex_destroy(&(batch->mutex));
+
+    delete batch;
+  }
+
+  static void pthreadBatchBarrier(PthreadBatch_t &batch){
+    pthread_mutex_lock(&(batch.mutex));
+
+    const int barrierID = batch.barrierID;
+
+    if(++batch.arrived == batch.count){
+      batch.arrived = 0;
+      ++batch.barrierID;
+    }
+
+    pthread_mutex_unlock(&(batch.mutex));
+
+    while(batch.barrierID == barrierID)
+      __asm__ __volatile__ ("lfence");
+  }
+
+  // The worker's job barrier follows the last launch
+  static void launchPthreadBatch(PthreadKernelArg_t &args){
+    PthreadBatch_t &batch = *((PthreadBatch_t*) args.kernelHandle);
+
+    const int launches = (batch.kernelLaunch.size() / batch.count);
+
+    for(int i = 0; i < launches; ++i){
+      const int pos = (i*batch.count + args.rank);
+
+      if(i)
+        pthreadBatchBarrier(batch);
+
+      batch.kernelLaunch[pos]( *(batch.kernelArgs[pos]) );
+    }
+
+    delete &args;
+
+    // Last worker out frees the batch
+    pthread_mutex_lock(&(batch.mutex));
+    const bool isLast = (++batch.finished == batch.count);
+    pthread_mutex_unlock(&(batch.mutex));
+
+    if(isLast)
+      freePthreadBatch(&batch);
+  }
+
+  // Queues one job per worker, [handle] is shared by all of them
+  static void submitPthreadJobs(PthreadsDeviceData_t &data_,
+                                PthreadLaunchHandle_t launch,
+                                void *handle){
+    const int pThreadCount = data_.pThreadCount;
+
+    for(int p = 0; p < pThreadCount; ++p){
+      PthreadKernelArg_t *args = new PthreadKernelArg_t;
+      args->rank  = p;
+      args->count = pThreadCount;
+
+      args->kernelHandle = handle;
+
+      pthread_mutex_lock(&(data_.kernelMutex));
+      data_.kernelLaunch[p].push(launch);
+      data_.kernelArgs[p].push(args);
+      pthread_mutex_unlock(&(data_.kernelMutex));
+    }
+
+    pthread_mutex_lock(&(data_.pendingJobsMutex));
+    data_.pendingJobs += pThreadCount;
+    pthread_mutex_unlock(&(data_.pendingJobsMutex));
+  }
+
+  static void submitPthreadBatch(PthreadsDeviceData_t &data_){
+    PthreadBatch_t *batch = data_.batch;
+
+    if(batch == NULL)
+      return;
+
+    data_.batch = NULL;
+
+    if(batch->kernelLaunch.size() == 0){
+      freePthreadBatch(batch);
+      return;
+    }
+
+    submitPthreadJobs(data_, launchPthreadBatch, batch);
+  }
+  //==================================
+
+
+  //---[ Rect Copy ]------------------
+  static void launchPthreadCopyRect(PthreadKernelArg_t &args){
+    PthreadCopyRect_t &copy = *((PthreadCopyRect_t*) args.kernelHandle);
+
+    cpuCopyRect(copy.dest, copy.src,
+                copy.region, copy.destRect, copy.srcRect,
+                args.rank, args.count);
+
+    delete &args;
+  }
+
+  // Large regions are split across the workers, queued behind pending
+  //   kernels, and waited on
+  static void pthreadCopyRect(occa::device &dev,
+                              PthreadsDeviceData_t &dData,
+                              void *dest,
+                              const void *src,
+                              const occa::dim &region,
+                              const occa::rect &destRect,
+                              const occa::rect &srcRect){
+    if(!cpuCopyRectIsLarge(region)){
+      cpuCopyRect(dest, src,
+                  region, destRect, srcRect);
+      return;
+    }
+
+    PthreadCopyRect_t copy;
+
+    copy.dest     = dest;
+    copy.src      = src;
+    copy.region   = region;
+    copy.destRect = destRect;
+    copy.srcRect  = srcRect;
+
+    submitPthreadJobs(dData, launchPthreadCopyRect, &copy);
+
+    dev.finish();
+  }
+  //==================================
+
+
   //---[ Kernel ]---------------------
   template <>
   kernel_t<Pthreads>::kernel_t(){
@@ -80,15 +226,14 @@ namespace occa {
     info_.addDefine("OCCA_USING_CPU"     , 1);
     info_.addDefine("OCCA_USING_PTHREADS", 1);
 
-    info_.addOCCAKeywords(occaPthreadsDefines);
-
     std::stringstream salt;
     salt << "Pthreads"
          << info_.salt()
          << parser::version
          << dev->dHandle->compilerEnvScript
          << dev->dHandle->compiler
-         << dev->dHandle->compilerFlags;
+         << dev->dHandle->compilerFlags
+         << isaName(getHostISA());
 
     std::string cachedBinary = getCachedName(filename, salt.str());
 
@@ -125,14 +270,26 @@ namespace occa {
 
     data = new PthreadsKernelData_t;
 
-    std::string iCachedBinary = createIntermediateSource(filename,
-                                                         cachedBinary,
-                                                         info);
+    const std::string iCachedBinary = getMidCachedBinaryName(cachedBinary, "i");
+    const std::string iSource       = getIntermediateSource(filename, cachedBinary, info);
 
-    std::stringstream command;
+    std::stringstream flags;
+
+    flags << dev->dHandle->compilerFlags
+          << ' ' << isaCompilerFlags(getHostISA(),
+                                     dev->dHandle->compiler,
+                                     dev->dHandle->compilerFlags)
+          << ' ' << info.flags;
+
+    const std::string &sFlags = flags.str();
+
+    const std::string preludeFile = getCachedPrelude(getCPUPrelude(occaPthreadsDefines, iSource),
+                                                     dev->dHandle->compilerEnvScript,
+                                                     dev->dHandle->compiler,
+                                                     sFlags);
 
-    if(dev->dHandle->compilerEnvScript.size())
-      command << dev->dHandle->compilerEnvScript << " && ";
+    // The source goes through stdin unless it's kept for debugging
+    std::stringstream command;
 
     command << dev->dHandle->compiler
 #if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
@@ -140,21 +297,26 @@ namespace occa {
 #else
             << " /TP /LD /D MC_CL_EXE"
 #endif
-            << ' '    << dev->dHandle->compilerFlags
-            << ' '    << info.flags
-            << ' '    << iCachedBinary
+            << ' '    << sFlags
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+            << " -include " << preludeFile
+#else
+            << " /FI\"" << preludeFile << '"'
+#endif
+            << ' '    << (keepIntermediateFiles() ? iCachedBinary : "-")
 #if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
-            << " -o " << cachedBinary
+            << " -o " << cachedBinary;
 #else
-            << " /link /OUT:" << cachedBinary
+            << " /link /OUT:" << cachedBinary;
 #endif
-            << std::endl;
 
     const std::string &sCommand = command.str();
 
     std::cout << "Compiling [" << functionName << "]\n" << sCommand << "\n";
 
-    const int compileError = system(sCommand.c_str());
+    const int compileError = runCompiler(dev->dHandle->compilerEnvScript,
+                                         sCommand,
+                                         iSource);
 
     if(compileError){
       releaseFile(cachedBinary);
@@ -163,6 +325,8 @@ namespace occa {
 
     OCCA_EXTRACT_DATA(Pthreads, Kernel);
 
+    data_.ownsLibrary = true;
+
 #if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
     data_.dlHandle = dlopen(cachedBinary.c_str(), RTLD_NOW);
 
@@ -213,6 +377,8 @@ namespace occa {
     data_.pendingJobsMutex = &(dData.pendingJobsMutex);
     data_.kernelMutex      = &(dData.kernelMutex);
 
+    data_.batch = &(dData.batch);
+
     releaseFile(cachedBinary);
 
     return this;
@@ -225,6 +391,8 @@ namespace occa {
 
     OCCA_EXTRACT_DATA(Pthreads, Kernel);
 
+    data_.ownsLibrary = true;
+
     functionName = functionName_;
 
 #if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
@@ -272,6 +440,8 @@ namespace occa {
     data_.pendingJobsMutex = &(dData.pendingJobsMutex);
     data_.kernelMutex      = &(dData.kernelMutex);
 
+    data_.batch = &(dData.batch);
+
     return this;
   }
 
@@ -281,11 +451,45 @@ namespace occa {
     return buildFromBinary(cache, functionName_);
   }
 
+  template <>
+  kernel_t<Pthreads>* kernel_t<Pthreads>::buildSibling(const std::string &functionName_){
+    OCCA_EXTRACT_DATA(Pthreads, Kernel);
+
+    kernel_t<Pthreads> *k = new kernel_t<Pthreads>;
+
+    k->dev          = dev;
+    k->functionName = functionName_;
+
+    PthreadsKernelData_t *kData = new PthreadsKernelData_t(data_);
+    k->data = kData;
+
+    kData->ownsLibrary = false;
+
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    kData->handle = dlsym(data_.dlHandle, functionName_.c_str());
+
+    char *dlError;
+    if ((dlError = dlerror()) != NULL)  {
+      fputs(dlError, stderr);
+      throw 1;
+    }
+#else
+    kData->handle = GetProcAddress((HMODULE) (data_.dlHandle), functionName_.c_str());
+
+    if(kData->handle == NULL) {
+      fputs("unable to load function", stderr);
+      throw 1;
+    }
+#endif
+
+    return k;
+  }
+
   // [-] Missing
   template <>
   int kernel_t<Pthreads>::preferredDimSize(){
-    preferredDimSize_ = OCCA_SIMD_WIDTH;
-    return OCCA_SIMD_WIDTH;
+    preferredDimSize_ = dev->simdWidth();
+    return preferredDimSize_;
   }
 
   template <>
@@ -309,6 +513,11 @@ namespace occa {
     // [-] Fix later
     OCCA_EXTRACT_DATA(Pthreads, Kernel);
 
+    if(!data_.ownsLibrary){
+      delete (PthreadsKernelData_t*) data;
+      return;
+    }
+
 #if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
     dlclose(data_.dlHandle);
 #else
@@ -330,7 +539,23 @@ namespace occa {
     textureInfo.dim = 1;
     textureInfo.w = textureInfo.h = textureInfo.d = 0;
 
-    isAWrapper = false;
+    isAWrapper   = false;
+    wrapsHostPtr = false;
+
+    pageBytes   = 0;
+    mappedBytes = 0;
+
+    parent       = NULL;
+    parentOffset = 0;
+
+    sliceRefs   = 0;
+    freePending = false;
+
+    ownsSharedName = false;
+
+    mapPtr    = NULL;
+    mapBytes  = 0;
+    mapOffset = 0;
   }
 
   template <>
@@ -347,7 +572,24 @@ namespace occa {
     textureInfo.h = m.textureInfo.h;
     textureInfo.d = m.textureInfo.d;
 
-    isAWrapper = m.isAWrapper;
+    isAWrapper   = m.isAWrapper;
+    wrapsHostPtr = m.wrapsHostPtr;
+
+    pageBytes   = m.pageBytes;
+    mappedBytes = m.mappedBytes;
+
+    parent       = m.parent;
+    parentOffset = m.parentOffset;
+
+    sliceRefs   = m.sliceRefs;
+    freePending = m.freePending;
+
+    sharedName     = m.sharedName;
+    ownsSharedName = m.ownsSharedName;
+
+    mapPtr    = m.mapPtr;
+    mapBytes  = m.mapBytes;
+    mapOffset = m.mapOffset;
   }
 
   template <>
@@ -363,7 +605,24 @@ namespace occa {
     textureInfo.h = m.textureInfo.h;
     textureInfo.d = m.textureInfo.d;
 
-    isAWrapper = m.isAWrapper;
+    isAWrapper   = m.isAWrapper;
+    wrapsHostPtr = m.wrapsHostPtr;
+
+    pageBytes   = m.pageBytes;
+    mappedBytes = m.mappedBytes;
+
+    parent       = m.parent;
+    parentOffset = m.parentOffset;
+
+    sliceRefs   = m.sliceRefs;
+    freePending = m.freePending;
+
+    sharedName     = m.sharedName;
+    ownsSharedName = m.ownsSharedName;
+
+    mapPtr    = m.mapPtr;
+    mapBytes  = m.mapBytes;
+    mapOffset = m.mapOffset;
 
     return *this;
   }
@@ -510,12 +769,106 @@ namespace occa {
     ::memcpy(destPtr, srcPtr, bytes_);
   }
 
+  template <>
+  void memory_t<Pthreads>::copyRectFrom(const void *source,
+                                        const occa::dim &region,
+                                        const occa::rect &destRect,
+                                        const occa::rect &srcRect){
+    dev->finish();
+
+    asyncCopyRectFrom(source, region, destRect, srcRect);
+  }
+
+  template <>
+  void memory_t<Pthreads>::copyRectFrom(const memory_v *source,
+                                        const occa::dim &region,
+                                        const occa::rect &destRect,
+                                        const occa::rect &srcRect){
+    dev->finish();
+
+    asyncCopyRectFrom(source, region, destRect, srcRect);
+  }
+
+  template <>
+  void memory_t<Pthreads>::copyRectTo(void *dest,
+                                      const occa::dim &region,
+                                      const occa::rect &destRect,
+                                      const occa::rect &srcRect){
+    dev->finish();
+
+    asyncCopyRectTo(dest, region, destRect, srcRect);
+  }
+
+  template <>
+  void memory_t<Pthreads>::asyncCopyRectFrom(const void *source,
+                                             const occa::dim &region,
+                                             const occa::rect &destRect,
+                                             const occa::rect &srcRect){
+    pthreadCopyRect(*dev, *((PthreadsDeviceData_t*) dev->dHandle->data),
+                    handle, source,
+                    region, destRect, srcRect);
+  }
+
+  template <>
+  void memory_t<Pthreads>::asyncCopyRectFrom(const memory_v *source,
+                                             const occa::dim &region,
+                                             const occa::rect &destRect,
+                                             const occa::rect &srcRect){
+    pthreadCopyRect(*dev, *((PthreadsDeviceData_t*) dev->dHandle->data),
+                    handle, source->handle,
+                    region, destRect, srcRect);
+  }
+
+  template <>
+  void memory_t<Pthreads>::asyncCopyRectTo(void *dest,
+                                           const occa::dim &region,
+                                           const occa::rect &destRect,
+                                           const occa::rect &srcRect){
+    pthreadCopyRect(*dev, *((PthreadsDeviceData_t*) dev->dHandle->data),
+                    dest, handle,
+                    region, destRect, srcRect);
+  }
+
+  template <>
+  memory_v* memory_t<Pthreads>::slice(const uintptr_t offset,
+                                  const uintptr_t bytes){
+    memory_v *mem = new memory_t<Pthreads>;
+
+    mem->dev    = dev;
+    mem->handle = ((char*) handle) + offset;
+    mem->size   = bytes;
+
+    mem->pageBytes = pageBytes;
+
+    return mem;
+  }
+
+  template <>
+  void* memory_t<Pthreads>::map(const uintptr_t bytes,
+                                const uintptr_t offset){
+    dev->finish();
+
+    return (((char*) handle) + offset);
+  }
+
+  template <>
+  void memory_t<Pthreads>::unmap(){}
+
   template <>
   void memory_t<Pthreads>::free(){
+    // Slices and wrapped host pointers don't own their pointer
+    if((parent != NULL) || wrapsHostPtr){
+      size = 0;
+      return;
+    }
+
     if(isTexture)
       ::free(textureInfo.arg);
     else
-      ::free(handle);
+      cpuFree(handle, mappedBytes);
+
+    if(ownsSharedName)
+      cpuUnlinkShared(sharedName);
 
     size = 0;
   }
@@ -527,6 +880,7 @@ namespace occa {
   device_t<Pthreads>::device_t(){
     data            = NULL;
     memoryAllocated = 0;
+    simdWidth_      = 0;
 
     getEnvironmentVariables();
   }
@@ -535,6 +889,7 @@ namespace occa {
   device_t<Pthreads>::device_t(const device_t<Pthreads> &d){
     data            = d.data;
     memoryAllocated = d.memoryAllocated;
+    simdWidth_      = d.simdWidth_;
 
     compiler      = d.compiler;
     compilerFlags = d.compilerFlags;
@@ -544,6 +899,7 @@ namespace occa {
   device_t<Pthreads>& device_t<Pthreads>::operator = (const device_t<Pthreads> &d){
     data            = d.data;
     memoryAllocated = d.memoryAllocated;
+    simdWidth_      = d.simdWidth_;
 
     compiler      = d.compiler;
     compilerFlags = d.compilerFlags;
@@ -558,6 +914,9 @@ namespace occa {
     OCCA_EXTRACT_DATA(Pthreads, Device);
 
     data_.pendingJobs = 0;
+    data_.batch       = NULL;
+
+    simdWidth_ = isaSimdWidth(getHostISA());
 
 #if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
     data_.coreCount = sysconf(_SC_NPROCESSORS_ONLN);
@@ -567,6 +926,10 @@ namespace occa {
 
     std::vector<int> pinnedCores;
 
+    data_.pages = (aim.has("hugePages") ?
+                   pageTypeFromString(aim.get("hugePages")) :
+                   pageType::regular);
+
     if(!aim.has("threadCount"))
       data_.pThreadCount = 1;
     else
@@ -672,6 +1035,7 @@ namespace occa {
 
     dID.flagMap["compiler"]     = compiler;
     dID.flagMap["debugEnabled"] = (debugEnabled ? "true" : "false");
+    dID.flagMap["isa"]          = isaName(getHostISA());
 
     for(int i = 0; i <= 3; ++i){
       std::string flag = "-O";
@@ -777,6 +1141,11 @@ namespace occa {
     finish(); // [-] Not done
   }
 
+  template <>
+  void device_t<Pthreads>::streamWaitFor(tag tag_){
+    finish();
+  }
+
   template <>
   stream device_t<Pthreads>::createStream(){
     return NULL;
@@ -804,6 +1173,9 @@ namespace occa {
     return (endTag.tagTime - startTag.tagTime);
   }
 
+  template <>
+  void device_t<Pthreads>::freeTag(tag tag_){}
+
   template <>
   kernel_v* device_t<Pthreads>::buildKernelFromSource(const std::string &filename,
                                                       const std::string &functionName,
@@ -835,15 +1207,14 @@ namespace occa {
     info.addDefine("OCCA_USING_CPU"     , 1);
     info.addDefine("OCCA_USING_PTHREADS", 1);
 
-    info.addOCCAKeywords(occaPthreadsDefines);
-
     std::stringstream salt;
     salt << "Pthreads"
          << info.salt()
          << parser::version
          << compilerEnvScript
          << compiler
-         << compilerFlags;
+         << compilerFlags
+         << isaName(getHostISA());
 
     std::string cachedBinary = getCachedName(filename, salt.str());
 
@@ -884,6 +1255,37 @@ namespace occa {
     return k;
   }
 
+  template <>
+  void device_t<Pthreads>::runGraph(occa::graph &g){
+    OCCA_EXTRACT_DATA(Pthreads, Device);
+
+    const int nodeCount = g.size();
+
+    for(int i = 0; i < nodeCount; ++i){
+      graphNode_t &node = g.nodes[i];
+
+      // Tags don't wait for launches, copies need them submitted
+      if(node.type == graphNode::tagStream){
+        g.runNode(node);
+        continue;
+      }
+
+      if(node.type != graphNode::kernelLaunch){
+        submitPthreadBatch(data_);
+        g.runNode(node);
+
+        continue;
+      }
+
+      if(data_.batch == NULL)
+        data_.batch = newPthreadBatch(data_.pThreadCount);
+
+      g.runNode(node);
+    }
+
+    submitPthreadBatch(data_);
+  }
+
   template <>
   memory_v* device_t<Pthreads>::wrapMemory(void *handle_,
                                            const uintptr_t bytes){
@@ -898,6 +1300,16 @@ namespace occa {
     return mem;
   }
 
+  template <>
+  memory_v* device_t<Pthreads>::wrapHostMemory(void *ptr,
+                                               const uintptr_t bytes){
+    memory_v *mem = wrapMemory(ptr, bytes);
+
+    mem->wrapsHostPtr = true;
+
+    return mem;
+  }
+
   template <>
   memory_v* device_t<Pthreads>::wrapTexture(void *handle_,
                                             const int dim, const occa::dim &dims,
@@ -925,19 +1337,20 @@ namespace occa {
 
   template <>
   memory_v* device_t<Pthreads>::malloc(const uintptr_t bytes,
-                                       void *source){
+                                       void *source,
+                                       const int pages){
     memory_v *mem = new memory_t<Pthreads>;
 
     mem->dev  = dev;
     mem->size = bytes;
 
-#if   OCCA_OS == LINUX_OS
-    posix_memalign(&mem->handle, OCCA_MEM_ALIGN, bytes);
-#elif OCCA_OS == OSX_OS
-    mem->handle = ::malloc(bytes);
-#else
-    mem->handle = ::malloc(bytes);
-#endif
+    PthreadsDeviceData_t *dData = (PthreadsDeviceData_t*) data;
+
+    mem->handle = cpuMalloc(bytes,
+                            pages,
+                            (dData ? dData->pages : pageType::regular),
+                            mem->pageBytes,
+                            mem->mappedBytes);
 
     if(source != NULL)
       ::memcpy(mem->handle, source, bytes);
@@ -991,8 +1404,12 @@ namespace occa {
 
   template <>
   int device_t<Pthreads>::simdWidth(){
-    simdWidth_ = OCCA_SIMD_WIDTH;
-    return OCCA_SIMD_WIDTH;
+    if(simdWidth_)
+      return simdWidth_;
+
+    simdWidth_ = isaSimdWidth(getHostISA());
+
+    return simdWidth_;
   }
   //==================================
 
@@ -1,5 +1,44 @@
 #include "occaTools.hpp"
 #include "occa.hpp"      // For kernelInfo
+#include "occaKernelDefines.hpp"
+
+#include <fstream>
+#include <map>
+#include <set>
+#include <vector>
+
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+#  include <fcntl.h>
+#  include <sys/wait.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <sched.h>
+#endif
+
+#if (OCCA_OS == OSX_OS)
+#  include <crt_externs.h>
+#  define OCCA_ENVIRON (*_NSGetEnviron())
+#elif (OCCA_OS == LINUX_OS)
+extern char **environ;
+#  define OCCA_ENVIRON environ
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+#  define OCCA_X86_CPUID 1
+#  include <cpuid.h>
+#elif defined(_M_X64) || defined(_M_IX86)
+#  define OCCA_X86_CPUID 2
+#  include <intrin.h>
+#  include <immintrin.h>
+#endif
+
+// Code paths for ISAs above the library's own build flags
+#if OCCA_X86_CPUID == 1
+#  include <immintrin.h>
+#  define OCCA_TARGET(ISA) __attribute__ ((target (ISA)))
+#elif OCCA_X86_CPUID == 2
+#  define OCCA_TARGET(ISA)
+#endif
 
 namespace occa {
   mutex_t::mutex_t(){
@@ -189,19 +228,17 @@ namespace occa {
 
     const bool parsingC = (getFileExtension(filename) != "ofl");
 
-    std::ofstream fs;
-    fs.open(pCachedBinary.c_str());
-
-    fs << info.header << readFile(filename);
+    const std::string pSource = info.header + readFile(filename);
 
-    fs.close();
-    fs.clear();
+    if(keepIntermediateFiles())
+      writeFile(pCachedBinary, pSource);
 
-    fs.open(iCachedBinary.c_str());
-    fs << info.occaKeywords << fileParser.parseFile(pCachedBinary,
-                                                    parsingC);
+    const std::string iSource = (info.occaKeywords +
+                                 fileParser.parseSource(pSource, parsingC));
 
-    fs.close();
+    // Held until the launcher is compiled
+    if(!fileExists(cachedBinary) || keepIntermediateFiles())
+      setIntermediateSource(iCachedBinary, iSource);
 
     kernelInfoIterator kIt = fileParser.kernelInfoMap.find(functionName);
 
@@ -258,7 +295,33 @@ namespace occa {
     return (stat(filename.c_str(), &buffer) == 0);
   }
 
+  //---[ String Sources ]-------------
+  static std::map<std::string, std::string> stringSources;
+
+  std::string setStringSource(const std::string &source,
+                              const std::string &extension){
+    static int sourceCount = 0;
+
+    // Cached binaries are named from the content hash, not [filename]
+    std::stringstream ss;
+    ss << "occaString" << (sourceCount++) << '.' << extension;
+
+    stringSources[ss.str()] = source;
+
+    return ss.str();
+  }
+
+  void releaseStringSource(const std::string &filename){
+    stringSources.erase(filename);
+  }
+  //==================================
+
   std::string readFile(const std::string &filename){
+    std::map<std::string, std::string>::iterator it = stringSources.find(filename);
+
+    if(it != stringSources.end())
+      return it->second;
+
     // NBN: handle EOL chars on Windows
     FILE *fp = fopen(filename.c_str(), "r");
 
@@ -393,36 +456,1230 @@ namespace occa {
   std::string createIntermediateSource(const std::string &filename,
                                        const std::string &cachedBinary,
                                        const kernelInfo &info){
-    std::string prefix, name;
-    getFilePrefixAndName(cachedBinary, prefix, name);
+    const std::string iCachedBinary = getMidCachedBinaryName(cachedBinary, "i");
+
+    const std::string source = getIntermediateSource(filename, cachedBinary, info);
+
+    // GPU compilers read the intermediate file
+    if(!keepIntermediateFiles())
+      writeFile(iCachedBinary, source);
 
-    const std::string iCachedBinary = prefix + "i_" + name;
+    return iCachedBinary;
+  }
+
+  //---[ Intermediate Sources ]-------
+  // Parsed sources waiting for their compile, keyed by their i_ file
+  static std::map<std::string, std::string> intermediateSources;
+
+  bool keepIntermediateFiles(){
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    static const char *c_keep = getenv("OCCA_KEEP_INTERMEDIATES");
+    static const bool keep    = ((c_keep != NULL) && atoi(c_keep));
+
+    return keep;
+#else
+    // cl.exe compiles from the intermediate file
+    return true;
+#endif
+  }
+
+  void writeFile(const std::string &filename,
+                 const std::string &content){
+    std::ofstream fs;
+    fs.open(filename.c_str());
+
+    fs << content;
+
+    fs.close();
+  }
+
+  void setIntermediateSource(const std::string &iCachedBinary,
+                             const std::string &source){
+    intermediateSources[iCachedBinary] = source;
+
+    if(keepIntermediateFiles())
+      writeFile(iCachedBinary, source);
+  }
+
+  std::string getIntermediateSource(const std::string &filename,
+                                    const std::string &cachedBinary,
+                                    const kernelInfo &info){
+    const std::string iCachedBinary = getMidCachedBinaryName(cachedBinary, "i");
+
+    std::map<std::string, std::string>::iterator it = intermediateSources.find(iCachedBinary);
+
+    // Already parsed by parseFileForFunction()
+    if(it != intermediateSources.end()){
+      const std::string source = it->second;
+      intermediateSources.erase(it);
+
+      return source;
+    }
+
+    std::string source = info.header + readFile(filename);
 
     if(fileNeedsParser(filename)){
-      const std::string pCachedBinary = prefix + "p_" + name;
+      if(keepIntermediateFiles())
+        writeFile(getMidCachedBinaryName(cachedBinary, "p"), source);
+
       parser fileParser;
+      source = fileParser.parseSource(source, true);
+    }
+
+    source = info.occaKeywords + source;
+
+    if(keepIntermediateFiles())
+      writeFile(iCachedBinary, source);
+
+    return source;
+  }
+  //==================================
+
+  //---[ Compiler ]-------------------
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+  // Splits a shell-style command, quotes and backslashes are honored
+  static std::vector<std::string> splitCommand(const std::string &command){
+    std::vector<std::string> args;
+
+    std::string arg;
+    bool hasArg = false;
+    char quote  = '\0';
+
+    const int chars = command.size();
+
+    for(int i = 0; i < chars; ++i){
+      const char c = command[i];
+
+      if(quote){
+        if(c == quote)
+          quote = '\0';
+        else if((c == '\\') && (quote == '"') && (i < (chars - 1)))
+          arg += command[++i];
+        else
+          arg += c;
+      }
+      else if((c == '"') || (c == '\'')){
+        quote  = c;
+        hasArg = true;
+      }
+      else if(c == '\\' && (i < (chars - 1))){
+        arg   += command[++i];
+        hasArg = true;
+      }
+      else if(isspace(c)){
+        if(hasArg)
+          args.push_back(arg);
+
+        arg    = "";
+        hasArg = false;
+      }
+      else{
+        arg   += c;
+        hasArg = true;
+      }
+    }
 
-      std::ofstream fs;
-      fs.open(pCachedBinary.c_str());
+    if(hasArg)
+      args.push_back(arg);
 
-      fs << info.header << readFile(filename);
+    return args;
+  }
 
-      fs.close();
+  static std::string findExecutable(const std::string &name,
+                                    const std::vector<std::string> &env){
+    if(name.find('/') != std::string::npos)
+      return name;
 
-      fs.open(iCachedBinary.c_str());
-      fs << info.occaKeywords << fileParser.parseFile(pCachedBinary);
+    std::string path;
 
-      fs.close();
+    for(size_t i = 0; i < env.size(); ++i){
+      if(env[i].compare(0, 5, "PATH=") == 0){
+        path = env[i].substr(5);
+        break;
+      }
     }
-    else{
-      std::ofstream fs;
-      fs.open(iCachedBinary.c_str());
 
-      fs << info.occaKeywords << info.header << readFile(filename);
+    size_t start = 0;
+
+    while(start <= path.size()){
+      size_t end = path.find(':', start);
+
+      if(end == std::string::npos)
+        end = path.size();
+
+      std::string dir = path.substr(start, end - start);
+
+      if(dir.size() == 0)
+        dir = ".";
+
+      const std::string executable = dir + "/" + name;
+
+      if(access(executable.c_str(), X_OK) == 0)
+        return executable;
 
-      fs.close();
+      start = end + 1;
     }
 
-    return iCachedBinary;
+    return name;
+  }
+
+  // Runs [args] without a shell, [input] is fed through stdin and
+  //   stdout/stderr are returned in [output]
+  static int runProcess(const std::vector<std::string> &args,
+                        const std::vector<std::string> &env,
+                        const std::string &input,
+                        std::string &output){
+    OCCA_CHECK(0 < args.size());
+
+    // Everything the child needs is set up before forking
+    const std::string executable = findExecutable(args[0], env);
+
+    std::vector<char*> argv, envp;
+
+    for(size_t i = 0; i < args.size(); ++i)
+      argv.push_back(const_cast<char*>(args[i].c_str()));
+
+    for(size_t i = 0; i < env.size(); ++i)
+      envp.push_back(const_cast<char*>(env[i].c_str()));
+
+    argv.push_back(NULL);
+    envp.push_back(NULL);
+
+#if (OCCA_OS == LINUX_OS) && defined(MFD_CLOEXEC)
+    const int inputFD = memfd_create("occaSource", MFD_CLOEXEC);
+#else
+    FILE *inputFile   = tmpfile();
+    const int inputFD = (inputFile ? fileno(inputFile) : -1);
+#endif
+
+    int outputPipe[2];
+
+    if((inputFD < 0) || pipe(outputPipe)){
+      std::cout << "Unable to setup the compiler's input/output\n";
+      throw 1;
+    }
+
+    for(size_t written = 0; written < input.size();){
+      const ssize_t bytes = write(inputFD, input.c_str() + written, input.size() - written);
+
+      if(bytes <= 0){
+        std::cout << "Unable to write the compiler's input\n";
+        throw 1;
+      }
+
+      written += bytes;
+    }
+
+    lseek(inputFD, 0, SEEK_SET);
+
+    const pid_t pid = fork();
+
+    if(pid < 0){
+      std::cout << "Unable to fork [" << args[0] << "]\n";
+      throw 1;
+    }
+
+    if(pid == 0){
+      dup2(inputFD      , STDIN_FILENO);
+      dup2(outputPipe[1], STDOUT_FILENO);
+      dup2(outputPipe[1], STDERR_FILENO);
+
+      close(outputPipe[0]);
+      close(outputPipe[1]);
+
+      execve(executable.c_str(), &(argv[0]), &(envp[0]));
+
+      _exit(127);
+    }
+
+    close(outputPipe[1]);
+
+    char buffer[4096];
+    ssize_t bytes;
+
+    while(((bytes = read(outputPipe[0], buffer, sizeof(buffer))) > 0) ||
+          ((bytes < 0) && (errno == EINTR))){
+
+      if(0 < bytes)
+        output.append(buffer, bytes);
+    }
+
+    close(outputPipe[0]);
+
+#if (OCCA_OS == LINUX_OS) && defined(MFD_CLOEXEC)
+    close(inputFD);
+#else
+    fclose(inputFile);
+#endif
+
+    int status;
+
+    while(waitpid(pid, &status, 0) < 0){
+      if(errno != EINTR)
+        return 1;
+    }
+
+    if(WIFEXITED(status))
+      return WEXITSTATUS(status);
+
+    return 1;
+  }
+
+  // Environment scripts are only sourced once per process
+  static const std::vector<std::string>& getCompilerEnvironment(const std::string &compilerEnvScript){
+    static std::map<std::string, std::vector<std::string> > environments;
+
+    std::map<std::string, std::vector<std::string> >::iterator it = environments.find(compilerEnvScript);
+
+    if(it != environments.end())
+      return it->second;
+
+    std::vector<std::string> &env = environments[compilerEnvScript];
+
+    for(char **e = OCCA_ENVIRON; *e; ++e)
+      env.push_back(*e);
+
+    if(compilerEnvScript.size() == 0)
+      return env;
+
+    std::vector<std::string> args;
+
+    args.push_back("/bin/sh");
+    args.push_back("-c");
+    args.push_back(compilerEnvScript + " > /dev/null 2>&1 && env");
+
+    std::string output;
+
+    if(runProcess(args, env, "", output)){
+      std::cout << "Unable to source [" << compilerEnvScript << "]\n";
+      throw 1;
+    }
+
+    env.clear();
+
+    // Values with newlines continue on the next line
+    std::stringstream ss(output);
+    std::string line;
+
+    while(std::getline(ss, line)){
+      if((line.find('=') != std::string::npos) || (env.size() == 0))
+        env.push_back(line);
+      else
+        env.back() += '\n' + line;
+    }
+
+    return env;
+  }
+#endif
+
+  int runCompiler(const std::string &compilerEnvScript,
+                  const std::string &command,
+                  const std::string &source){
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    std::string diagnostics;
+
+    const int compileError = runProcess(splitCommand(command),
+                                        getCompilerEnvironment(compilerEnvScript),
+                                        source,
+                                        diagnostics);
+
+    if(diagnostics.size())
+      std::cerr << diagnostics;
+
+    return compileError;
+#else
+    std::string sCommand = command;
+
+    if(compilerEnvScript.size())
+      sCommand = compilerEnvScript + " && " + sCommand;
+
+    return system(("\"" +  sCommand + "\"").c_str());
+#endif
+  }
+  //==================================
+
+  //---[ CPU Prelude ]----------------
+  bool usesVectorTypes(const std::string &source){
+    const char *types[6] = {"float2" , "float3" , "float4",
+                            "double2", "double3", "double4"};
+
+    for(int i = 0; i < 6; ++i){
+      if(source.find(types[i]) != std::string::npos)
+        return true;
+    }
+
+    return false;
+  }
+
+  bool usesHalfTypes(const std::string &source){
+    return ((source.find("half")     != std::string::npos) ||
+            (source.find("Half")     != std::string::npos) ||
+            (source.find("bfloat16") != std::string::npos) ||
+            (source.find("Bfloat16") != std::string::npos));
+  }
+
+  std::string getCPUPrelude(const std::string &defines,
+                            const std::string &source){
+    std::string prelude = "#include <cstdlib>\n"
+                          "#include <cstdio>\n"
+                          "#include <cmath>\n";
+
+    // OKL launchers
+    if(source.find("occa::") != std::string::npos)
+      prelude += "\n#include \"" + getOCCADir() + "/include/occaBase.hpp\"\n";
+
+    prelude += defines;
+
+    const bool usesHalf = usesHalfTypes(source);
+
+    // Half x4 helpers return float4
+    if(usesHalf || usesVectorTypes(source))
+      prelude += occaCPUVectorDefines;
+
+    if(usesHalf)
+      prelude += occaCPUHalfDefines;
+
+    if(source.find("occaPrivate") != std::string::npos)
+      prelude += occaCPUPrivateDefines;
+
+    if((source.find("occaFast")   != std::string::npos) ||
+       (source.find("occaNative") != std::string::npos)){
+
+      prelude += occaCPUFastMathDefines;
+    }
+
+    return prelude;
+  }
+
+  // Hashes [header] and the OCCA headers it includes, a .gch isn't
+  //   rebuilt when they change
+  static void saltOCCAHeader(const std::string &header,
+                             std::set<std::string> &visited,
+                             std::string &salt){
+    if(visited.find(header) != visited.end())
+      return;
+
+    visited.insert(header);
+
+    const std::string headerFile = (getOCCADir() + "/include/" + header);
+
+    if(!fileExists(headerFile))
+      return;
+
+    const std::string contents = readFile(headerFile);
+
+    salt += fnv(contents);
+
+    size_t pos = contents.find("include \"");
+
+    while(pos != std::string::npos){
+      pos += 9;
+
+      const size_t end = contents.find('"', pos);
+
+      if(end == std::string::npos)
+        break;
+
+      saltOCCAHeader(contents.substr(pos, end - pos), visited, salt);
+
+      pos = contents.find("include \"", end);
+    }
+  }
+
+  std::string getCachedPrelude(const std::string &prelude,
+                               const std::string &compilerEnvScript,
+                               const std::string &compiler,
+                               const std::string &compilerFlags){
+    std::string salt = (prelude +
+                        compilerEnvScript +
+                        compiler +
+                        compilerFlags);
+
+    // OKL launchers include occaBase.hpp
+    if(prelude.find("/include/occaBase.hpp") != std::string::npos){
+      std::set<std::string> visited;
+      saltOCCAHeader("occaBase.hpp", visited, salt);
+    }
+
+    const std::string preludeName = (getCachePath() + "h_" + fnv(salt).substr(0, 16));
+    const std::string preludeFile = (preludeName + ".hpp");
+
+    if(fileExists(preludeFile))
+      return preludeFile;
+
+    if(!haveFile(preludeFile)){
+      waitForFile(preludeFile);
+      return preludeFile;
+    }
+
+    // Kernels only see the header once its precompiled version is done
+    const std::string tmpFile = (preludeName + ".tmp");
+
+    std::ofstream fs;
+    fs.open(tmpFile.c_str());
+
+    fs << prelude;
+
+    fs.close();
+
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    std::stringstream command;
+
+    command << compiler
+            << " -x c++-header -w -fPIC"
+            << ' '    << compilerFlags
+            << ' '    << tmpFile
+            << " -o " << preludeFile << ".gch";
+
+    const std::string &sCommand = command.str();
+
+    std::cout << "Precompiling CPU prelude\n" << sCommand << "\n";
+
+    // Kernels fall back on the plain header
+    if(runCompiler(compilerEnvScript, sCommand, ""))
+      ::remove((preludeFile + ".gch").c_str());
+#endif
+
+    ::rename(tmpFile.c_str(), preludeFile.c_str());
+
+    releaseFile(preludeFile);
+
+    return preludeFile;
+  }
+  //==================================
+
+  //---[ CPU ISA ]--------------------
+#ifdef OCCA_X86_CPUID
+  static void x86CPUID(const int leaf, const int subleaf, unsigned int regs[4]){
+#  if OCCA_X86_CPUID == 1
+    __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#  else
+    int regs_[4];
+    __cpuidex(regs_, leaf, subleaf);
+
+    for(int i = 0; i < 4; ++i)
+      regs[i] = (unsigned int) regs_[i];
+#  endif
+  }
+
+  // Registers the OS saves on context switches (XCR0)
+  static unsigned int x86XCR0(){
+#  if OCCA_X86_CPUID == 1
+    unsigned int eax, edx;
+    __asm__ __volatile__ ("xgetbv" : "=a" (eax), "=d" (edx) : "c" (0));
+    return eax;
+#  else
+    return (unsigned int) _xgetbv(0);
+#  endif
+  }
+
+  static int detectHostISA(){
+    unsigned int regs[4];
+
+    x86CPUID(0, 0, regs);
+    const unsigned int maxLeaf = regs[0];
+
+    if(maxLeaf < 1)
+      return cpuISA::none;
+
+    x86CPUID(1, 0, regs);
+    const unsigned int ecx1 = regs[2];
+
+    if(!(ecx1 & (1 << 20))) // SSE4.2
+      return cpuISA::none;
+
+    const bool hasOSXSave = (ecx1 & (1 << 27));
+    const bool hasAVX     = (ecx1 & (1 << 28));
+    const bool hasFMA     = (ecx1 & (1 << 12));
+    const bool hasF16C    = (ecx1 & (1 << 29));
+
+    if(!hasOSXSave || !hasAVX)
+      return cpuISA::sse4_2;
+
+    const unsigned int xcr0 = x86XCR0();
+
+    // XMM + YMM state
+    if((xcr0 & 0x6) != 0x6)
+      return cpuISA::sse4_2;
+
+    if(maxLeaf < 7)
+      return cpuISA::avx;
+
+    x86CPUID(7, 0, regs);
+    const unsigned int ebx7 = regs[1];
+
+    if(!(ebx7 & (1 << 5)) || !hasFMA || !hasF16C) // AVX2
+      return cpuISA::avx;
+
+    const unsigned int avx512Bits = ((1u << 16) | // F
+                                     (1u << 17) | // DQ
+                                     (1u << 28) | // CD
+                                     (1u << 30) | // BW
+                                     (1u << 31)); // VL
+
+    // Opmask + ZMM state
+    if(((ebx7 & avx512Bits) != avx512Bits) ||
+       ((xcr0 & 0xe6) != 0xe6)){
+
+      return cpuISA::avx2;
+    }
+
+    return cpuISA::avx512;
+  }
+#else
+  static int detectHostISA(){
+    return cpuISA::none;
+  }
+#endif
+
+  int getHostISA(){
+    static int hostISA = -1;
+
+    if(hostISA == -1)
+      hostISA = detectHostISA();
+
+    return hostISA;
+  }
+
+  std::string isaName(const int isa){
+    switch(isa){
+    case cpuISA::sse4_2: return "sse4.2";
+    case cpuISA::avx:    return "avx";
+    case cpuISA::avx2:   return "avx2";
+    case cpuISA::avx512: return "avx512";
+    }
+
+    return "none";
+  }
+
+  // Flags the compiler needs to target [isa], nothing is added if
+  //   the user already picked a target in [compilerFlags]
+  std::string isaCompilerFlags(const int isa,
+                               const std::string &compiler,
+                               const std::string &compilerFlags){
+    if(isa == cpuISA::none)
+      return "";
+
+    if(compiler.find("cl.exe") != std::string::npos){
+      if(compilerFlags.find("/arch:") != std::string::npos)
+        return "";
+
+      switch(isa){
+      case cpuISA::avx:    return "/arch:AVX";
+      case cpuISA::avx2:   return "/arch:AVX2";
+      case cpuISA::avx512: return "/arch:AVX512";
+      }
+
+      return "";
+    }
+
+    if(compiler.find("icpc") != std::string::npos){
+      if((compilerFlags.find("-x")    != std::string::npos) ||
+         (compilerFlags.find("-march") != std::string::npos)){
+
+        return "";
+      }
+
+      switch(isa){
+      case cpuISA::sse4_2: return "-xSSE4.2";
+      case cpuISA::avx:    return "-xAVX";
+      case cpuISA::avx2:   return "-xCORE-AVX2";
+      case cpuISA::avx512: return "-xCORE-AVX512";
+      }
+
+      return "";
+    }
+
+    // GCC-compatible compilers
+    if((compilerFlags.find("-march") != std::string::npos) ||
+       (compilerFlags.find("-mavx")  != std::string::npos) ||
+       (compilerFlags.find("-msse")  != std::string::npos)){
+
+      return "";
+    }
+
+    switch(isa){
+    case cpuISA::sse4_2: return "-msse4.2 -mpopcnt";
+    case cpuISA::avx:    return "-mavx";
+    case cpuISA::avx2:   return "-mavx2 -mfma -mf16c";
+    case cpuISA::avx512: return "-mavx512f -mavx512cd -mavx512bw -mavx512dq -mavx512vl -mavx2 -mfma -mf16c";
+    }
+
+    return "";
+  }
+
+  // Single-precision lanes
+  int isaSimdWidth(const int isa){
+    switch(isa){
+    case cpuISA::avx:
+    case cpuISA::avx2:   return 8;
+    case cpuISA::avx512: return 16;
+    }
+
+    return 4;
+  }
+  //==================================
+
+  //---[ Half Precision ]-------------
+  static inline uint32_t floatBits(const float f){
+    uint32_t i;
+    ::memcpy(&i, &f, sizeof(float));
+    return i;
+  }
+
+  static inline float bitsToFloat(const uint32_t i){
+    float f;
+    ::memcpy(&f, &i, sizeof(float));
+    return f;
+  }
+
+  static inline uint32_t selectBits(const uint32_t cond, const uint32_t a, const uint32_t b){
+    const uint32_t mask = (0 - cond);
+    return ((a & mask) | (b & ~mask));
+  }
+
+  // Same conversions as occaCPUHalfDefines, branchless so loops vectorize
+  //   and exact with flush-to-zero on (-ffast-math turns it on)
+  static inline float halfBitsToFloat(const uint16_t h){
+    const uint32_t sign     = ((uint32_t) (h & 0x8000)) << 16;
+    const uint32_t em       = (h & 0x7fff);
+    const uint32_t normal   = (em << 13) + 0x38000000;
+    const uint32_t denormal = floatBits(((float) (int) em) * 5.9604644775390625e-8f);
+    const uint32_t infNaN   = ((em << 13) | 0x7f800000 | (((uint32_t) (0x7c00 < em)) << 22));
+
+    return bitsToFloat(sign | selectBits((uint32_t) (0x7c00 <= em),
+                                         infNaN,
+                                         selectBits((uint32_t) (em < 0x0400),
+                                                    denormal,
+                                                    normal)));
+  }
+
+  static inline uint16_t floatToHalfBits(const float f){
+    const uint32_t bits    = floatBits(f);
+    const uint32_t sign    = (bits & 0x80000000) >> 16;
+    const uint32_t absBits = (bits & 0x7fffffff);
+
+    const uint32_t normal   = (absBits + 0xc8000fff + ((absBits >> 13) & 1)) >> 13;
+    const uint32_t denormal = (floatBits(bitsToFloat(absBits) + 0.5f) - 0x3f000000);
+    const uint32_t big      = selectBits((uint32_t) (0x7f800000 < absBits), 0x7e00, 0x7c00);
+
+    const uint32_t h = selectBits((uint32_t) (0x477ff000 <= absBits),
+                                  big,
+                                  selectBits((uint32_t) (absBits < 0x38800000),
+                                             denormal,
+                                             normal));
+    return (uint16_t) (sign | h);
+  }
+
+#ifdef OCCA_X86_CPUID
+  OCCA_TARGET("avx,f16c")
+  static uintptr_t f16cFloatToHalf(const float *src, uint16_t *dest, const uintptr_t entries){
+    const uintptr_t vEntries = (entries - (entries % 8));
+
+    for(uintptr_t i = 0; i < vEntries; i += 8)
+      _mm_storeu_si128((__m128i*) (dest + i),
+                       _mm256_cvtps_ph(_mm256_loadu_ps(src + i), 0));
+
+    return vEntries;
+  }
+
+  OCCA_TARGET("avx,f16c")
+  static uintptr_t f16cHalfToFloat(const uint16_t *src, float *dest, const uintptr_t entries){
+    const uintptr_t vEntries = (entries - (entries % 8));
+
+    for(uintptr_t i = 0; i < vEntries; i += 8)
+      _mm256_storeu_ps(dest + i,
+                       _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (src + i))));
+
+    return vEntries;
+  }
+
+  OCCA_TARGET("avx512f")
+  static uintptr_t avx512FloatToHalf(const float *src, uint16_t *dest, const uintptr_t entries){
+    const uintptr_t vEntries = (entries - (entries % 16));
+
+    for(uintptr_t i = 0; i < vEntries; i += 16)
+      _mm256_storeu_si256((__m256i*) (dest + i),
+                          _mm512_cvtps_ph(_mm512_loadu_ps(src + i), 0));
+
+    return vEntries;
+  }
+
+  OCCA_TARGET("avx512f")
+  static uintptr_t avx512HalfToFloat(const uint16_t *src, float *dest, const uintptr_t entries){
+    const uintptr_t vEntries = (entries - (entries % 16));
+
+    for(uintptr_t i = 0; i < vEntries; i += 16)
+      _mm512_storeu_ps(dest + i,
+                       _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i*) (src + i))));
+
+    return vEntries;
+  }
+#endif
+
+  void floatToHalf(const float *src, uint16_t *dest, const uintptr_t entries){
+    uintptr_t done = 0;
+
+#ifdef OCCA_X86_CPUID
+    const int isa = getHostISA();
+
+    if(isa == cpuISA::avx512)
+      done = avx512FloatToHalf(src, dest, entries);
+    else if(isa == cpuISA::avx2)
+      done = f16cFloatToHalf(src, dest, entries);
+#endif
+
+    for(uintptr_t i = done; i < entries; ++i)
+      dest[i] = floatToHalfBits(src[i]);
+  }
+
+  void halfToFloat(const uint16_t *src, float *dest, const uintptr_t entries){
+    uintptr_t done = 0;
+
+#ifdef OCCA_X86_CPUID
+    const int isa = getHostISA();
+
+    if(isa == cpuISA::avx512)
+      done = avx512HalfToFloat(src, dest, entries);
+    else if(isa == cpuISA::avx2)
+      done = f16cHalfToFloat(src, dest, entries);
+#endif
+
+    for(uintptr_t i = done; i < entries; ++i)
+      dest[i] = halfBitsToFloat(src[i]);
+  }
+
+  void floatToBfloat16(const float *src, uint16_t *dest, const uintptr_t entries){
+    for(uintptr_t i = 0; i < entries; ++i){
+      const uint32_t bits = floatBits(src[i]);
+
+      const uint32_t rounded = (bits + 0x7fff + ((bits >> 16) & 1)) >> 16;
+      const uint32_t isNaN   = (uint32_t) (0x7f800000 < (bits & 0x7fffffff));
+
+      dest[i] = (uint16_t) selectBits(isNaN, (bits >> 16) | 0x40, rounded);
+    }
+  }
+
+  void bfloat16ToFloat(const uint16_t *src, float *dest, const uintptr_t entries){
+    for(uintptr_t i = 0; i < entries; ++i)
+      dest[i] = bitsToFloat(((uint32_t) src[i]) << 16);
+  }
+  //==================================
+
+  //---[ CPU Pages ]------------------
+  int pageTypeFromString(const std::string &str_){
+    // Setup values come back tokenized ("2 MB")
+    std::string str;
+
+    for(size_t i = 0; i < str_.size(); ++i){
+      if(!isspace(str_[i]))
+        str += str_[i];
+    }
+
+    if((str == "none") || (str == "regular"))
+      return pageType::regular;
+
+    if((str == "transparent") || (str == "THP"))
+      return pageType::transparent;
+
+    if(str == "2MB")
+      return pageType::huge2MB;
+
+    if(str == "1GB")
+      return pageType::huge1GB;
+
+    std::cout << "Huge pages [" << str << "] are not supported, using regular pages\n"
+              << "  Options: none, transparent, 2MB, 1GB\n";
+
+    return pageType::regular;
+  }
+
+  std::string pageSizeName(const uintptr_t bytes){
+    std::stringstream ss;
+
+    if(bytes && ((bytes % (1 << 30)) == 0))
+      ss << (bytes >> 30) << "GB";
+    else if(bytes && ((bytes % (1 << 20)) == 0))
+      ss << (bytes >> 20) << "MB";
+    else if(bytes && ((bytes % (1 << 10)) == 0))
+      ss << (bytes >> 10) << "KB";
+    else
+      ss << bytes << "B";
+
+    return ss.str();
+  }
+
+#if OCCA_OS == LINUX_OS
+  // 0 when transparent huge pages are disabled
+  static uintptr_t transparentPageBytes(){
+    static uintptr_t pageBytes = ~((uintptr_t) 0);
+
+    if(pageBytes != ~((uintptr_t) 0))
+      return pageBytes;
+
+    pageBytes = 0;
+
+    const char *enabledFile = "/sys/kernel/mm/transparent_hugepage/enabled";
+    const char *sizeFile    = "/sys/kernel/mm/transparent_hugepage/hpage_pmd_size";
+
+    if(!fileExists(enabledFile) ||
+       (readFile(enabledFile).find("[never]") != std::string::npos)){
+
+      return pageBytes;
+    }
+
+    pageBytes = (2 << 20);
+
+    if(fileExists(sizeFile)){
+      std::stringstream ss(readFile(sizeFile));
+      ss >> pageBytes;
+    }
+
+    return pageBytes;
+  }
+
+  static void* hugeMalloc(const uintptr_t bytes,
+                          const int log2PageBytes,
+                          uintptr_t &pageBytes,
+                          uintptr_t &mappedBytes){
+#ifdef MAP_HUGETLB
+#  ifndef MAP_HUGE_SHIFT
+#    define MAP_HUGE_SHIFT 26
+#  endif
+    const uintptr_t hugeBytes = (((uintptr_t) 1) << log2PageBytes);
+    const uintptr_t mapBytes  = ((bytes + hugeBytes - 1) / hugeBytes) * hugeBytes;
+
+    void *ptr = mmap(NULL, mapBytes,
+                     PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | (log2PageBytes << MAP_HUGE_SHIFT),
+                     -1, 0);
+
+    if(ptr == MAP_FAILED)
+      return NULL;
+
+    pageBytes   = hugeBytes;
+    mappedBytes = mapBytes;
+
+    return ptr;
+#else
+    return NULL;
+#endif
+  }
+#endif
+
+  void* cpuMalloc(const uintptr_t bytes,
+                  const int pages,
+                  const int defaultPages,
+                  uintptr_t &pageBytes,
+                  uintptr_t &mappedBytes){
+    void *ptr = NULL;
+
+    pageBytes   = 0;
+    mappedBytes = 0;
+
+#if OCCA_OS == LINUX_OS
+    pageBytes = sysconf(_SC_PAGESIZE);
+
+    int pages_ = pages;
+
+    // Device defaults skip buffers smaller than a huge page
+    if(pages_ == pageType::deviceDefault)
+      pages_ = ((bytes < (2 << 20)) ? pageType::regular : defaultPages);
+
+    // Transparent huge pages are also the fallback for hugetlbfs pages
+    const uintptr_t thpBytes = transparentPageBytes();
+
+    uintptr_t requestedPageBytes = 0;
+
+    switch(pages_){
+    case pageType::huge1GB:     requestedPageBytes = (1 << 30);                         break;
+    case pageType::huge2MB:     requestedPageBytes = (2 << 20);                         break;
+    case pageType::transparent: requestedPageBytes = (thpBytes ? thpBytes : (2 << 20)); break;
+    }
+
+    if(pages_ == pageType::huge1GB)
+      ptr = hugeMalloc(bytes, 30, pageBytes, mappedBytes);
+
+    if((ptr == NULL) &&
+       ((pages_ == pageType::huge1GB) ||
+        (pages_ == pageType::huge2MB))){
+
+      ptr = hugeMalloc(bytes, 21, pageBytes, mappedBytes);
+    }
+
+    if((ptr == NULL) && requestedPageBytes && thpBytes){
+      if(posix_memalign(&ptr, thpBytes, bytes) == 0){
+        if(madvise(ptr, bytes, MADV_HUGEPAGE) == 0)
+          pageBytes = thpBytes;
+      }
+      else
+        ptr = NULL;
+    }
+
+    if(ptr == NULL)
+      posix_memalign(&ptr, OCCA_MEM_ALIGN, bytes);
+
+    if(pageBytes < requestedPageBytes){
+      std::cout << "Huge pages [" << pageSizeName(requestedPageBytes) << "] are unavailable, "
+                << "[" << bytes << "] bytes are backed by [" << pageSizeName(pageBytes) << "] pages\n";
+    }
+#else
+    ptr = ::malloc(bytes);
+#endif
+
+    return ptr;
+  }
+
+  void cpuFree(void *ptr, const uintptr_t mappedBytes){
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    if(mappedBytes){
+      munmap(ptr, mappedBytes);
+      return;
+    }
+#endif
+
+    ::free(ptr);
+  }
+  //==================================
+
+
+  //---[ CPU Shared Memory ]----------
+  class sharedFooter_t {
+  public:
+    volatile uintptr_t fence;
+    uintptr_t bytes;
+  };
+
+  static const uintptr_t sharedFooterBytes = 64;
+
+  static std::string sharedMemoryName(const std::string &name){
+    if(name.size() && (name[0] == '/'))
+      return name;
+
+    return ("/" + name);
+  }
+
+  static sharedFooter_t* sharedFooter(void *ptr, const uintptr_t mappedBytes){
+    return (sharedFooter_t*) (((char*) ptr) + mappedBytes - sharedFooterBytes);
+  }
+
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+  static void* mapShared(const std::string &name,
+                         const int fd,
+                         const uintptr_t mappedBytes){
+    void *ptr = mmap(NULL, mappedBytes,
+                     PROT_READ | PROT_WRITE, MAP_SHARED,
+                     fd, 0);
+
+    ::close(fd);
+
+    if(ptr == MAP_FAILED){
+      std::cout << "Could not map shared memory [" << name << "]\n";
+      throw 1;
+    }
+
+    return ptr;
+  }
+#endif
+
+  void* cpuMallocShared(const std::string &name,
+                        const uintptr_t bytes,
+                        uintptr_t &mappedBytes){
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    const std::string shmName = sharedMemoryName(name);
+
+    const int fd = shm_open(shmName.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+
+    if(fd == -1){
+      std::cout << "Could not create shared memory [" << name << "]"
+                << ((errno == EEXIST) ? ", the name is already in use\n" : "\n");
+      throw 1;
+    }
+
+    mappedBytes = (((bytes + sharedFooterBytes - 1) / sharedFooterBytes) * sharedFooterBytes
+                   + sharedFooterBytes);
+
+    if(ftruncate(fd, mappedBytes)){
+      ::close(fd);
+      shm_unlink(shmName.c_str());
+
+      std::cout << "Could not resize shared memory [" << name << "] to [" << mappedBytes << "] bytes\n";
+      throw 1;
+    }
+
+    void *ptr = mapShared(name, fd, mappedBytes);
+
+    sharedFooter_t &footer = *(sharedFooter(ptr, mappedBytes));
+
+    footer.fence = 0;
+    footer.bytes = bytes;
+
+    return ptr;
+#else
+    std::cout << "Shared memory is only supported in Linux and OSX\n";
+    throw 1;
+
+    return NULL;
+#endif
+  }
+
+  void* cpuOpenShared(const std::string &name,
+                      uintptr_t &bytes,
+                      uintptr_t &mappedBytes){
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    const std::string shmName = sharedMemoryName(name);
+
+    const int fd = shm_open(shmName.c_str(), O_RDWR, 0600);
+
+    if(fd == -1){
+      std::cout << "Could not open shared memory [" << name << "]\n";
+      throw 1;
+    }
+
+    struct stat info;
+
+    if(fstat(fd, &info) || (info.st_size < (off_t) sharedFooterBytes)){
+      ::close(fd);
+
+      std::cout << "Shared memory [" << name << "] was not created by OCCA\n";
+      throw 1;
+    }
+
+    mappedBytes = info.st_size;
+
+    void *ptr = mapShared(name, fd, mappedBytes);
+
+    bytes = sharedFooter(ptr, mappedBytes)->bytes;
+
+    return ptr;
+#else
+    std::cout << "Shared memory is only supported in Linux and OSX\n";
+    throw 1;
+
+    return NULL;
+#endif
+  }
+
+  void cpuUnlinkShared(const std::string &name){
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    shm_unlink(sharedMemoryName(name).c_str());
+#endif
+  }
+
+  uintptr_t cpuSignalShared(void *ptr, const uintptr_t mappedBytes){
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    sharedFooter_t &footer = *(sharedFooter(ptr, mappedBytes));
+
+    // Full barrier, writes to the buffer are visible before the fence
+    return __sync_add_and_fetch(&(footer.fence), 1);
+#else
+    return 0;
+#endif
+  }
+
+  void cpuWaitForShared(void *ptr, const uintptr_t mappedBytes,
+                        const uintptr_t value){
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    sharedFooter_t &footer = *(sharedFooter(ptr, mappedBytes));
+
+    while(footer.fence < value)
+      sched_yield();
+
+    __sync_synchronize();
+#endif
+  }
+  //==================================
+
+
+  //---[ CPU File Mapping ]-----------
+  void* cpuMmapFile(const std::string &filename,
+                    uintptr_t &bytes,
+                    const int flags){
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    const bool writable = (flags & fileMap::write);
+
+    int openFlags = (writable ? O_RDWR : O_RDONLY);
+
+    if(flags & fileMap::create)
+      openFlags |= O_CREAT;
+
+    const int fd = ::open(filename.c_str(), openFlags, 0644);
+
+    if(fd == -1){
+      std::cout << "Could not open [" << filename << "] to map it\n";
+      throw 1;
+    }
+
+    struct stat info;
+    fstat(fd, &info);
+
+    if(bytes == 0)
+      bytes = info.st_size;
+
+    if((flags & fileMap::create) && ((uintptr_t) info.st_size < bytes)){
+      if(ftruncate(fd, bytes)){
+        ::close(fd);
+
+        std::cout << "Could not resize [" << filename << "] to [" << bytes << "] bytes\n";
+        throw 1;
+      }
+    }
+    else if((bytes == 0) || ((uintptr_t) info.st_size < bytes)){
+      ::close(fd);
+
+      std::cout << "Mapping [" << bytes << "] bytes of [" << filename << "] which only has ["
+                << info.st_size << "] bytes, use fileMap::create to grow it\n";
+      throw 1;
+    }
+
+    int mapFlags = MAP_SHARED;
+
+#if OCCA_OS == LINUX_OS
+    if(flags & fileMap::populate)
+      mapFlags |= MAP_POPULATE;
+#endif
+
+    void *ptr = mmap(NULL, bytes,
+                     PROT_READ | (writable ? PROT_WRITE : 0), mapFlags,
+                     fd, 0);
+
+    ::close(fd);
+
+    if(ptr == MAP_FAILED){
+      std::cout << "Could not map [" << filename << "]\n";
+      throw 1;
+    }
+
+    if(flags & fileMap::sequential)
+      madvise(ptr, bytes, MADV_SEQUENTIAL);
+
+    if(flags & fileMap::random)
+      madvise(ptr, bytes, MADV_RANDOM);
+
+    if(flags & fileMap::willNeed)
+      madvise(ptr, bytes, MADV_WILLNEED);
+
+    return ptr;
+#else
+    std::cout << "Mapping files is only supported in Linux and OSX\n";
+    throw 1;
+
+    return NULL;
+#endif
+  }
+
+  void cpuSyncMapped(void *ptr,
+                     const uintptr_t bytes,
+                     const uintptr_t offset){
+#if (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+    // msync() needs a page-aligned start
+    static const uintptr_t pageBytes = sysconf(_SC_PAGESIZE);
+
+    const uintptr_t start = ((uintptr_t) ptr) + offset;
+    const uintptr_t alignedStart = (start - (start % pageBytes));
+
+    msync((void*) alignedStart, bytes + (start - alignedStart), MS_SYNC);
+#endif
   }
+  //==================================
 };
@@ -8,13 +8,13 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -36,19 +36,19 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -70,25 +70,25 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -111,31 +111,31 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -158,37 +158,37 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -211,43 +211,43 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg5.size, arg5.data()));
+                  cl::setKernelArg(data_, argPos++, arg5.size, arg5.data()));
     if(arg5.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg5.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg5.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -271,49 +271,49 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg5.size, arg5.data()));
+                  cl::setKernelArg(data_, argPos++, arg5.size, arg5.data()));
     if(arg5.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg5.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg5.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg6.size, arg6.data()));
+                  cl::setKernelArg(data_, argPos++, arg6.size, arg6.data()));
     if(arg6.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg6.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg6.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -337,55 +337,55 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg5.size, arg5.data()));
+                  cl::setKernelArg(data_, argPos++, arg5.size, arg5.data()));
     if(arg5.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg5.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg5.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg6.size, arg6.data()));
+                  cl::setKernelArg(data_, argPos++, arg6.size, arg6.data()));
     if(arg6.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg6.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg6.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg7.size, arg7.data()));
+                  cl::setKernelArg(data_, argPos++, arg7.size, arg7.data()));
     if(arg7.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg7.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg7.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -409,61 +409,61 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg5.size, arg5.data()));
+                  cl::setKernelArg(data_, argPos++, arg5.size, arg5.data()));
     if(arg5.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg5.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg5.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg6.size, arg6.data()));
+                  cl::setKernelArg(data_, argPos++, arg6.size, arg6.data()));
     if(arg6.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg6.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg6.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg7.size, arg7.data()));
+                  cl::setKernelArg(data_, argPos++, arg7.size, arg7.data()));
     if(arg7.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg7.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg7.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg8.size, arg8.data()));
+                  cl::setKernelArg(data_, argPos++, arg8.size, arg8.data()));
     if(arg8.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg8.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg8.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -488,67 +488,67 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg5.size, arg5.data()));
+                  cl::setKernelArg(data_, argPos++, arg5.size, arg5.data()));
     if(arg5.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg5.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg5.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg6.size, arg6.data()));
+                  cl::setKernelArg(data_, argPos++, arg6.size, arg6.data()));
     if(arg6.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg6.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg6.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg7.size, arg7.data()));
+                  cl::setKernelArg(data_, argPos++, arg7.size, arg7.data()));
     if(arg7.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg7.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg7.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg8.size, arg8.data()));
+                  cl::setKernelArg(data_, argPos++, arg8.size, arg8.data()));
     if(arg8.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg8.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg8.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg9.size, arg9.data()));
+                  cl::setKernelArg(data_, argPos++, arg9.size, arg9.data()));
     if(arg9.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg9.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg9.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -573,73 +573,73 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg5.size, arg5.data()));
+                  cl::setKernelArg(data_, argPos++, arg5.size, arg5.data()));
     if(arg5.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg5.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg5.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg6.size, arg6.data()));
+                  cl::setKernelArg(data_, argPos++, arg6.size, arg6.data()));
     if(arg6.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg6.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg6.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg7.size, arg7.data()));
+                  cl::setKernelArg(data_, argPos++, arg7.size, arg7.data()));
     if(arg7.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg7.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg7.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg8.size, arg8.data()));
+                  cl::setKernelArg(data_, argPos++, arg8.size, arg8.data()));
     if(arg8.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg8.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg8.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg9.size, arg9.data()));
+                  cl::setKernelArg(data_, argPos++, arg9.size, arg9.data()));
     if(arg9.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg9.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg9.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg10.size, arg10.data()));
+                  cl::setKernelArg(data_, argPos++, arg10.size, arg10.data()));
     if(arg10.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg10.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg10.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -664,79 +664,79 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg5.size, arg5.data()));
+                  cl::setKernelArg(data_, argPos++, arg5.size, arg5.data()));
     if(arg5.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg5.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg5.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg6.size, arg6.data()));
+                  cl::setKernelArg(data_, argPos++, arg6.size, arg6.data()));
     if(arg6.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg6.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg6.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg7.size, arg7.data()));
+                  cl::setKernelArg(data_, argPos++, arg7.size, arg7.data()));
     if(arg7.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg7.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg7.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg8.size, arg8.data()));
+                  cl::setKernelArg(data_, argPos++, arg8.size, arg8.data()));
     if(arg8.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg8.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg8.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg9.size, arg9.data()));
+                  cl::setKernelArg(data_, argPos++, arg9.size, arg9.data()));
     if(arg9.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg9.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg9.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg10.size, arg10.data()));
+                  cl::setKernelArg(data_, argPos++, arg10.size, arg10.data()));
     if(arg10.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg10.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg10.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg11.size, arg11.data()));
+                  cl::setKernelArg(data_, argPos++, arg11.size, arg11.data()));
     if(arg11.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg11.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg11.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -762,85 +762,85 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg5.size, arg5.data()));
+                  cl::setKernelArg(data_, argPos++, arg5.size, arg5.data()));
     if(arg5.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg5.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg5.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg6.size, arg6.data()));
+                  cl::setKernelArg(data_, argPos++, arg6.size, arg6.data()));
     if(arg6.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg6.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg6.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg7.size, arg7.data()));
+                  cl::setKernelArg(data_, argPos++, arg7.size, arg7.data()));
     if(arg7.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg7.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg7.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg8.size, arg8.data()));
+                  cl::setKernelArg(data_, argPos++, arg8.size, arg8.data()));
     if(arg8.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg8.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg8.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg9.size, arg9.data()));
+                  cl::setKernelArg(data_, argPos++, arg9.size, arg9.data()));
     if(arg9.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg9.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg9.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg10.size, arg10.data()));
+                  cl::setKernelArg(data_, argPos++, arg10.size, arg10.data()));
     if(arg10.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg10.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg10.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg11.size, arg11.data()));
+                  cl::setKernelArg(data_, argPos++, arg11.size, arg11.data()));
     if(arg11.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg11.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg11.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg12.size, arg12.data()));
+                  cl::setKernelArg(data_, argPos++, arg12.size, arg12.data()));
     if(arg12.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg12.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg12.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -866,91 +866,91 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg5.size, arg5.data()));
+                  cl::setKernelArg(data_, argPos++, arg5.size, arg5.data()));
     if(arg5.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg5.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg5.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg6.size, arg6.data()));
+                  cl::setKernelArg(data_, argPos++, arg6.size, arg6.data()));
     if(arg6.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg6.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg6.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg7.size, arg7.data()));
+                  cl::setKernelArg(data_, argPos++, arg7.size, arg7.data()));
     if(arg7.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg7.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg7.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg8.size, arg8.data()));
+                  cl::setKernelArg(data_, argPos++, arg8.size, arg8.data()));
     if(arg8.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg8.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg8.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg9.size, arg9.data()));
+                  cl::setKernelArg(data_, argPos++, arg9.size, arg9.data()));
     if(arg9.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg9.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg9.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg10.size, arg10.data()));
+                  cl::setKernelArg(data_, argPos++, arg10.size, arg10.data()));
     if(arg10.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg10.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg10.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg11.size, arg11.data()));
+                  cl::setKernelArg(data_, argPos++, arg11.size, arg11.data()));
     if(arg11.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg11.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg11.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg12.size, arg12.data()));
+                  cl::setKernelArg(data_, argPos++, arg12.size, arg12.data()));
     if(arg12.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg12.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg12.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg13.size, arg13.data()));
+                  cl::setKernelArg(data_, argPos++, arg13.size, arg13.data()));
     if(arg13.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg13.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg13.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -976,97 +976,97 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg5.size, arg5.data()));
+                  cl::setKernelArg(data_, argPos++, arg5.size, arg5.data()));
     if(arg5.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg5.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg5.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg6.size, arg6.data()));
+                  cl::setKernelArg(data_, argPos++, arg6.size, arg6.data()));
     if(arg6.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg6.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg6.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg7.size, arg7.data()));
+                  cl::setKernelArg(data_, argPos++, arg7.size, arg7.data()));
     if(arg7.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg7.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg7.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg8.size, arg8.data()));
+                  cl::setKernelArg(data_, argPos++, arg8.size, arg8.data()));
     if(arg8.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg8.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg8.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg9.size, arg9.data()));
+                  cl::setKernelArg(data_, argPos++, arg9.size, arg9.data()));
     if(arg9.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg9.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg9.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg10.size, arg10.data()));
+                  cl::setKernelArg(data_, argPos++, arg10.size, arg10.data()));
     if(arg10.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg10.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg10.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg11.size, arg11.data()));
+                  cl::setKernelArg(data_, argPos++, arg11.size, arg11.data()));
     if(arg11.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg11.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg11.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg12.size, arg12.data()));
+                  cl::setKernelArg(data_, argPos++, arg12.size, arg12.data()));
     if(arg12.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg12.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg12.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg13.size, arg13.data()));
+                  cl::setKernelArg(data_, argPos++, arg13.size, arg13.data()));
     if(arg13.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg13.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg13.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg14.size, arg14.data()));
+                  cl::setKernelArg(data_, argPos++, arg14.size, arg14.data()));
     if(arg14.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg14.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg14.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -1093,103 +1093,103 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg5.size, arg5.data()));
+                  cl::setKernelArg(data_, argPos++, arg5.size, arg5.data()));
     if(arg5.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg5.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg5.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg6.size, arg6.data()));
+                  cl::setKernelArg(data_, argPos++, arg6.size, arg6.data()));
     if(arg6.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg6.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg6.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg7.size, arg7.data()));
+                  cl::setKernelArg(data_, argPos++, arg7.size, arg7.data()));
     if(arg7.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg7.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg7.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg8.size, arg8.data()));
+                  cl::setKernelArg(data_, argPos++, arg8.size, arg8.data()));
     if(arg8.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg8.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg8.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg9.size, arg9.data()));
+                  cl::setKernelArg(data_, argPos++, arg9.size, arg9.data()));
     if(arg9.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg9.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg9.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg10.size, arg10.data()));
+                  cl::setKernelArg(data_, argPos++, arg10.size, arg10.data()));
     if(arg10.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg10.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg10.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg11.size, arg11.data()));
+                  cl::setKernelArg(data_, argPos++, arg11.size, arg11.data()));
     if(arg11.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg11.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg11.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg12.size, arg12.data()));
+                  cl::setKernelArg(data_, argPos++, arg12.size, arg12.data()));
     if(arg12.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg12.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg12.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg13.size, arg13.data()));
+                  cl::setKernelArg(data_, argPos++, arg13.size, arg13.data()));
     if(arg13.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg13.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg13.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg14.size, arg14.data()));
+                  cl::setKernelArg(data_, argPos++, arg14.size, arg14.data()));
     if(arg14.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg14.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg14.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg15.size, arg15.data()));
+                  cl::setKernelArg(data_, argPos++, arg15.size, arg15.data()));
     if(arg15.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg15.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg15.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -1216,109 +1216,109 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg5.size, arg5.data()));
+                  cl::setKernelArg(data_, argPos++, arg5.size, arg5.data()));
     if(arg5.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg5.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg5.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg6.size, arg6.data()));
+                  cl::setKernelArg(data_, argPos++, arg6.size, arg6.data()));
     if(arg6.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg6.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg6.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg7.size, arg7.data()));
+                  cl::setKernelArg(data_, argPos++, arg7.size, arg7.data()));
     if(arg7.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg7.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg7.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg8.size, arg8.data()));
+                  cl::setKernelArg(data_, argPos++, arg8.size, arg8.data()));
     if(arg8.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg8.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg8.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg9.size, arg9.data()));
+                  cl::setKernelArg(data_, argPos++, arg9.size, arg9.data()));
     if(arg9.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg9.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg9.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg10.size, arg10.data()));
+                  cl::setKernelArg(data_, argPos++, arg10.size, arg10.data()));
     if(arg10.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg10.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg10.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg11.size, arg11.data()));
+                  cl::setKernelArg(data_, argPos++, arg11.size, arg11.data()));
     if(arg11.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg11.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg11.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg12.size, arg12.data()));
+                  cl::setKernelArg(data_, argPos++, arg12.size, arg12.data()));
     if(arg12.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg12.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg12.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg13.size, arg13.data()));
+                  cl::setKernelArg(data_, argPos++, arg13.size, arg13.data()));
     if(arg13.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg13.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg13.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg14.size, arg14.data()));
+                  cl::setKernelArg(data_, argPos++, arg14.size, arg14.data()));
     if(arg14.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg14.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg14.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg15.size, arg15.data()));
+                  cl::setKernelArg(data_, argPos++, arg15.size, arg15.data()));
     if(arg15.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg15.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg15.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg16.size, arg16.data()));
+                  cl::setKernelArg(data_, argPos++, arg16.size, arg16.data()));
     if(arg16.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg16.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg16.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -1345,115 +1345,115 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg5.size, arg5.data()));
+                  cl::setKernelArg(data_, argPos++, arg5.size, arg5.data()));
     if(arg5.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg5.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg5.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg6.size, arg6.data()));
+                  cl::setKernelArg(data_, argPos++, arg6.size, arg6.data()));
     if(arg6.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg6.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg6.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg7.size, arg7.data()));
+                  cl::setKernelArg(data_, argPos++, arg7.size, arg7.data()));
     if(arg7.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg7.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg7.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg8.size, arg8.data()));
+                  cl::setKernelArg(data_, argPos++, arg8.size, arg8.data()));
     if(arg8.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg8.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg8.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg9.size, arg9.data()));
+                  cl::setKernelArg(data_, argPos++, arg9.size, arg9.data()));
     if(arg9.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg9.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg9.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg10.size, arg10.data()));
+                  cl::setKernelArg(data_, argPos++, arg10.size, arg10.data()));
     if(arg10.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg10.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg10.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg11.size, arg11.data()));
+                  cl::setKernelArg(data_, argPos++, arg11.size, arg11.data()));
     if(arg11.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg11.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg11.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg12.size, arg12.data()));
+                  cl::setKernelArg(data_, argPos++, arg12.size, arg12.data()));
     if(arg12.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg12.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg12.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg13.size, arg13.data()));
+                  cl::setKernelArg(data_, argPos++, arg13.size, arg13.data()));
     if(arg13.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg13.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg13.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg14.size, arg14.data()));
+                  cl::setKernelArg(data_, argPos++, arg14.size, arg14.data()));
     if(arg14.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg14.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg14.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg15.size, arg15.data()));
+                  cl::setKernelArg(data_, argPos++, arg15.size, arg15.data()));
     if(arg15.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg15.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg15.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg16.size, arg16.data()));
+                  cl::setKernelArg(data_, argPos++, arg16.size, arg16.data()));
     if(arg16.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg16.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg16.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg17.size, arg17.data()));
+                  cl::setKernelArg(data_, argPos++, arg17.size, arg17.data()));
     if(arg17.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg17.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg17.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -1481,121 +1481,121 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg5.size, arg5.data()));
+                  cl::setKernelArg(data_, argPos++, arg5.size, arg5.data()));
     if(arg5.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg5.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg5.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg6.size, arg6.data()));
+                  cl::setKernelArg(data_, argPos++, arg6.size, arg6.data()));
     if(arg6.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg6.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg6.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg7.size, arg7.data()));
+                  cl::setKernelArg(data_, argPos++, arg7.size, arg7.data()));
     if(arg7.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg7.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg7.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg8.size, arg8.data()));
+                  cl::setKernelArg(data_, argPos++, arg8.size, arg8.data()));
     if(arg8.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg8.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg8.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg9.size, arg9.data()));
+                  cl::setKernelArg(data_, argPos++, arg9.size, arg9.data()));
     if(arg9.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg9.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg9.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg10.size, arg10.data()));
+                  cl::setKernelArg(data_, argPos++, arg10.size, arg10.data()));
     if(arg10.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg10.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg10.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg11.size, arg11.data()));
+                  cl::setKernelArg(data_, argPos++, arg11.size, arg11.data()));
     if(arg11.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg11.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg11.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg12.size, arg12.data()));
+                  cl::setKernelArg(data_, argPos++, arg12.size, arg12.data()));
     if(arg12.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg12.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg12.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg13.size, arg13.data()));
+                  cl::setKernelArg(data_, argPos++, arg13.size, arg13.data()));
     if(arg13.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg13.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg13.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg14.size, arg14.data()));
+                  cl::setKernelArg(data_, argPos++, arg14.size, arg14.data()));
     if(arg14.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg14.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg14.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg15.size, arg15.data()));
+                  cl::setKernelArg(data_, argPos++, arg15.size, arg15.data()));
     if(arg15.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg15.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg15.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg16.size, arg16.data()));
+                  cl::setKernelArg(data_, argPos++, arg16.size, arg16.data()));
     if(arg16.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg16.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg16.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg17.size, arg17.data()));
+                  cl::setKernelArg(data_, argPos++, arg17.size, arg17.data()));
     if(arg17.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg17.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg17.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg18.size, arg18.data()));
+                  cl::setKernelArg(data_, argPos++, arg18.size, arg18.data()));
     if(arg18.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg18.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg18.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -1623,127 +1623,127 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg5.size, arg5.data()));
+                  cl::setKernelArg(data_, argPos++, arg5.size, arg5.data()));
     if(arg5.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg5.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg5.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg6.size, arg6.data()));
+                  cl::setKernelArg(data_, argPos++, arg6.size, arg6.data()));
     if(arg6.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg6.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg6.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg7.size, arg7.data()));
+                  cl::setKernelArg(data_, argPos++, arg7.size, arg7.data()));
     if(arg7.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg7.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg7.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg8.size, arg8.data()));
+                  cl::setKernelArg(data_, argPos++, arg8.size, arg8.data()));
     if(arg8.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg8.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg8.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg9.size, arg9.data()));
+                  cl::setKernelArg(data_, argPos++, arg9.size, arg9.data()));
     if(arg9.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg9.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg9.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg10.size, arg10.data()));
+                  cl::setKernelArg(data_, argPos++, arg10.size, arg10.data()));
     if(arg10.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg10.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg10.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg11.size, arg11.data()));
+                  cl::setKernelArg(data_, argPos++, arg11.size, arg11.data()));
     if(arg11.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg11.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg11.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg12.size, arg12.data()));
+                  cl::setKernelArg(data_, argPos++, arg12.size, arg12.data()));
     if(arg12.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg12.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg12.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg13.size, arg13.data()));
+                  cl::setKernelArg(data_, argPos++, arg13.size, arg13.data()));
     if(arg13.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg13.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg13.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg14.size, arg14.data()));
+                  cl::setKernelArg(data_, argPos++, arg14.size, arg14.data()));
     if(arg14.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg14.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg14.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg15.size, arg15.data()));
+                  cl::setKernelArg(data_, argPos++, arg15.size, arg15.data()));
     if(arg15.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg15.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg15.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg16.size, arg16.data()));
+                  cl::setKernelArg(data_, argPos++, arg16.size, arg16.data()));
     if(arg16.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg16.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg16.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg17.size, arg17.data()));
+                  cl::setKernelArg(data_, argPos++, arg17.size, arg17.data()));
     if(arg17.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg17.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg17.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg18.size, arg18.data()));
+                  cl::setKernelArg(data_, argPos++, arg18.size, arg18.data()));
     if(arg18.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg18.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg18.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg19.size, arg19.data()));
+                  cl::setKernelArg(data_, argPos++, arg19.size, arg19.data()));
     if(arg19.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg19.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg19.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -1771,133 +1771,133 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg5.size, arg5.data()));
+                  cl::setKernelArg(data_, argPos++, arg5.size, arg5.data()));
     if(arg5.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg5.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg5.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg6.size, arg6.data()));
+                  cl::setKernelArg(data_, argPos++, arg6.size, arg6.data()));
     if(arg6.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg6.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg6.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg7.size, arg7.data()));
+                  cl::setKernelArg(data_, argPos++, arg7.size, arg7.data()));
     if(arg7.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg7.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg7.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg8.size, arg8.data()));
+                  cl::setKernelArg(data_, argPos++, arg8.size, arg8.data()));
     if(arg8.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg8.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg8.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg9.size, arg9.data()));
+                  cl::setKernelArg(data_, argPos++, arg9.size, arg9.data()));
     if(arg9.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg9.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg9.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg10.size, arg10.data()));
+                  cl::setKernelArg(data_, argPos++, arg10.size, arg10.data()));
     if(arg10.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg10.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg10.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg11.size, arg11.data()));
+                  cl::setKernelArg(data_, argPos++, arg11.size, arg11.data()));
     if(arg11.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg11.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg11.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg12.size, arg12.data()));
+                  cl::setKernelArg(data_, argPos++, arg12.size, arg12.data()));
     if(arg12.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg12.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg12.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg13.size, arg13.data()));
+                  cl::setKernelArg(data_, argPos++, arg13.size, arg13.data()));
     if(arg13.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg13.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg13.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg14.size, arg14.data()));
+                  cl::setKernelArg(data_, argPos++, arg14.size, arg14.data()));
     if(arg14.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg14.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg14.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg15.size, arg15.data()));
+                  cl::setKernelArg(data_, argPos++, arg15.size, arg15.data()));
     if(arg15.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg15.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg15.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg16.size, arg16.data()));
+                  cl::setKernelArg(data_, argPos++, arg16.size, arg16.data()));
     if(arg16.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg16.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg16.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg17.size, arg17.data()));
+                  cl::setKernelArg(data_, argPos++, arg17.size, arg17.data()));
     if(arg17.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg17.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg17.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg18.size, arg18.data()));
+                  cl::setKernelArg(data_, argPos++, arg18.size, arg18.data()));
     if(arg18.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg18.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg18.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg19.size, arg19.data()));
+                  cl::setKernelArg(data_, argPos++, arg19.size, arg19.data()));
     if(arg19.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg19.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg19.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg20.size, arg20.data()));
+                  cl::setKernelArg(data_, argPos++, arg20.size, arg20.data()));
     if(arg20.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg20.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg20.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -1926,139 +1926,139 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg5.size, arg5.data()));
+                  cl::setKernelArg(data_, argPos++, arg5.size, arg5.data()));
     if(arg5.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg5.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg5.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg6.size, arg6.data()));
+                  cl::setKernelArg(data_, argPos++, arg6.size, arg6.data()));
     if(arg6.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg6.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg6.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg7.size, arg7.data()));
+                  cl::setKernelArg(data_, argPos++, arg7.size, arg7.data()));
     if(arg7.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg7.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg7.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg8.size, arg8.data()));
+                  cl::setKernelArg(data_, argPos++, arg8.size, arg8.data()));
     if(arg8.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg8.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg8.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg9.size, arg9.data()));
+                  cl::setKernelArg(data_, argPos++, arg9.size, arg9.data()));
     if(arg9.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg9.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg9.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg10.size, arg10.data()));
+                  cl::setKernelArg(data_, argPos++, arg10.size, arg10.data()));
     if(arg10.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg10.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg10.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg11.size, arg11.data()));
+                  cl::setKernelArg(data_, argPos++, arg11.size, arg11.data()));
     if(arg11.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg11.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg11.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg12.size, arg12.data()));
+                  cl::setKernelArg(data_, argPos++, arg12.size, arg12.data()));
     if(arg12.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg12.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg12.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg13.size, arg13.data()));
+                  cl::setKernelArg(data_, argPos++, arg13.size, arg13.data()));
     if(arg13.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg13.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg13.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg14.size, arg14.data()));
+                  cl::setKernelArg(data_, argPos++, arg14.size, arg14.data()));
     if(arg14.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg14.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg14.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg15.size, arg15.data()));
+                  cl::setKernelArg(data_, argPos++, arg15.size, arg15.data()));
     if(arg15.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg15.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg15.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg16.size, arg16.data()));
+                  cl::setKernelArg(data_, argPos++, arg16.size, arg16.data()));
     if(arg16.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg16.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg16.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg17.size, arg17.data()));
+                  cl::setKernelArg(data_, argPos++, arg17.size, arg17.data()));
     if(arg17.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg17.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg17.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg18.size, arg18.data()));
+                  cl::setKernelArg(data_, argPos++, arg18.size, arg18.data()));
     if(arg18.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg18.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg18.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg19.size, arg19.data()));
+                  cl::setKernelArg(data_, argPos++, arg19.size, arg19.data()));
     if(arg19.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg19.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg19.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg20.size, arg20.data()));
+                  cl::setKernelArg(data_, argPos++, arg20.size, arg20.data()));
     if(arg20.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg20.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg20.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg21.size, arg21.data()));
+                  cl::setKernelArg(data_, argPos++, arg21.size, arg21.data()));
     if(arg21.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg21.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg21.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -2087,145 +2087,145 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg5.size, arg5.data()));
+                  cl::setKernelArg(data_, argPos++, arg5.size, arg5.data()));
     if(arg5.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg5.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg5.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg6.size, arg6.data()));
+                  cl::setKernelArg(data_, argPos++, arg6.size, arg6.data()));
     if(arg6.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg6.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg6.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg7.size, arg7.data()));
+                  cl::setKernelArg(data_, argPos++, arg7.size, arg7.data()));
     if(arg7.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg7.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg7.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg8.size, arg8.data()));
+                  cl::setKernelArg(data_, argPos++, arg8.size, arg8.data()));
     if(arg8.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg8.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg8.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg9.size, arg9.data()));
+                  cl::setKernelArg(data_, argPos++, arg9.size, arg9.data()));
     if(arg9.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg9.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg9.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg10.size, arg10.data()));
+                  cl::setKernelArg(data_, argPos++, arg10.size, arg10.data()));
     if(arg10.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg10.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg10.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg11.size, arg11.data()));
+                  cl::setKernelArg(data_, argPos++, arg11.size, arg11.data()));
     if(arg11.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg11.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg11.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg12.size, arg12.data()));
+                  cl::setKernelArg(data_, argPos++, arg12.size, arg12.data()));
     if(arg12.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg12.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg12.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg13.size, arg13.data()));
+                  cl::setKernelArg(data_, argPos++, arg13.size, arg13.data()));
     if(arg13.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg13.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg13.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg14.size, arg14.data()));
+                  cl::setKernelArg(data_, argPos++, arg14.size, arg14.data()));
     if(arg14.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg14.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg14.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg15.size, arg15.data()));
+                  cl::setKernelArg(data_, argPos++, arg15.size, arg15.data()));
     if(arg15.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg15.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg15.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg16.size, arg16.data()));
+                  cl::setKernelArg(data_, argPos++, arg16.size, arg16.data()));
     if(arg16.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg16.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg16.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg17.size, arg17.data()));
+                  cl::setKernelArg(data_, argPos++, arg17.size, arg17.data()));
     if(arg17.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg17.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg17.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg18.size, arg18.data()));
+                  cl::setKernelArg(data_, argPos++, arg18.size, arg18.data()));
     if(arg18.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg18.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg18.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg19.size, arg19.data()));
+                  cl::setKernelArg(data_, argPos++, arg19.size, arg19.data()));
     if(arg19.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg19.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg19.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg20.size, arg20.data()));
+                  cl::setKernelArg(data_, argPos++, arg20.size, arg20.data()));
     if(arg20.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg20.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg20.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg21.size, arg21.data()));
+                  cl::setKernelArg(data_, argPos++, arg21.size, arg21.data()));
     if(arg21.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg21.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg21.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg22.size, arg22.data()));
+                  cl::setKernelArg(data_, argPos++, arg22.size, arg22.data()));
     if(arg22.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg22.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg22.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -2254,151 +2254,151 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg5.size, arg5.data()));
+                  cl::setKernelArg(data_, argPos++, arg5.size, arg5.data()));
     if(arg5.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg5.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg5.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg6.size, arg6.data()));
+                  cl::setKernelArg(data_, argPos++, arg6.size, arg6.data()));
     if(arg6.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg6.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg6.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg7.size, arg7.data()));
+                  cl::setKernelArg(data_, argPos++, arg7.size, arg7.data()));
     if(arg7.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg7.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg7.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg8.size, arg8.data()));
+                  cl::setKernelArg(data_, argPos++, arg8.size, arg8.data()));
     if(arg8.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg8.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg8.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg9.size, arg9.data()));
+                  cl::setKernelArg(data_, argPos++, arg9.size, arg9.data()));
     if(arg9.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg9.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg9.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg10.size, arg10.data()));
+                  cl::setKernelArg(data_, argPos++, arg10.size, arg10.data()));
     if(arg10.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg10.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg10.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg11.size, arg11.data()));
+                  cl::setKernelArg(data_, argPos++, arg11.size, arg11.data()));
     if(arg11.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg11.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg11.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg12.size, arg12.data()));
+                  cl::setKernelArg(data_, argPos++, arg12.size, arg12.data()));
     if(arg12.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg12.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg12.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg13.size, arg13.data()));
+                  cl::setKernelArg(data_, argPos++, arg13.size, arg13.data()));
     if(arg13.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg13.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg13.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg14.size, arg14.data()));
+                  cl::setKernelArg(data_, argPos++, arg14.size, arg14.data()));
     if(arg14.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg14.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg14.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg15.size, arg15.data()));
+                  cl::setKernelArg(data_, argPos++, arg15.size, arg15.data()));
     if(arg15.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg15.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg15.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg16.size, arg16.data()));
+                  cl::setKernelArg(data_, argPos++, arg16.size, arg16.data()));
     if(arg16.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg16.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg16.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg17.size, arg17.data()));
+                  cl::setKernelArg(data_, argPos++, arg17.size, arg17.data()));
     if(arg17.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg17.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg17.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg18.size, arg18.data()));
+                  cl::setKernelArg(data_, argPos++, arg18.size, arg18.data()));
     if(arg18.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg18.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg18.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg19.size, arg19.data()));
+                  cl::setKernelArg(data_, argPos++, arg19.size, arg19.data()));
     if(arg19.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg19.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg19.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg20.size, arg20.data()));
+                  cl::setKernelArg(data_, argPos++, arg20.size, arg20.data()));
     if(arg20.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg20.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg20.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg21.size, arg21.data()));
+                  cl::setKernelArg(data_, argPos++, arg21.size, arg21.data()));
     if(arg21.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg21.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg21.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg22.size, arg22.data()));
+                  cl::setKernelArg(data_, argPos++, arg22.size, arg22.data()));
     if(arg22.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg22.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg22.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg23.size, arg23.data()));
+                  cl::setKernelArg(data_, argPos++, arg23.size, arg23.data()));
     if(arg23.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg23.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg23.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -2428,157 +2428,157 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg5.size, arg5.data()));
+                  cl::setKernelArg(data_, argPos++, arg5.size, arg5.data()));
     if(arg5.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg5.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg5.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg6.size, arg6.data()));
+                  cl::setKernelArg(data_, argPos++, arg6.size, arg6.data()));
     if(arg6.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg6.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg6.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg7.size, arg7.data()));
+                  cl::setKernelArg(data_, argPos++, arg7.size, arg7.data()));
     if(arg7.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg7.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg7.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg8.size, arg8.data()));
+                  cl::setKernelArg(data_, argPos++, arg8.size, arg8.data()));
     if(arg8.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg8.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg8.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg9.size, arg9.data()));
+                  cl::setKernelArg(data_, argPos++, arg9.size, arg9.data()));
     if(arg9.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg9.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg9.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg10.size, arg10.data()));
+                  cl::setKernelArg(data_, argPos++, arg10.size, arg10.data()));
     if(arg10.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg10.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg10.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg11.size, arg11.data()));
+                  cl::setKernelArg(data_, argPos++, arg11.size, arg11.data()));
     if(arg11.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg11.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg11.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg12.size, arg12.data()));
+                  cl::setKernelArg(data_, argPos++, arg12.size, arg12.data()));
     if(arg12.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg12.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg12.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg13.size, arg13.data()));
+                  cl::setKernelArg(data_, argPos++, arg13.size, arg13.data()));
     if(arg13.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg13.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg13.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg14.size, arg14.data()));
+                  cl::setKernelArg(data_, argPos++, arg14.size, arg14.data()));
     if(arg14.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg14.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg14.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg15.size, arg15.data()));
+                  cl::setKernelArg(data_, argPos++, arg15.size, arg15.data()));
     if(arg15.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg15.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg15.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg16.size, arg16.data()));
+                  cl::setKernelArg(data_, argPos++, arg16.size, arg16.data()));
     if(arg16.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg16.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg16.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg17.size, arg17.data()));
+                  cl::setKernelArg(data_, argPos++, arg17.size, arg17.data()));
     if(arg17.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg17.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg17.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg18.size, arg18.data()));
+                  cl::setKernelArg(data_, argPos++, arg18.size, arg18.data()));
     if(arg18.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg18.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg18.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg19.size, arg19.data()));
+                  cl::setKernelArg(data_, argPos++, arg19.size, arg19.data()));
     if(arg19.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg19.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg19.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg20.size, arg20.data()));
+                  cl::setKernelArg(data_, argPos++, arg20.size, arg20.data()));
     if(arg20.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg20.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg20.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg21.size, arg21.data()));
+                  cl::setKernelArg(data_, argPos++, arg21.size, arg21.data()));
     if(arg21.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg21.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg21.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg22.size, arg22.data()));
+                  cl::setKernelArg(data_, argPos++, arg22.size, arg22.data()));
     if(arg22.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg22.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg22.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg23.size, arg23.data()));
+                  cl::setKernelArg(data_, argPos++, arg23.size, arg23.data()));
     if(arg23.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg23.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg23.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg24.size, arg24.data()));
+                  cl::setKernelArg(data_, argPos++, arg24.size, arg24.data()));
     if(arg24.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg24.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg24.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -2608,163 +2608,163 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg5.size, arg5.data()));
+                  cl::setKernelArg(data_, argPos++, arg5.size, arg5.data()));
     if(arg5.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg5.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg5.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg6.size, arg6.data()));
+                  cl::setKernelArg(data_, argPos++, arg6.size, arg6.data()));
     if(arg6.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg6.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg6.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg7.size, arg7.data()));
+                  cl::setKernelArg(data_, argPos++, arg7.size, arg7.data()));
     if(arg7.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg7.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg7.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg8.size, arg8.data()));
+                  cl::setKernelArg(data_, argPos++, arg8.size, arg8.data()));
     if(arg8.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg8.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg8.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg9.size, arg9.data()));
+                  cl::setKernelArg(data_, argPos++, arg9.size, arg9.data()));
     if(arg9.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg9.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg9.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg10.size, arg10.data()));
+                  cl::setKernelArg(data_, argPos++, arg10.size, arg10.data()));
     if(arg10.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg10.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg10.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg11.size, arg11.data()));
+                  cl::setKernelArg(data_, argPos++, arg11.size, arg11.data()));
     if(arg11.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg11.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg11.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg12.size, arg12.data()));
+                  cl::setKernelArg(data_, argPos++, arg12.size, arg12.data()));
     if(arg12.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg12.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg12.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg13.size, arg13.data()));
+                  cl::setKernelArg(data_, argPos++, arg13.size, arg13.data()));
     if(arg13.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg13.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg13.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg14.size, arg14.data()));
+                  cl::setKernelArg(data_, argPos++, arg14.size, arg14.data()));
     if(arg14.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg14.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg14.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg15.size, arg15.data()));
+                  cl::setKernelArg(data_, argPos++, arg15.size, arg15.data()));
     if(arg15.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg15.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg15.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg16.size, arg16.data()));
+                  cl::setKernelArg(data_, argPos++, arg16.size, arg16.data()));
     if(arg16.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg16.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg16.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg17.size, arg17.data()));
+                  cl::setKernelArg(data_, argPos++, arg17.size, arg17.data()));
     if(arg17.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg17.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg17.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg18.size, arg18.data()));
+                  cl::setKernelArg(data_, argPos++, arg18.size, arg18.data()));
     if(arg18.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg18.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg18.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg19.size, arg19.data()));
+                  cl::setKernelArg(data_, argPos++, arg19.size, arg19.data()));
     if(arg19.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg19.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg19.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg20.size, arg20.data()));
+                  cl::setKernelArg(data_, argPos++, arg20.size, arg20.data()));
     if(arg20.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg20.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg20.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg21.size, arg21.data()));
+                  cl::setKernelArg(data_, argPos++, arg21.size, arg21.data()));
     if(arg21.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg21.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg21.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg22.size, arg22.data()));
+                  cl::setKernelArg(data_, argPos++, arg22.size, arg22.data()));
     if(arg22.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg22.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg22.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg23.size, arg23.data()));
+                  cl::setKernelArg(data_, argPos++, arg23.size, arg23.data()));
     if(arg23.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg23.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg23.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg24.size, arg24.data()));
+                  cl::setKernelArg(data_, argPos++, arg24.size, arg24.data()));
     if(arg24.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg24.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg24.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg25.size, arg25.data()));
+                  cl::setKernelArg(data_, argPos++, arg25.size, arg25.data()));
     if(arg25.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg25.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg25.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -2794,169 +2794,169 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg5.size, arg5.data()));
+                  cl::setKernelArg(data_, argPos++, arg5.size, arg5.data()));
     if(arg5.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg5.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg5.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg6.size, arg6.data()));
+                  cl::setKernelArg(data_, argPos++, arg6.size, arg6.data()));
     if(arg6.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg6.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg6.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg7.size, arg7.data()));
+                  cl::setKernelArg(data_, argPos++, arg7.size, arg7.data()));
     if(arg7.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg7.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg7.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg8.size, arg8.data()));
+                  cl::setKernelArg(data_, argPos++, arg8.size, arg8.data()));
     if(arg8.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg8.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg8.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg9.size, arg9.data()));
+                  cl::setKernelArg(data_, argPos++, arg9.size, arg9.data()));
     if(arg9.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg9.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg9.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg10.size, arg10.data()));
+                  cl::setKernelArg(data_, argPos++, arg10.size, arg10.data()));
     if(arg10.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg10.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg10.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg11.size, arg11.data()));
+                  cl::setKernelArg(data_, argPos++, arg11.size, arg11.data()));
     if(arg11.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg11.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg11.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg12.size, arg12.data()));
+                  cl::setKernelArg(data_, argPos++, arg12.size, arg12.data()));
     if(arg12.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg12.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg12.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg13.size, arg13.data()));
+                  cl::setKernelArg(data_, argPos++, arg13.size, arg13.data()));
     if(arg13.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg13.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg13.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg14.size, arg14.data()));
+                  cl::setKernelArg(data_, argPos++, arg14.size, arg14.data()));
     if(arg14.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg14.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg14.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg15.size, arg15.data()));
+                  cl::setKernelArg(data_, argPos++, arg15.size, arg15.data()));
     if(arg15.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg15.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg15.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg16.size, arg16.data()));
+                  cl::setKernelArg(data_, argPos++, arg16.size, arg16.data()));
     if(arg16.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg16.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg16.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg17.size, arg17.data()));
+                  cl::setKernelArg(data_, argPos++, arg17.size, arg17.data()));
     if(arg17.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg17.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg17.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg18.size, arg18.data()));
+                  cl::setKernelArg(data_, argPos++, arg18.size, arg18.data()));
     if(arg18.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg18.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg18.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg19.size, arg19.data()));
+                  cl::setKernelArg(data_, argPos++, arg19.size, arg19.data()));
     if(arg19.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg19.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg19.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg20.size, arg20.data()));
+                  cl::setKernelArg(data_, argPos++, arg20.size, arg20.data()));
     if(arg20.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg20.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg20.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg21.size, arg21.data()));
+                  cl::setKernelArg(data_, argPos++, arg21.size, arg21.data()));
     if(arg21.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg21.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg21.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg22.size, arg22.data()));
+                  cl::setKernelArg(data_, argPos++, arg22.size, arg22.data()));
     if(arg22.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg22.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg22.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg23.size, arg23.data()));
+                  cl::setKernelArg(data_, argPos++, arg23.size, arg23.data()));
     if(arg23.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg23.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg23.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg24.size, arg24.data()));
+                  cl::setKernelArg(data_, argPos++, arg24.size, arg24.data()));
     if(arg24.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg24.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg24.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg25.size, arg25.data()));
+                  cl::setKernelArg(data_, argPos++, arg25.size, arg25.data()));
     if(arg25.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg25.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg25.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg26.size, arg26.data()));
+                  cl::setKernelArg(data_, argPos++, arg26.size, arg26.data()));
     if(arg26.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg26.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg26.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -2987,175 +2987,175 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg5.size, arg5.data()));
+                  cl::setKernelArg(data_, argPos++, arg5.size, arg5.data()));
     if(arg5.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg5.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg5.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg6.size, arg6.data()));
+                  cl::setKernelArg(data_, argPos++, arg6.size, arg6.data()));
     if(arg6.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg6.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg6.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg7.size, arg7.data()));
+                  cl::setKernelArg(data_, argPos++, arg7.size, arg7.data()));
     if(arg7.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg7.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg7.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg8.size, arg8.data()));
+                  cl::setKernelArg(data_, argPos++, arg8.size, arg8.data()));
     if(arg8.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg8.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg8.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg9.size, arg9.data()));
+                  cl::setKernelArg(data_, argPos++, arg9.size, arg9.data()));
     if(arg9.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg9.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg9.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg10.size, arg10.data()));
+                  cl::setKernelArg(data_, argPos++, arg10.size, arg10.data()));
     if(arg10.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg10.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg10.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg11.size, arg11.data()));
+                  cl::setKernelArg(data_, argPos++, arg11.size, arg11.data()));
     if(arg11.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg11.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg11.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg12.size, arg12.data()));
+                  cl::setKernelArg(data_, argPos++, arg12.size, arg12.data()));
     if(arg12.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg12.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg12.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg13.size, arg13.data()));
+                  cl::setKernelArg(data_, argPos++, arg13.size, arg13.data()));
     if(arg13.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg13.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg13.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg14.size, arg14.data()));
+                  cl::setKernelArg(data_, argPos++, arg14.size, arg14.data()));
     if(arg14.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg14.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg14.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg15.size, arg15.data()));
+                  cl::setKernelArg(data_, argPos++, arg15.size, arg15.data()));
     if(arg15.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg15.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg15.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg16.size, arg16.data()));
+                  cl::setKernelArg(data_, argPos++, arg16.size, arg16.data()));
     if(arg16.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg16.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg16.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg17.size, arg17.data()));
+                  cl::setKernelArg(data_, argPos++, arg17.size, arg17.data()));
     if(arg17.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg17.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg17.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg18.size, arg18.data()));
+                  cl::setKernelArg(data_, argPos++, arg18.size, arg18.data()));
     if(arg18.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg18.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg18.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg19.size, arg19.data()));
+                  cl::setKernelArg(data_, argPos++, arg19.size, arg19.data()));
     if(arg19.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg19.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg19.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg20.size, arg20.data()));
+                  cl::setKernelArg(data_, argPos++, arg20.size, arg20.data()));
     if(arg20.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg20.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg20.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg21.size, arg21.data()));
+                  cl::setKernelArg(data_, argPos++, arg21.size, arg21.data()));
     if(arg21.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg21.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg21.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg22.size, arg22.data()));
+                  cl::setKernelArg(data_, argPos++, arg22.size, arg22.data()));
     if(arg22.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg22.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg22.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg23.size, arg23.data()));
+                  cl::setKernelArg(data_, argPos++, arg23.size, arg23.data()));
     if(arg23.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg23.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg23.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg24.size, arg24.data()));
+                  cl::setKernelArg(data_, argPos++, arg24.size, arg24.data()));
     if(arg24.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg24.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg24.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg25.size, arg25.data()));
+                  cl::setKernelArg(data_, argPos++, arg25.size, arg25.data()));
     if(arg25.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg25.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg25.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg26.size, arg26.data()));
+                  cl::setKernelArg(data_, argPos++, arg26.size, arg26.data()));
     if(arg26.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg26.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg26.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg27.size, arg27.data()));
+                  cl::setKernelArg(data_, argPos++, arg27.size, arg27.data()));
     if(arg27.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg27.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg27.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -3186,181 +3186,181 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg5.size, arg5.data()));
+                  cl::setKernelArg(data_, argPos++, arg5.size, arg5.data()));
     if(arg5.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg5.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg5.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg6.size, arg6.data()));
+                  cl::setKernelArg(data_, argPos++, arg6.size, arg6.data()));
     if(arg6.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg6.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg6.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg7.size, arg7.data()));
+                  cl::setKernelArg(data_, argPos++, arg7.size, arg7.data()));
     if(arg7.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg7.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg7.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg8.size, arg8.data()));
+                  cl::setKernelArg(data_, argPos++, arg8.size, arg8.data()));
     if(arg8.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg8.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg8.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg9.size, arg9.data()));
+                  cl::setKernelArg(data_, argPos++, arg9.size, arg9.data()));
     if(arg9.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg9.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg9.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg10.size, arg10.data()));
+                  cl::setKernelArg(data_, argPos++, arg10.size, arg10.data()));
     if(arg10.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg10.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg10.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg11.size, arg11.data()));
+                  cl::setKernelArg(data_, argPos++, arg11.size, arg11.data()));
     if(arg11.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg11.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg11.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg12.size, arg12.data()));
+                  cl::setKernelArg(data_, argPos++, arg12.size, arg12.data()));
     if(arg12.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg12.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg12.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg13.size, arg13.data()));
+                  cl::setKernelArg(data_, argPos++, arg13.size, arg13.data()));
     if(arg13.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg13.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg13.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg14.size, arg14.data()));
+                  cl::setKernelArg(data_, argPos++, arg14.size, arg14.data()));
     if(arg14.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg14.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg14.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg15.size, arg15.data()));
+                  cl::setKernelArg(data_, argPos++, arg15.size, arg15.data()));
     if(arg15.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg15.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg15.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg16.size, arg16.data()));
+                  cl::setKernelArg(data_, argPos++, arg16.size, arg16.data()));
     if(arg16.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg16.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg16.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg17.size, arg17.data()));
+                  cl::setKernelArg(data_, argPos++, arg17.size, arg17.data()));
     if(arg17.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg17.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg17.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg18.size, arg18.data()));
+                  cl::setKernelArg(data_, argPos++, arg18.size, arg18.data()));
     if(arg18.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg18.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg18.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg19.size, arg19.data()));
+                  cl::setKernelArg(data_, argPos++, arg19.size, arg19.data()));
     if(arg19.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg19.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg19.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg20.size, arg20.data()));
+                  cl::setKernelArg(data_, argPos++, arg20.size, arg20.data()));
     if(arg20.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg20.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg20.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg21.size, arg21.data()));
+                  cl::setKernelArg(data_, argPos++, arg21.size, arg21.data()));
     if(arg21.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg21.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg21.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg22.size, arg22.data()));
+                  cl::setKernelArg(data_, argPos++, arg22.size, arg22.data()));
     if(arg22.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg22.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg22.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg23.size, arg23.data()));
+                  cl::setKernelArg(data_, argPos++, arg23.size, arg23.data()));
     if(arg23.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg23.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg23.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg24.size, arg24.data()));
+                  cl::setKernelArg(data_, argPos++, arg24.size, arg24.data()));
     if(arg24.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg24.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg24.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg25.size, arg25.data()));
+                  cl::setKernelArg(data_, argPos++, arg25.size, arg25.data()));
     if(arg25.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg25.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg25.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg26.size, arg26.data()));
+                  cl::setKernelArg(data_, argPos++, arg26.size, arg26.data()));
     if(arg26.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg26.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg26.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg27.size, arg27.data()));
+                  cl::setKernelArg(data_, argPos++, arg27.size, arg27.data()));
     if(arg27.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg27.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg27.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg28.size, arg28.data()));
+                  cl::setKernelArg(data_, argPos++, arg28.size, arg28.data()));
     if(arg28.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg28.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg28.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -3391,187 +3391,187 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg5.size, arg5.data()));
+                  cl::setKernelArg(data_, argPos++, arg5.size, arg5.data()));
     if(arg5.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg5.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg5.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg6.size, arg6.data()));
+                  cl::setKernelArg(data_, argPos++, arg6.size, arg6.data()));
     if(arg6.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg6.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg6.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg7.size, arg7.data()));
+                  cl::setKernelArg(data_, argPos++, arg7.size, arg7.data()));
     if(arg7.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg7.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg7.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg8.size, arg8.data()));
+                  cl::setKernelArg(data_, argPos++, arg8.size, arg8.data()));
     if(arg8.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg8.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg8.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg9.size, arg9.data()));
+                  cl::setKernelArg(data_, argPos++, arg9.size, arg9.data()));
     if(arg9.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg9.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg9.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg10.size, arg10.data()));
+                  cl::setKernelArg(data_, argPos++, arg10.size, arg10.data()));
     if(arg10.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg10.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg10.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg11.size, arg11.data()));
+                  cl::setKernelArg(data_, argPos++, arg11.size, arg11.data()));
     if(arg11.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg11.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg11.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg12.size, arg12.data()));
+                  cl::setKernelArg(data_, argPos++, arg12.size, arg12.data()));
     if(arg12.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg12.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg12.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg13.size, arg13.data()));
+                  cl::setKernelArg(data_, argPos++, arg13.size, arg13.data()));
     if(arg13.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg13.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg13.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg14.size, arg14.data()));
+                  cl::setKernelArg(data_, argPos++, arg14.size, arg14.data()));
     if(arg14.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg14.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg14.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg15.size, arg15.data()));
+                  cl::setKernelArg(data_, argPos++, arg15.size, arg15.data()));
     if(arg15.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg15.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg15.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg16.size, arg16.data()));
+                  cl::setKernelArg(data_, argPos++, arg16.size, arg16.data()));
     if(arg16.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg16.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg16.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg17.size, arg17.data()));
+                  cl::setKernelArg(data_, argPos++, arg17.size, arg17.data()));
     if(arg17.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg17.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg17.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg18.size, arg18.data()));
+                  cl::setKernelArg(data_, argPos++, arg18.size, arg18.data()));
     if(arg18.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg18.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg18.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg19.size, arg19.data()));
+                  cl::setKernelArg(data_, argPos++, arg19.size, arg19.data()));
     if(arg19.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg19.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg19.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg20.size, arg20.data()));
+                  cl::setKernelArg(data_, argPos++, arg20.size, arg20.data()));
     if(arg20.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg20.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg20.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg21.size, arg21.data()));
+                  cl::setKernelArg(data_, argPos++, arg21.size, arg21.data()));
     if(arg21.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg21.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg21.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg22.size, arg22.data()));
+                  cl::setKernelArg(data_, argPos++, arg22.size, arg22.data()));
     if(arg22.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg22.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg22.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg23.size, arg23.data()));
+                  cl::setKernelArg(data_, argPos++, arg23.size, arg23.data()));
     if(arg23.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg23.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg23.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg24.size, arg24.data()));
+                  cl::setKernelArg(data_, argPos++, arg24.size, arg24.data()));
     if(arg24.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg24.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg24.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg25.size, arg25.data()));
+                  cl::setKernelArg(data_, argPos++, arg25.size, arg25.data()));
     if(arg25.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg25.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg25.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg26.size, arg26.data()));
+                  cl::setKernelArg(data_, argPos++, arg26.size, arg26.data()));
     if(arg26.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg26.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg26.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg27.size, arg27.data()));
+                  cl::setKernelArg(data_, argPos++, arg27.size, arg27.data()));
     if(arg27.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg27.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg27.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg28.size, arg28.data()));
+                  cl::setKernelArg(data_, argPos++, arg28.size, arg28.data()));
     if(arg28.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg28.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg28.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg29.size, arg29.data()));
+                  cl::setKernelArg(data_, argPos++, arg29.size, arg29.data()));
     if(arg29.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg29.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg29.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -3603,193 +3603,193 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg5.size, arg5.data()));
+                  cl::setKernelArg(data_, argPos++, arg5.size, arg5.data()));
     if(arg5.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg5.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg5.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg6.size, arg6.data()));
+                  cl::setKernelArg(data_, argPos++, arg6.size, arg6.data()));
     if(arg6.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg6.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg6.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg7.size, arg7.data()));
+                  cl::setKernelArg(data_, argPos++, arg7.size, arg7.data()));
     if(arg7.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg7.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg7.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg8.size, arg8.data()));
+                  cl::setKernelArg(data_, argPos++, arg8.size, arg8.data()));
     if(arg8.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg8.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg8.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg9.size, arg9.data()));
+                  cl::setKernelArg(data_, argPos++, arg9.size, arg9.data()));
     if(arg9.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg9.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg9.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg10.size, arg10.data()));
+                  cl::setKernelArg(data_, argPos++, arg10.size, arg10.data()));
     if(arg10.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg10.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg10.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg11.size, arg11.data()));
+                  cl::setKernelArg(data_, argPos++, arg11.size, arg11.data()));
     if(arg11.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg11.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg11.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg12.size, arg12.data()));
+                  cl::setKernelArg(data_, argPos++, arg12.size, arg12.data()));
     if(arg12.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg12.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg12.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg13.size, arg13.data()));
+                  cl::setKernelArg(data_, argPos++, arg13.size, arg13.data()));
     if(arg13.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg13.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg13.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg14.size, arg14.data()));
+                  cl::setKernelArg(data_, argPos++, arg14.size, arg14.data()));
     if(arg14.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg14.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg14.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg15.size, arg15.data()));
+                  cl::setKernelArg(data_, argPos++, arg15.size, arg15.data()));
     if(arg15.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg15.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg15.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg16.size, arg16.data()));
+                  cl::setKernelArg(data_, argPos++, arg16.size, arg16.data()));
     if(arg16.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg16.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg16.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg17.size, arg17.data()));
+                  cl::setKernelArg(data_, argPos++, arg17.size, arg17.data()));
     if(arg17.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg17.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg17.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg18.size, arg18.data()));
+                  cl::setKernelArg(data_, argPos++, arg18.size, arg18.data()));
     if(arg18.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg18.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg18.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg19.size, arg19.data()));
+                  cl::setKernelArg(data_, argPos++, arg19.size, arg19.data()));
     if(arg19.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg19.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg19.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg20.size, arg20.data()));
+                  cl::setKernelArg(data_, argPos++, arg20.size, arg20.data()));
     if(arg20.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg20.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg20.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg21.size, arg21.data()));
+                  cl::setKernelArg(data_, argPos++, arg21.size, arg21.data()));
     if(arg21.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg21.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg21.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg22.size, arg22.data()));
+                  cl::setKernelArg(data_, argPos++, arg22.size, arg22.data()));
     if(arg22.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg22.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg22.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg23.size, arg23.data()));
+                  cl::setKernelArg(data_, argPos++, arg23.size, arg23.data()));
     if(arg23.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg23.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg23.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg24.size, arg24.data()));
+                  cl::setKernelArg(data_, argPos++, arg24.size, arg24.data()));
     if(arg24.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg24.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg24.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg25.size, arg25.data()));
+                  cl::setKernelArg(data_, argPos++, arg25.size, arg25.data()));
     if(arg25.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg25.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg25.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg26.size, arg26.data()));
+                  cl::setKernelArg(data_, argPos++, arg26.size, arg26.data()));
     if(arg26.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg26.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg26.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg27.size, arg27.data()));
+                  cl::setKernelArg(data_, argPos++, arg27.size, arg27.data()));
     if(arg27.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg27.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg27.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg28.size, arg28.data()));
+                  cl::setKernelArg(data_, argPos++, arg28.size, arg28.data()));
     if(arg28.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg28.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg28.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg29.size, arg29.data()));
+                  cl::setKernelArg(data_, argPos++, arg29.size, arg29.data()));
     if(arg29.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg29.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg29.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg30.size, arg30.data()));
+                  cl::setKernelArg(data_, argPos++, arg30.size, arg30.data()));
     if(arg30.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg30.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg30.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -3821,199 +3821,199 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg5.size, arg5.data()));
+                  cl::setKernelArg(data_, argPos++, arg5.size, arg5.data()));
     if(arg5.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg5.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg5.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg6.size, arg6.data()));
+                  cl::setKernelArg(data_, argPos++, arg6.size, arg6.data()));
     if(arg6.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg6.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg6.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg7.size, arg7.data()));
+                  cl::setKernelArg(data_, argPos++, arg7.size, arg7.data()));
     if(arg7.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg7.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg7.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg8.size, arg8.data()));
+                  cl::setKernelArg(data_, argPos++, arg8.size, arg8.data()));
     if(arg8.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg8.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg8.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg9.size, arg9.data()));
+                  cl::setKernelArg(data_, argPos++, arg9.size, arg9.data()));
     if(arg9.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg9.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg9.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg10.size, arg10.data()));
+                  cl::setKernelArg(data_, argPos++, arg10.size, arg10.data()));
     if(arg10.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg10.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg10.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg11.size, arg11.data()));
+                  cl::setKernelArg(data_, argPos++, arg11.size, arg11.data()));
     if(arg11.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg11.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg11.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg12.size, arg12.data()));
+                  cl::setKernelArg(data_, argPos++, arg12.size, arg12.data()));
     if(arg12.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg12.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg12.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg13.size, arg13.data()));
+                  cl::setKernelArg(data_, argPos++, arg13.size, arg13.data()));
     if(arg13.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg13.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg13.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg14.size, arg14.data()));
+                  cl::setKernelArg(data_, argPos++, arg14.size, arg14.data()));
     if(arg14.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg14.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg14.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg15.size, arg15.data()));
+                  cl::setKernelArg(data_, argPos++, arg15.size, arg15.data()));
     if(arg15.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg15.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg15.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg16.size, arg16.data()));
+                  cl::setKernelArg(data_, argPos++, arg16.size, arg16.data()));
     if(arg16.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg16.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg16.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg17.size, arg17.data()));
+                  cl::setKernelArg(data_, argPos++, arg17.size, arg17.data()));
     if(arg17.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg17.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg17.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg18.size, arg18.data()));
+                  cl::setKernelArg(data_, argPos++, arg18.size, arg18.data()));
     if(arg18.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg18.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg18.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg19.size, arg19.data()));
+                  cl::setKernelArg(data_, argPos++, arg19.size, arg19.data()));
     if(arg19.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg19.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg19.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg20.size, arg20.data()));
+                  cl::setKernelArg(data_, argPos++, arg20.size, arg20.data()));
     if(arg20.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg20.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg20.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg21.size, arg21.data()));
+                  cl::setKernelArg(data_, argPos++, arg21.size, arg21.data()));
     if(arg21.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg21.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg21.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg22.size, arg22.data()));
+                  cl::setKernelArg(data_, argPos++, arg22.size, arg22.data()));
     if(arg22.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg22.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg22.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg23.size, arg23.data()));
+                  cl::setKernelArg(data_, argPos++, arg23.size, arg23.data()));
     if(arg23.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg23.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg23.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg24.size, arg24.data()));
+                  cl::setKernelArg(data_, argPos++, arg24.size, arg24.data()));
     if(arg24.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg24.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg24.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg25.size, arg25.data()));
+                  cl::setKernelArg(data_, argPos++, arg25.size, arg25.data()));
     if(arg25.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg25.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg25.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg26.size, arg26.data()));
+                  cl::setKernelArg(data_, argPos++, arg26.size, arg26.data()));
     if(arg26.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg26.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg26.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg27.size, arg27.data()));
+                  cl::setKernelArg(data_, argPos++, arg27.size, arg27.data()));
     if(arg27.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg27.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg27.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg28.size, arg28.data()));
+                  cl::setKernelArg(data_, argPos++, arg28.size, arg28.data()));
     if(arg28.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg28.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg28.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg29.size, arg29.data()));
+                  cl::setKernelArg(data_, argPos++, arg29.size, arg29.data()));
     if(arg29.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg29.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg29.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg30.size, arg30.data()));
+                  cl::setKernelArg(data_, argPos++, arg30.size, arg30.data()));
     if(arg30.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg30.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg30.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg31.size, arg31.data()));
+                  cl::setKernelArg(data_, argPos++, arg31.size, arg31.data()));
     if(arg31.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg31.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg31.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -4045,205 +4045,205 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg5.size, arg5.data()));
+                  cl::setKernelArg(data_, argPos++, arg5.size, arg5.data()));
     if(arg5.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg5.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg5.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg6.size, arg6.data()));
+                  cl::setKernelArg(data_, argPos++, arg6.size, arg6.data()));
     if(arg6.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg6.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg6.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg7.size, arg7.data()));
+                  cl::setKernelArg(data_, argPos++, arg7.size, arg7.data()));
     if(arg7.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg7.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg7.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg8.size, arg8.data()));
+                  cl::setKernelArg(data_, argPos++, arg8.size, arg8.data()));
     if(arg8.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg8.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg8.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg9.size, arg9.data()));
+                  cl::setKernelArg(data_, argPos++, arg9.size, arg9.data()));
     if(arg9.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg9.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg9.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg10.size, arg10.data()));
+                  cl::setKernelArg(data_, argPos++, arg10.size, arg10.data()));
     if(arg10.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg10.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg10.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg11.size, arg11.data()));
+                  cl::setKernelArg(data_, argPos++, arg11.size, arg11.data()));
     if(arg11.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg11.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg11.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg12.size, arg12.data()));
+                  cl::setKernelArg(data_, argPos++, arg12.size, arg12.data()));
     if(arg12.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg12.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg12.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg13.size, arg13.data()));
+                  cl::setKernelArg(data_, argPos++, arg13.size, arg13.data()));
     if(arg13.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg13.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg13.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg14.size, arg14.data()));
+                  cl::setKernelArg(data_, argPos++, arg14.size, arg14.data()));
     if(arg14.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg14.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg14.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg15.size, arg15.data()));
+                  cl::setKernelArg(data_, argPos++, arg15.size, arg15.data()));
     if(arg15.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg15.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg15.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg16.size, arg16.data()));
+                  cl::setKernelArg(data_, argPos++, arg16.size, arg16.data()));
     if(arg16.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg16.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg16.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg17.size, arg17.data()));
+                  cl::setKernelArg(data_, argPos++, arg17.size, arg17.data()));
     if(arg17.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg17.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg17.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg18.size, arg18.data()));
+                  cl::setKernelArg(data_, argPos++, arg18.size, arg18.data()));
     if(arg18.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg18.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg18.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg19.size, arg19.data()));
+                  cl::setKernelArg(data_, argPos++, arg19.size, arg19.data()));
     if(arg19.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg19.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg19.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg20.size, arg20.data()));
+                  cl::setKernelArg(data_, argPos++, arg20.size, arg20.data()));
     if(arg20.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg20.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg20.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg21.size, arg21.data()));
+                  cl::setKernelArg(data_, argPos++, arg21.size, arg21.data()));
     if(arg21.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg21.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg21.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg22.size, arg22.data()));
+                  cl::setKernelArg(data_, argPos++, arg22.size, arg22.data()));
     if(arg22.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg22.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg22.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg23.size, arg23.data()));
+                  cl::setKernelArg(data_, argPos++, arg23.size, arg23.data()));
     if(arg23.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg23.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg23.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg24.size, arg24.data()));
+                  cl::setKernelArg(data_, argPos++, arg24.size, arg24.data()));
     if(arg24.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg24.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg24.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg25.size, arg25.data()));
+                  cl::setKernelArg(data_, argPos++, arg25.size, arg25.data()));
     if(arg25.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg25.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg25.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg26.size, arg26.data()));
+                  cl::setKernelArg(data_, argPos++, arg26.size, arg26.data()));
     if(arg26.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg26.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg26.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg27.size, arg27.data()));
+                  cl::setKernelArg(data_, argPos++, arg27.size, arg27.data()));
     if(arg27.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg27.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg27.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg28.size, arg28.data()));
+                  cl::setKernelArg(data_, argPos++, arg28.size, arg28.data()));
     if(arg28.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg28.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg28.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg29.size, arg29.data()));
+                  cl::setKernelArg(data_, argPos++, arg29.size, arg29.data()));
     if(arg29.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg29.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg29.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg30.size, arg30.data()));
+                  cl::setKernelArg(data_, argPos++, arg30.size, arg30.data()));
     if(arg30.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg30.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg30.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg31.size, arg31.data()));
+                  cl::setKernelArg(data_, argPos++, arg31.size, arg31.data()));
     if(arg31.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg31.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg31.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg32.size, arg32.data()));
+                  cl::setKernelArg(data_, argPos++, arg32.size, arg32.data()));
     if(arg32.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg32.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg32.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -4276,211 +4276,211 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg5.size, arg5.data()));
+                  cl::setKernelArg(data_, argPos++, arg5.size, arg5.data()));
     if(arg5.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg5.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg5.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg6.size, arg6.data()));
+                  cl::setKernelArg(data_, argPos++, arg6.size, arg6.data()));
     if(arg6.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg6.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg6.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg7.size, arg7.data()));
+                  cl::setKernelArg(data_, argPos++, arg7.size, arg7.data()));
     if(arg7.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg7.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg7.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg8.size, arg8.data()));
+                  cl::setKernelArg(data_, argPos++, arg8.size, arg8.data()));
     if(arg8.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg8.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg8.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg9.size, arg9.data()));
+                  cl::setKernelArg(data_, argPos++, arg9.size, arg9.data()));
     if(arg9.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg9.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg9.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg10.size, arg10.data()));
+                  cl::setKernelArg(data_, argPos++, arg10.size, arg10.data()));
     if(arg10.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg10.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg10.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg11.size, arg11.data()));
+                  cl::setKernelArg(data_, argPos++, arg11.size, arg11.data()));
     if(arg11.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg11.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg11.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg12.size, arg12.data()));
+                  cl::setKernelArg(data_, argPos++, arg12.size, arg12.data()));
     if(arg12.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg12.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg12.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg13.size, arg13.data()));
+                  cl::setKernelArg(data_, argPos++, arg13.size, arg13.data()));
     if(arg13.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg13.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg13.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg14.size, arg14.data()));
+                  cl::setKernelArg(data_, argPos++, arg14.size, arg14.data()));
     if(arg14.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg14.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg14.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg15.size, arg15.data()));
+                  cl::setKernelArg(data_, argPos++, arg15.size, arg15.data()));
     if(arg15.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg15.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg15.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg16.size, arg16.data()));
+                  cl::setKernelArg(data_, argPos++, arg16.size, arg16.data()));
     if(arg16.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg16.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg16.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg17.size, arg17.data()));
+                  cl::setKernelArg(data_, argPos++, arg17.size, arg17.data()));
     if(arg17.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg17.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg17.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg18.size, arg18.data()));
+                  cl::setKernelArg(data_, argPos++, arg18.size, arg18.data()));
     if(arg18.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg18.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg18.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg19.size, arg19.data()));
+                  cl::setKernelArg(data_, argPos++, arg19.size, arg19.data()));
     if(arg19.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg19.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg19.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg20.size, arg20.data()));
+                  cl::setKernelArg(data_, argPos++, arg20.size, arg20.data()));
     if(arg20.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg20.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg20.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg21.size, arg21.data()));
+                  cl::setKernelArg(data_, argPos++, arg21.size, arg21.data()));
     if(arg21.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg21.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg21.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg22.size, arg22.data()));
+                  cl::setKernelArg(data_, argPos++, arg22.size, arg22.data()));
     if(arg22.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg22.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg22.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg23.size, arg23.data()));
+                  cl::setKernelArg(data_, argPos++, arg23.size, arg23.data()));
     if(arg23.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg23.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg23.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg24.size, arg24.data()));
+                  cl::setKernelArg(data_, argPos++, arg24.size, arg24.data()));
     if(arg24.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg24.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg24.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg25.size, arg25.data()));
+                  cl::setKernelArg(data_, argPos++, arg25.size, arg25.data()));
     if(arg25.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg25.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg25.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg26.size, arg26.data()));
+                  cl::setKernelArg(data_, argPos++, arg26.size, arg26.data()));
     if(arg26.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg26.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg26.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg27.size, arg27.data()));
+                  cl::setKernelArg(data_, argPos++, arg27.size, arg27.data()));
     if(arg27.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg27.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg27.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg28.size, arg28.data()));
+                  cl::setKernelArg(data_, argPos++, arg28.size, arg28.data()));
     if(arg28.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg28.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg28.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg29.size, arg29.data()));
+                  cl::setKernelArg(data_, argPos++, arg29.size, arg29.data()));
     if(arg29.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg29.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg29.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg30.size, arg30.data()));
+                  cl::setKernelArg(data_, argPos++, arg30.size, arg30.data()));
     if(arg30.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg30.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg30.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg31.size, arg31.data()));
+                  cl::setKernelArg(data_, argPos++, arg31.size, arg31.data()));
     if(arg31.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg31.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg31.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg32.size, arg32.data()));
+                  cl::setKernelArg(data_, argPos++, arg32.size, arg32.data()));
     if(arg32.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg32.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg32.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg33.size, arg33.data()));
+                  cl::setKernelArg(data_, argPos++, arg33.size, arg33.data()));
     if(arg33.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg33.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg33.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -4513,217 +4513,217 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg5.size, arg5.data()));
+                  cl::setKernelArg(data_, argPos++, arg5.size, arg5.data()));
     if(arg5.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg5.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg5.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg6.size, arg6.data()));
+                  cl::setKernelArg(data_, argPos++, arg6.size, arg6.data()));
     if(arg6.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg6.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg6.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg7.size, arg7.data()));
+                  cl::setKernelArg(data_, argPos++, arg7.size, arg7.data()));
     if(arg7.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg7.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg7.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg8.size, arg8.data()));
+                  cl::setKernelArg(data_, argPos++, arg8.size, arg8.data()));
     if(arg8.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg8.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg8.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg9.size, arg9.data()));
+                  cl::setKernelArg(data_, argPos++, arg9.size, arg9.data()));
     if(arg9.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg9.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg9.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg10.size, arg10.data()));
+                  cl::setKernelArg(data_, argPos++, arg10.size, arg10.data()));
     if(arg10.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg10.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg10.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg11.size, arg11.data()));
+                  cl::setKernelArg(data_, argPos++, arg11.size, arg11.data()));
     if(arg11.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg11.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg11.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg12.size, arg12.data()));
+                  cl::setKernelArg(data_, argPos++, arg12.size, arg12.data()));
     if(arg12.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg12.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg12.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg13.size, arg13.data()));
+                  cl::setKernelArg(data_, argPos++, arg13.size, arg13.data()));
     if(arg13.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg13.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg13.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg14.size, arg14.data()));
+                  cl::setKernelArg(data_, argPos++, arg14.size, arg14.data()));
     if(arg14.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg14.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg14.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg15.size, arg15.data()));
+                  cl::setKernelArg(data_, argPos++, arg15.size, arg15.data()));
     if(arg15.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg15.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg15.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg16.size, arg16.data()));
+                  cl::setKernelArg(data_, argPos++, arg16.size, arg16.data()));
     if(arg16.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg16.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg16.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg17.size, arg17.data()));
+                  cl::setKernelArg(data_, argPos++, arg17.size, arg17.data()));
     if(arg17.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg17.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg17.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg18.size, arg18.data()));
+                  cl::setKernelArg(data_, argPos++, arg18.size, arg18.data()));
     if(arg18.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg18.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg18.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg19.size, arg19.data()));
+                  cl::setKernelArg(data_, argPos++, arg19.size, arg19.data()));
     if(arg19.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg19.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg19.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg20.size, arg20.data()));
+                  cl::setKernelArg(data_, argPos++, arg20.size, arg20.data()));
     if(arg20.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg20.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg20.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg21.size, arg21.data()));
+                  cl::setKernelArg(data_, argPos++, arg21.size, arg21.data()));
     if(arg21.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg21.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg21.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg22.size, arg22.data()));
+                  cl::setKernelArg(data_, argPos++, arg22.size, arg22.data()));
     if(arg22.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg22.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg22.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg23.size, arg23.data()));
+                  cl::setKernelArg(data_, argPos++, arg23.size, arg23.data()));
     if(arg23.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg23.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg23.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg24.size, arg24.data()));
+                  cl::setKernelArg(data_, argPos++, arg24.size, arg24.data()));
     if(arg24.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg24.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg24.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg25.size, arg25.data()));
+                  cl::setKernelArg(data_, argPos++, arg25.size, arg25.data()));
     if(arg25.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg25.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg25.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg26.size, arg26.data()));
+                  cl::setKernelArg(data_, argPos++, arg26.size, arg26.data()));
     if(arg26.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg26.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg26.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg27.size, arg27.data()));
+                  cl::setKernelArg(data_, argPos++, arg27.size, arg27.data()));
     if(arg27.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg27.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg27.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg28.size, arg28.data()));
+                  cl::setKernelArg(data_, argPos++, arg28.size, arg28.data()));
     if(arg28.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg28.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg28.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg29.size, arg29.data()));
+                  cl::setKernelArg(data_, argPos++, arg29.size, arg29.data()));
     if(arg29.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg29.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg29.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg30.size, arg30.data()));
+                  cl::setKernelArg(data_, argPos++, arg30.size, arg30.data()));
     if(arg30.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg30.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg30.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg31.size, arg31.data()));
+                  cl::setKernelArg(data_, argPos++, arg31.size, arg31.data()));
     if(arg31.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg31.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg31.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg32.size, arg32.data()));
+                  cl::setKernelArg(data_, argPos++, arg32.size, arg32.data()));
     if(arg32.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg32.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg32.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg33.size, arg33.data()));
+                  cl::setKernelArg(data_, argPos++, arg33.size, arg33.data()));
     if(arg33.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg33.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg33.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg34.size, arg34.data()));
+                  cl::setKernelArg(data_, argPos++, arg34.size, arg34.data()));
     if(arg34.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg34.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg34.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -4756,223 +4756,223 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg5.size, arg5.data()));
+                  cl::setKernelArg(data_, argPos++, arg5.size, arg5.data()));
     if(arg5.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg5.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg5.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg6.size, arg6.data()));
+                  cl::setKernelArg(data_, argPos++, arg6.size, arg6.data()));
     if(arg6.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg6.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg6.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg7.size, arg7.data()));
+                  cl::setKernelArg(data_, argPos++, arg7.size, arg7.data()));
     if(arg7.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg7.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg7.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg8.size, arg8.data()));
+                  cl::setKernelArg(data_, argPos++, arg8.size, arg8.data()));
     if(arg8.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg8.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg8.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg9.size, arg9.data()));
+                  cl::setKernelArg(data_, argPos++, arg9.size, arg9.data()));
     if(arg9.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg9.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg9.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg10.size, arg10.data()));
+                  cl::setKernelArg(data_, argPos++, arg10.size, arg10.data()));
     if(arg10.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg10.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg10.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg11.size, arg11.data()));
+                  cl::setKernelArg(data_, argPos++, arg11.size, arg11.data()));
     if(arg11.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg11.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg11.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg12.size, arg12.data()));
+                  cl::setKernelArg(data_, argPos++, arg12.size, arg12.data()));
     if(arg12.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg12.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg12.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg13.size, arg13.data()));
+                  cl::setKernelArg(data_, argPos++, arg13.size, arg13.data()));
     if(arg13.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg13.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg13.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg14.size, arg14.data()));
+                  cl::setKernelArg(data_, argPos++, arg14.size, arg14.data()));
     if(arg14.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg14.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg14.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg15.size, arg15.data()));
+                  cl::setKernelArg(data_, argPos++, arg15.size, arg15.data()));
     if(arg15.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg15.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg15.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg16.size, arg16.data()));
+                  cl::setKernelArg(data_, argPos++, arg16.size, arg16.data()));
     if(arg16.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg16.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg16.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg17.size, arg17.data()));
+                  cl::setKernelArg(data_, argPos++, arg17.size, arg17.data()));
     if(arg17.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg17.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg17.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg18.size, arg18.data()));
+                  cl::setKernelArg(data_, argPos++, arg18.size, arg18.data()));
     if(arg18.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg18.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg18.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg19.size, arg19.data()));
+                  cl::setKernelArg(data_, argPos++, arg19.size, arg19.data()));
     if(arg19.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg19.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg19.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg20.size, arg20.data()));
+                  cl::setKernelArg(data_, argPos++, arg20.size, arg20.data()));
     if(arg20.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg20.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg20.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg21.size, arg21.data()));
+                  cl::setKernelArg(data_, argPos++, arg21.size, arg21.data()));
     if(arg21.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg21.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg21.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg22.size, arg22.data()));
+                  cl::setKernelArg(data_, argPos++, arg22.size, arg22.data()));
     if(arg22.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg22.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg22.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg23.size, arg23.data()));
+                  cl::setKernelArg(data_, argPos++, arg23.size, arg23.data()));
     if(arg23.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg23.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg23.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg24.size, arg24.data()));
+                  cl::setKernelArg(data_, argPos++, arg24.size, arg24.data()));
     if(arg24.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg24.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg24.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg25.size, arg25.data()));
+                  cl::setKernelArg(data_, argPos++, arg25.size, arg25.data()));
     if(arg25.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg25.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg25.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg26.size, arg26.data()));
+                  cl::setKernelArg(data_, argPos++, arg26.size, arg26.data()));
     if(arg26.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg26.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg26.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg27.size, arg27.data()));
+                  cl::setKernelArg(data_, argPos++, arg27.size, arg27.data()));
     if(arg27.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg27.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg27.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg28.size, arg28.data()));
+                  cl::setKernelArg(data_, argPos++, arg28.size, arg28.data()));
     if(arg28.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg28.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg28.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg29.size, arg29.data()));
+                  cl::setKernelArg(data_, argPos++, arg29.size, arg29.data()));
     if(arg29.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg29.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg29.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg30.size, arg30.data()));
+                  cl::setKernelArg(data_, argPos++, arg30.size, arg30.data()));
     if(arg30.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg30.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg30.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg31.size, arg31.data()));
+                  cl::setKernelArg(data_, argPos++, arg31.size, arg31.data()));
     if(arg31.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg31.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg31.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg32.size, arg32.data()));
+                  cl::setKernelArg(data_, argPos++, arg32.size, arg32.data()));
     if(arg32.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg32.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg32.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg33.size, arg33.data()));
+                  cl::setKernelArg(data_, argPos++, arg33.size, arg33.data()));
     if(arg33.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg33.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg33.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg34.size, arg34.data()));
+                  cl::setKernelArg(data_, argPos++, arg34.size, arg34.data()));
     if(arg34.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg34.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg34.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg35.size, arg35.data()));
+                  cl::setKernelArg(data_, argPos++, arg35.size, arg35.data()));
     if(arg35.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg35.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg35.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -5006,229 +5006,229 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg5.size, arg5.data()));
+                  cl::setKernelArg(data_, argPos++, arg5.size, arg5.data()));
     if(arg5.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg5.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg5.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg6.size, arg6.data()));
+                  cl::setKernelArg(data_, argPos++, arg6.size, arg6.data()));
     if(arg6.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg6.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg6.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg7.size, arg7.data()));
+                  cl::setKernelArg(data_, argPos++, arg7.size, arg7.data()));
     if(arg7.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg7.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg7.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg8.size, arg8.data()));
+                  cl::setKernelArg(data_, argPos++, arg8.size, arg8.data()));
     if(arg8.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg8.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg8.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg9.size, arg9.data()));
+                  cl::setKernelArg(data_, argPos++, arg9.size, arg9.data()));
     if(arg9.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg9.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg9.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg10.size, arg10.data()));
+                  cl::setKernelArg(data_, argPos++, arg10.size, arg10.data()));
     if(arg10.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg10.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg10.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg11.size, arg11.data()));
+                  cl::setKernelArg(data_, argPos++, arg11.size, arg11.data()));
     if(arg11.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg11.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg11.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg12.size, arg12.data()));
+                  cl::setKernelArg(data_, argPos++, arg12.size, arg12.data()));
     if(arg12.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg12.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg12.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg13.size, arg13.data()));
+                  cl::setKernelArg(data_, argPos++, arg13.size, arg13.data()));
     if(arg13.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg13.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg13.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg14.size, arg14.data()));
+                  cl::setKernelArg(data_, argPos++, arg14.size, arg14.data()));
     if(arg14.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg14.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg14.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg15.size, arg15.data()));
+                  cl::setKernelArg(data_, argPos++, arg15.size, arg15.data()));
     if(arg15.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg15.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg15.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg16.size, arg16.data()));
+                  cl::setKernelArg(data_, argPos++, arg16.size, arg16.data()));
     if(arg16.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg16.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg16.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg17.size, arg17.data()));
+                  cl::setKernelArg(data_, argPos++, arg17.size, arg17.data()));
     if(arg17.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg17.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg17.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg18.size, arg18.data()));
+                  cl::setKernelArg(data_, argPos++, arg18.size, arg18.data()));
     if(arg18.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg18.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg18.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg19.size, arg19.data()));
+                  cl::setKernelArg(data_, argPos++, arg19.size, arg19.data()));
     if(arg19.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg19.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg19.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg20.size, arg20.data()));
+                  cl::setKernelArg(data_, argPos++, arg20.size, arg20.data()));
     if(arg20.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg20.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg20.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg21.size, arg21.data()));
+                  cl::setKernelArg(data_, argPos++, arg21.size, arg21.data()));
     if(arg21.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg21.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg21.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg22.size, arg22.data()));
+                  cl::setKernelArg(data_, argPos++, arg22.size, arg22.data()));
     if(arg22.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg22.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg22.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg23.size, arg23.data()));
+                  cl::setKernelArg(data_, argPos++, arg23.size, arg23.data()));
     if(arg23.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg23.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg23.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg24.size, arg24.data()));
+                  cl::setKernelArg(data_, argPos++, arg24.size, arg24.data()));
     if(arg24.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg24.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg24.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg25.size, arg25.data()));
+                  cl::setKernelArg(data_, argPos++, arg25.size, arg25.data()));
     if(arg25.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg25.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg25.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg26.size, arg26.data()));
+                  cl::setKernelArg(data_, argPos++, arg26.size, arg26.data()));
     if(arg26.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg26.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg26.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg27.size, arg27.data()));
+                  cl::setKernelArg(data_, argPos++, arg27.size, arg27.data()));
     if(arg27.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg27.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg27.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg28.size, arg28.data()));
+                  cl::setKernelArg(data_, argPos++, arg28.size, arg28.data()));
     if(arg28.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg28.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg28.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg29.size, arg29.data()));
+                  cl::setKernelArg(data_, argPos++, arg29.size, arg29.data()));
     if(arg29.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg29.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg29.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg30.size, arg30.data()));
+                  cl::setKernelArg(data_, argPos++, arg30.size, arg30.data()));
     if(arg30.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg30.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg30.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg31.size, arg31.data()));
+                  cl::setKernelArg(data_, argPos++, arg31.size, arg31.data()));
     if(arg31.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg31.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg31.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg32.size, arg32.data()));
+                  cl::setKernelArg(data_, argPos++, arg32.size, arg32.data()));
     if(arg32.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg32.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg32.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg33.size, arg33.data()));
+                  cl::setKernelArg(data_, argPos++, arg33.size, arg33.data()));
     if(arg33.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg33.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg33.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg34.size, arg34.data()));
+                  cl::setKernelArg(data_, argPos++, arg34.size, arg34.data()));
     if(arg34.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg34.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg34.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg35.size, arg35.data()));
+                  cl::setKernelArg(data_, argPos++, arg35.size, arg35.data()));
     if(arg35.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg35.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg35.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg36.size, arg36.data()));
+                  cl::setKernelArg(data_, argPos++, arg36.size, arg36.data()));
     if(arg36.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg36.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg36.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -5262,235 +5262,235 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg5.size, arg5.data()));
+                  cl::setKernelArg(data_, argPos++, arg5.size, arg5.data()));
     if(arg5.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg5.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg5.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg6.size, arg6.data()));
+                  cl::setKernelArg(data_, argPos++, arg6.size, arg6.data()));
     if(arg6.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg6.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg6.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg7.size, arg7.data()));
+                  cl::setKernelArg(data_, argPos++, arg7.size, arg7.data()));
     if(arg7.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg7.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg7.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg8.size, arg8.data()));
+                  cl::setKernelArg(data_, argPos++, arg8.size, arg8.data()));
     if(arg8.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg8.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg8.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg9.size, arg9.data()));
+                  cl::setKernelArg(data_, argPos++, arg9.size, arg9.data()));
     if(arg9.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg9.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg9.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg10.size, arg10.data()));
+                  cl::setKernelArg(data_, argPos++, arg10.size, arg10.data()));
     if(arg10.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg10.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg10.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg11.size, arg11.data()));
+                  cl::setKernelArg(data_, argPos++, arg11.size, arg11.data()));
     if(arg11.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg11.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg11.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg12.size, arg12.data()));
+                  cl::setKernelArg(data_, argPos++, arg12.size, arg12.data()));
     if(arg12.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg12.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg12.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg13.size, arg13.data()));
+                  cl::setKernelArg(data_, argPos++, arg13.size, arg13.data()));
     if(arg13.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg13.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg13.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg14.size, arg14.data()));
+                  cl::setKernelArg(data_, argPos++, arg14.size, arg14.data()));
     if(arg14.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg14.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg14.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg15.size, arg15.data()));
+                  cl::setKernelArg(data_, argPos++, arg15.size, arg15.data()));
     if(arg15.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg15.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg15.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg16.size, arg16.data()));
+                  cl::setKernelArg(data_, argPos++, arg16.size, arg16.data()));
     if(arg16.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg16.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg16.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg17.size, arg17.data()));
+                  cl::setKernelArg(data_, argPos++, arg17.size, arg17.data()));
     if(arg17.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg17.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg17.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg18.size, arg18.data()));
+                  cl::setKernelArg(data_, argPos++, arg18.size, arg18.data()));
     if(arg18.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg18.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg18.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg19.size, arg19.data()));
+                  cl::setKernelArg(data_, argPos++, arg19.size, arg19.data()));
     if(arg19.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg19.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg19.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg20.size, arg20.data()));
+                  cl::setKernelArg(data_, argPos++, arg20.size, arg20.data()));
     if(arg20.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg20.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg20.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg21.size, arg21.data()));
+                  cl::setKernelArg(data_, argPos++, arg21.size, arg21.data()));
     if(arg21.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg21.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg21.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg22.size, arg22.data()));
+                  cl::setKernelArg(data_, argPos++, arg22.size, arg22.data()));
     if(arg22.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg22.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg22.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg23.size, arg23.data()));
+                  cl::setKernelArg(data_, argPos++, arg23.size, arg23.data()));
     if(arg23.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg23.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg23.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg24.size, arg24.data()));
+                  cl::setKernelArg(data_, argPos++, arg24.size, arg24.data()));
     if(arg24.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg24.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg24.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg25.size, arg25.data()));
+                  cl::setKernelArg(data_, argPos++, arg25.size, arg25.data()));
     if(arg25.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg25.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg25.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg26.size, arg26.data()));
+                  cl::setKernelArg(data_, argPos++, arg26.size, arg26.data()));
     if(arg26.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg26.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg26.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg27.size, arg27.data()));
+                  cl::setKernelArg(data_, argPos++, arg27.size, arg27.data()));
     if(arg27.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg27.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg27.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg28.size, arg28.data()));
+                  cl::setKernelArg(data_, argPos++, arg28.size, arg28.data()));
     if(arg28.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg28.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg28.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg29.size, arg29.data()));
+                  cl::setKernelArg(data_, argPos++, arg29.size, arg29.data()));
     if(arg29.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg29.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg29.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg30.size, arg30.data()));
+                  cl::setKernelArg(data_, argPos++, arg30.size, arg30.data()));
     if(arg30.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg30.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg30.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg31.size, arg31.data()));
+                  cl::setKernelArg(data_, argPos++, arg31.size, arg31.data()));
     if(arg31.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg31.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg31.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg32.size, arg32.data()));
+                  cl::setKernelArg(data_, argPos++, arg32.size, arg32.data()));
     if(arg32.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg32.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg32.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg33.size, arg33.data()));
+                  cl::setKernelArg(data_, argPos++, arg33.size, arg33.data()));
     if(arg33.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg33.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg33.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg34.size, arg34.data()));
+                  cl::setKernelArg(data_, argPos++, arg34.size, arg34.data()));
     if(arg34.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg34.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg34.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg35.size, arg35.data()));
+                  cl::setKernelArg(data_, argPos++, arg35.size, arg35.data()));
     if(arg35.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg35.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg35.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg36.size, arg36.data()));
+                  cl::setKernelArg(data_, argPos++, arg36.size, arg36.data()));
     if(arg36.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg36.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg36.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg37.size, arg37.data()));
+                  cl::setKernelArg(data_, argPos++, arg37.size, arg37.data()));
     if(arg37.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg37.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg37.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -5524,241 +5524,241 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg5.size, arg5.data()));
+                  cl::setKernelArg(data_, argPos++, arg5.size, arg5.data()));
     if(arg5.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg5.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg5.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg6.size, arg6.data()));
+                  cl::setKernelArg(data_, argPos++, arg6.size, arg6.data()));
     if(arg6.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg6.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg6.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg7.size, arg7.data()));
+                  cl::setKernelArg(data_, argPos++, arg7.size, arg7.data()));
     if(arg7.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg7.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg7.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg8.size, arg8.data()));
+                  cl::setKernelArg(data_, argPos++, arg8.size, arg8.data()));
     if(arg8.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg8.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg8.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg9.size, arg9.data()));
+                  cl::setKernelArg(data_, argPos++, arg9.size, arg9.data()));
     if(arg9.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg9.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg9.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg10.size, arg10.data()));
+                  cl::setKernelArg(data_, argPos++, arg10.size, arg10.data()));
     if(arg10.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg10.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg10.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg11.size, arg11.data()));
+                  cl::setKernelArg(data_, argPos++, arg11.size, arg11.data()));
     if(arg11.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg11.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg11.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg12.size, arg12.data()));
+                  cl::setKernelArg(data_, argPos++, arg12.size, arg12.data()));
     if(arg12.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg12.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg12.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg13.size, arg13.data()));
+                  cl::setKernelArg(data_, argPos++, arg13.size, arg13.data()));
     if(arg13.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg13.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg13.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg14.size, arg14.data()));
+                  cl::setKernelArg(data_, argPos++, arg14.size, arg14.data()));
     if(arg14.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg14.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg14.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg15.size, arg15.data()));
+                  cl::setKernelArg(data_, argPos++, arg15.size, arg15.data()));
     if(arg15.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg15.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg15.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg16.size, arg16.data()));
+                  cl::setKernelArg(data_, argPos++, arg16.size, arg16.data()));
     if(arg16.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg16.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg16.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg17.size, arg17.data()));
+                  cl::setKernelArg(data_, argPos++, arg17.size, arg17.data()));
     if(arg17.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg17.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg17.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg18.size, arg18.data()));
+                  cl::setKernelArg(data_, argPos++, arg18.size, arg18.data()));
     if(arg18.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg18.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg18.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg19.size, arg19.data()));
+                  cl::setKernelArg(data_, argPos++, arg19.size, arg19.data()));
     if(arg19.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg19.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg19.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg20.size, arg20.data()));
+                  cl::setKernelArg(data_, argPos++, arg20.size, arg20.data()));
     if(arg20.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg20.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg20.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg21.size, arg21.data()));
+                  cl::setKernelArg(data_, argPos++, arg21.size, arg21.data()));
     if(arg21.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg21.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg21.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg22.size, arg22.data()));
+                  cl::setKernelArg(data_, argPos++, arg22.size, arg22.data()));
     if(arg22.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg22.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg22.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg23.size, arg23.data()));
+                  cl::setKernelArg(data_, argPos++, arg23.size, arg23.data()));
     if(arg23.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg23.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg23.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg24.size, arg24.data()));
+                  cl::setKernelArg(data_, argPos++, arg24.size, arg24.data()));
     if(arg24.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg24.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg24.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg25.size, arg25.data()));
+                  cl::setKernelArg(data_, argPos++, arg25.size, arg25.data()));
     if(arg25.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg25.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg25.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg26.size, arg26.data()));
+                  cl::setKernelArg(data_, argPos++, arg26.size, arg26.data()));
     if(arg26.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg26.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg26.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg27.size, arg27.data()));
+                  cl::setKernelArg(data_, argPos++, arg27.size, arg27.data()));
     if(arg27.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg27.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg27.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg28.size, arg28.data()));
+                  cl::setKernelArg(data_, argPos++, arg28.size, arg28.data()));
     if(arg28.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg28.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg28.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg29.size, arg29.data()));
+                  cl::setKernelArg(data_, argPos++, arg29.size, arg29.data()));
     if(arg29.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg29.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg29.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg30.size, arg30.data()));
+                  cl::setKernelArg(data_, argPos++, arg30.size, arg30.data()));
     if(arg30.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg30.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg30.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg31.size, arg31.data()));
+                  cl::setKernelArg(data_, argPos++, arg31.size, arg31.data()));
     if(arg31.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg31.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg31.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg32.size, arg32.data()));
+                  cl::setKernelArg(data_, argPos++, arg32.size, arg32.data()));
     if(arg32.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg32.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg32.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg33.size, arg33.data()));
+                  cl::setKernelArg(data_, argPos++, arg33.size, arg33.data()));
     if(arg33.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg33.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg33.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg34.size, arg34.data()));
+                  cl::setKernelArg(data_, argPos++, arg34.size, arg34.data()));
     if(arg34.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg34.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg34.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg35.size, arg35.data()));
+                  cl::setKernelArg(data_, argPos++, arg35.size, arg35.data()));
     if(arg35.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg35.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg35.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg36.size, arg36.data()));
+                  cl::setKernelArg(data_, argPos++, arg36.size, arg36.data()));
     if(arg36.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg36.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg36.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg37.size, arg37.data()));
+                  cl::setKernelArg(data_, argPos++, arg37.size, arg37.data()));
     if(arg37.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg37.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg37.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg38.size, arg38.data()));
+                  cl::setKernelArg(data_, argPos++, arg38.size, arg38.data()));
     if(arg38.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg38.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg38.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -5793,247 +5793,247 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg5.size, arg5.data()));
+                  cl::setKernelArg(data_, argPos++, arg5.size, arg5.data()));
     if(arg5.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg5.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg5.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg6.size, arg6.data()));
+                  cl::setKernelArg(data_, argPos++, arg6.size, arg6.data()));
     if(arg6.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg6.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg6.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg7.size, arg7.data()));
+                  cl::setKernelArg(data_, argPos++, arg7.size, arg7.data()));
     if(arg7.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg7.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg7.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg8.size, arg8.data()));
+                  cl::setKernelArg(data_, argPos++, arg8.size, arg8.data()));
     if(arg8.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg8.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg8.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg9.size, arg9.data()));
+                  cl::setKernelArg(data_, argPos++, arg9.size, arg9.data()));
     if(arg9.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg9.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg9.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg10.size, arg10.data()));
+                  cl::setKernelArg(data_, argPos++, arg10.size, arg10.data()));
     if(arg10.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg10.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg10.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg11.size, arg11.data()));
+                  cl::setKernelArg(data_, argPos++, arg11.size, arg11.data()));
     if(arg11.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg11.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg11.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg12.size, arg12.data()));
+                  cl::setKernelArg(data_, argPos++, arg12.size, arg12.data()));
     if(arg12.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg12.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg12.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg13.size, arg13.data()));
+                  cl::setKernelArg(data_, argPos++, arg13.size, arg13.data()));
     if(arg13.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg13.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg13.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg14.size, arg14.data()));
+                  cl::setKernelArg(data_, argPos++, arg14.size, arg14.data()));
     if(arg14.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg14.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg14.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg15.size, arg15.data()));
+                  cl::setKernelArg(data_, argPos++, arg15.size, arg15.data()));
     if(arg15.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg15.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg15.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg16.size, arg16.data()));
+                  cl::setKernelArg(data_, argPos++, arg16.size, arg16.data()));
     if(arg16.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg16.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg16.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg17.size, arg17.data()));
+                  cl::setKernelArg(data_, argPos++, arg17.size, arg17.data()));
     if(arg17.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg17.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg17.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg18.size, arg18.data()));
+                  cl::setKernelArg(data_, argPos++, arg18.size, arg18.data()));
     if(arg18.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg18.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg18.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg19.size, arg19.data()));
+                  cl::setKernelArg(data_, argPos++, arg19.size, arg19.data()));
     if(arg19.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg19.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg19.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg20.size, arg20.data()));
+                  cl::setKernelArg(data_, argPos++, arg20.size, arg20.data()));
     if(arg20.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg20.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg20.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg21.size, arg21.data()));
+                  cl::setKernelArg(data_, argPos++, arg21.size, arg21.data()));
     if(arg21.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg21.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg21.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg22.size, arg22.data()));
+                  cl::setKernelArg(data_, argPos++, arg22.size, arg22.data()));
     if(arg22.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg22.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg22.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg23.size, arg23.data()));
+                  cl::setKernelArg(data_, argPos++, arg23.size, arg23.data()));
     if(arg23.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg23.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg23.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg24.size, arg24.data()));
+                  cl::setKernelArg(data_, argPos++, arg24.size, arg24.data()));
     if(arg24.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg24.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg24.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg25.size, arg25.data()));
+                  cl::setKernelArg(data_, argPos++, arg25.size, arg25.data()));
     if(arg25.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg25.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg25.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg26.size, arg26.data()));
+                  cl::setKernelArg(data_, argPos++, arg26.size, arg26.data()));
     if(arg26.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg26.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg26.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg27.size, arg27.data()));
+                  cl::setKernelArg(data_, argPos++, arg27.size, arg27.data()));
     if(arg27.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg27.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg27.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg28.size, arg28.data()));
+                  cl::setKernelArg(data_, argPos++, arg28.size, arg28.data()));
     if(arg28.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg28.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg28.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg29.size, arg29.data()));
+                  cl::setKernelArg(data_, argPos++, arg29.size, arg29.data()));
     if(arg29.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg29.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg29.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg30.size, arg30.data()));
+                  cl::setKernelArg(data_, argPos++, arg30.size, arg30.data()));
     if(arg30.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg30.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg30.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg31.size, arg31.data()));
+                  cl::setKernelArg(data_, argPos++, arg31.size, arg31.data()));
     if(arg31.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg31.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg31.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg32.size, arg32.data()));
+                  cl::setKernelArg(data_, argPos++, arg32.size, arg32.data()));
     if(arg32.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg32.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg32.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg33.size, arg33.data()));
+                  cl::setKernelArg(data_, argPos++, arg33.size, arg33.data()));
     if(arg33.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg33.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg33.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg34.size, arg34.data()));
+                  cl::setKernelArg(data_, argPos++, arg34.size, arg34.data()));
     if(arg34.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg34.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg34.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg35.size, arg35.data()));
+                  cl::setKernelArg(data_, argPos++, arg35.size, arg35.data()));
     if(arg35.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg35.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg35.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg36.size, arg36.data()));
+                  cl::setKernelArg(data_, argPos++, arg36.size, arg36.data()));
     if(arg36.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg36.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg36.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg37.size, arg37.data()));
+                  cl::setKernelArg(data_, argPos++, arg37.size, arg37.data()));
     if(arg37.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg37.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg37.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg38.size, arg38.data()));
+                  cl::setKernelArg(data_, argPos++, arg38.size, arg38.data()));
     if(arg38.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg38.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg38.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg39.size, arg39.data()));
+                  cl::setKernelArg(data_, argPos++, arg39.size, arg39.data()));
     if(arg39.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg39.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg39.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -6068,253 +6068,253 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg5.size, arg5.data()));
+                  cl::setKernelArg(data_, argPos++, arg5.size, arg5.data()));
     if(arg5.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg5.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg5.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg6.size, arg6.data()));
+                  cl::setKernelArg(data_, argPos++, arg6.size, arg6.data()));
     if(arg6.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg6.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg6.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg7.size, arg7.data()));
+                  cl::setKernelArg(data_, argPos++, arg7.size, arg7.data()));
     if(arg7.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg7.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg7.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg8.size, arg8.data()));
+                  cl::setKernelArg(data_, argPos++, arg8.size, arg8.data()));
     if(arg8.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg8.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg8.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg9.size, arg9.data()));
+                  cl::setKernelArg(data_, argPos++, arg9.size, arg9.data()));
     if(arg9.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg9.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg9.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg10.size, arg10.data()));
+                  cl::setKernelArg(data_, argPos++, arg10.size, arg10.data()));
     if(arg10.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg10.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg10.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg11.size, arg11.data()));
+                  cl::setKernelArg(data_, argPos++, arg11.size, arg11.data()));
     if(arg11.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg11.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg11.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg12.size, arg12.data()));
+                  cl::setKernelArg(data_, argPos++, arg12.size, arg12.data()));
     if(arg12.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg12.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg12.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg13.size, arg13.data()));
+                  cl::setKernelArg(data_, argPos++, arg13.size, arg13.data()));
     if(arg13.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg13.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg13.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg14.size, arg14.data()));
+                  cl::setKernelArg(data_, argPos++, arg14.size, arg14.data()));
     if(arg14.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg14.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg14.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg15.size, arg15.data()));
+                  cl::setKernelArg(data_, argPos++, arg15.size, arg15.data()));
     if(arg15.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg15.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg15.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg16.size, arg16.data()));
+                  cl::setKernelArg(data_, argPos++, arg16.size, arg16.data()));
     if(arg16.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg16.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg16.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg17.size, arg17.data()));
+                  cl::setKernelArg(data_, argPos++, arg17.size, arg17.data()));
     if(arg17.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg17.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg17.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg18.size, arg18.data()));
+                  cl::setKernelArg(data_, argPos++, arg18.size, arg18.data()));
     if(arg18.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg18.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg18.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg19.size, arg19.data()));
+                  cl::setKernelArg(data_, argPos++, arg19.size, arg19.data()));
     if(arg19.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg19.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg19.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg20.size, arg20.data()));
+                  cl::setKernelArg(data_, argPos++, arg20.size, arg20.data()));
     if(arg20.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg20.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg20.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg21.size, arg21.data()));
+                  cl::setKernelArg(data_, argPos++, arg21.size, arg21.data()));
     if(arg21.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg21.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg21.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg22.size, arg22.data()));
+                  cl::setKernelArg(data_, argPos++, arg22.size, arg22.data()));
     if(arg22.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg22.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg22.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg23.size, arg23.data()));
+                  cl::setKernelArg(data_, argPos++, arg23.size, arg23.data()));
     if(arg23.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg23.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg23.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg24.size, arg24.data()));
+                  cl::setKernelArg(data_, argPos++, arg24.size, arg24.data()));
     if(arg24.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg24.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg24.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg25.size, arg25.data()));
+                  cl::setKernelArg(data_, argPos++, arg25.size, arg25.data()));
     if(arg25.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg25.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg25.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg26.size, arg26.data()));
+                  cl::setKernelArg(data_, argPos++, arg26.size, arg26.data()));
     if(arg26.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg26.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg26.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg27.size, arg27.data()));
+                  cl::setKernelArg(data_, argPos++, arg27.size, arg27.data()));
     if(arg27.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg27.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg27.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg28.size, arg28.data()));
+                  cl::setKernelArg(data_, argPos++, arg28.size, arg28.data()));
     if(arg28.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg28.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg28.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg29.size, arg29.data()));
+                  cl::setKernelArg(data_, argPos++, arg29.size, arg29.data()));
     if(arg29.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg29.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg29.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg30.size, arg30.data()));
+                  cl::setKernelArg(data_, argPos++, arg30.size, arg30.data()));
     if(arg30.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg30.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg30.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg31.size, arg31.data()));
+                  cl::setKernelArg(data_, argPos++, arg31.size, arg31.data()));
     if(arg31.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg31.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg31.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg32.size, arg32.data()));
+                  cl::setKernelArg(data_, argPos++, arg32.size, arg32.data()));
     if(arg32.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg32.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg32.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg33.size, arg33.data()));
+                  cl::setKernelArg(data_, argPos++, arg33.size, arg33.data()));
     if(arg33.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg33.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg33.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg34.size, arg34.data()));
+                  cl::setKernelArg(data_, argPos++, arg34.size, arg34.data()));
     if(arg34.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg34.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg34.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg35.size, arg35.data()));
+                  cl::setKernelArg(data_, argPos++, arg35.size, arg35.data()));
     if(arg35.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg35.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg35.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg36.size, arg36.data()));
+                  cl::setKernelArg(data_, argPos++, arg36.size, arg36.data()));
     if(arg36.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg36.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg36.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg37.size, arg37.data()));
+                  cl::setKernelArg(data_, argPos++, arg37.size, arg37.data()));
     if(arg37.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg37.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg37.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg38.size, arg38.data()));
+                  cl::setKernelArg(data_, argPos++, arg38.size, arg38.data()));
     if(arg38.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg38.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg38.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg39.size, arg39.data()));
+                  cl::setKernelArg(data_, argPos++, arg39.size, arg39.data()));
     if(arg39.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg39.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg39.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg40.size, arg40.data()));
+                  cl::setKernelArg(data_, argPos++, arg40.size, arg40.data()));
     if(arg40.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg40.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg40.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -6349,259 +6349,259 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg5.size, arg5.data()));
+                  cl::setKernelArg(data_, argPos++, arg5.size, arg5.data()));
     if(arg5.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg5.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg5.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg6.size, arg6.data()));
+                  cl::setKernelArg(data_, argPos++, arg6.size, arg6.data()));
     if(arg6.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg6.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg6.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg7.size, arg7.data()));
+                  cl::setKernelArg(data_, argPos++, arg7.size, arg7.data()));
     if(arg7.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg7.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg7.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg8.size, arg8.data()));
+                  cl::setKernelArg(data_, argPos++, arg8.size, arg8.data()));
     if(arg8.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg8.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg8.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg9.size, arg9.data()));
+                  cl::setKernelArg(data_, argPos++, arg9.size, arg9.data()));
     if(arg9.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg9.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg9.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg10.size, arg10.data()));
+                  cl::setKernelArg(data_, argPos++, arg10.size, arg10.data()));
     if(arg10.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg10.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg10.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg11.size, arg11.data()));
+                  cl::setKernelArg(data_, argPos++, arg11.size, arg11.data()));
     if(arg11.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg11.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg11.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg12.size, arg12.data()));
+                  cl::setKernelArg(data_, argPos++, arg12.size, arg12.data()));
     if(arg12.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg12.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg12.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg13.size, arg13.data()));
+                  cl::setKernelArg(data_, argPos++, arg13.size, arg13.data()));
     if(arg13.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg13.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg13.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg14.size, arg14.data()));
+                  cl::setKernelArg(data_, argPos++, arg14.size, arg14.data()));
     if(arg14.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg14.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg14.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg15.size, arg15.data()));
+                  cl::setKernelArg(data_, argPos++, arg15.size, arg15.data()));
     if(arg15.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg15.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg15.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg16.size, arg16.data()));
+                  cl::setKernelArg(data_, argPos++, arg16.size, arg16.data()));
     if(arg16.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg16.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg16.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg17.size, arg17.data()));
+                  cl::setKernelArg(data_, argPos++, arg17.size, arg17.data()));
     if(arg17.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg17.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg17.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg18.size, arg18.data()));
+                  cl::setKernelArg(data_, argPos++, arg18.size, arg18.data()));
     if(arg18.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg18.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg18.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg19.size, arg19.data()));
+                  cl::setKernelArg(data_, argPos++, arg19.size, arg19.data()));
     if(arg19.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg19.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg19.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg20.size, arg20.data()));
+                  cl::setKernelArg(data_, argPos++, arg20.size, arg20.data()));
     if(arg20.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg20.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg20.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg21.size, arg21.data()));
+                  cl::setKernelArg(data_, argPos++, arg21.size, arg21.data()));
     if(arg21.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg21.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg21.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg22.size, arg22.data()));
+                  cl::setKernelArg(data_, argPos++, arg22.size, arg22.data()));
     if(arg22.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg22.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg22.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg23.size, arg23.data()));
+                  cl::setKernelArg(data_, argPos++, arg23.size, arg23.data()));
     if(arg23.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg23.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg23.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg24.size, arg24.data()));
+                  cl::setKernelArg(data_, argPos++, arg24.size, arg24.data()));
     if(arg24.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg24.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg24.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg25.size, arg25.data()));
+                  cl::setKernelArg(data_, argPos++, arg25.size, arg25.data()));
     if(arg25.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg25.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg25.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg26.size, arg26.data()));
+                  cl::setKernelArg(data_, argPos++, arg26.size, arg26.data()));
     if(arg26.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg26.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg26.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg27.size, arg27.data()));
+                  cl::setKernelArg(data_, argPos++, arg27.size, arg27.data()));
     if(arg27.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg27.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg27.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg28.size, arg28.data()));
+                  cl::setKernelArg(data_, argPos++, arg28.size, arg28.data()));
     if(arg28.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg28.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg28.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg29.size, arg29.data()));
+                  cl::setKernelArg(data_, argPos++, arg29.size, arg29.data()));
     if(arg29.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg29.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg29.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg30.size, arg30.data()));
+                  cl::setKernelArg(data_, argPos++, arg30.size, arg30.data()));
     if(arg30.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg30.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg30.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg31.size, arg31.data()));
+                  cl::setKernelArg(data_, argPos++, arg31.size, arg31.data()));
     if(arg31.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg31.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg31.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg32.size, arg32.data()));
+                  cl::setKernelArg(data_, argPos++, arg32.size, arg32.data()));
     if(arg32.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg32.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg32.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg33.size, arg33.data()));
+                  cl::setKernelArg(data_, argPos++, arg33.size, arg33.data()));
     if(arg33.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg33.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg33.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg34.size, arg34.data()));
+                  cl::setKernelArg(data_, argPos++, arg34.size, arg34.data()));
     if(arg34.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg34.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg34.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg35.size, arg35.data()));
+                  cl::setKernelArg(data_, argPos++, arg35.size, arg35.data()));
     if(arg35.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg35.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg35.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg36.size, arg36.data()));
+                  cl::setKernelArg(data_, argPos++, arg36.size, arg36.data()));
     if(arg36.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg36.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg36.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg37.size, arg37.data()));
+                  cl::setKernelArg(data_, argPos++, arg37.size, arg37.data()));
     if(arg37.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg37.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg37.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg38.size, arg38.data()));
+                  cl::setKernelArg(data_, argPos++, arg38.size, arg38.data()));
     if(arg38.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg38.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg38.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg39.size, arg39.data()));
+                  cl::setKernelArg(data_, argPos++, arg39.size, arg39.data()));
     if(arg39.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg39.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg39.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg40.size, arg40.data()));
+                  cl::setKernelArg(data_, argPos++, arg40.size, arg40.data()));
     if(arg40.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg40.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg40.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg41.size, arg41.data()));
+                  cl::setKernelArg(data_, argPos++, arg41.size, arg41.data()));
     if(arg41.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg41.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg41.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -6637,265 +6637,265 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg5.size, arg5.data()));
+                  cl::setKernelArg(data_, argPos++, arg5.size, arg5.data()));
     if(arg5.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg5.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg5.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg6.size, arg6.data()));
+                  cl::setKernelArg(data_, argPos++, arg6.size, arg6.data()));
     if(arg6.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg6.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg6.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg7.size, arg7.data()));
+                  cl::setKernelArg(data_, argPos++, arg7.size, arg7.data()));
     if(arg7.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg7.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg7.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg8.size, arg8.data()));
+                  cl::setKernelArg(data_, argPos++, arg8.size, arg8.data()));
     if(arg8.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg8.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg8.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg9.size, arg9.data()));
+                  cl::setKernelArg(data_, argPos++, arg9.size, arg9.data()));
     if(arg9.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg9.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg9.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg10.size, arg10.data()));
+                  cl::setKernelArg(data_, argPos++, arg10.size, arg10.data()));
     if(arg10.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg10.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg10.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg11.size, arg11.data()));
+                  cl::setKernelArg(data_, argPos++, arg11.size, arg11.data()));
     if(arg11.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg11.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg11.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg12.size, arg12.data()));
+                  cl::setKernelArg(data_, argPos++, arg12.size, arg12.data()));
     if(arg12.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg12.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg12.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg13.size, arg13.data()));
+                  cl::setKernelArg(data_, argPos++, arg13.size, arg13.data()));
     if(arg13.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg13.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg13.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg14.size, arg14.data()));
+                  cl::setKernelArg(data_, argPos++, arg14.size, arg14.data()));
     if(arg14.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg14.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg14.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg15.size, arg15.data()));
+                  cl::setKernelArg(data_, argPos++, arg15.size, arg15.data()));
     if(arg15.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg15.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg15.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg16.size, arg16.data()));
+                  cl::setKernelArg(data_, argPos++, arg16.size, arg16.data()));
     if(arg16.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg16.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg16.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg17.size, arg17.data()));
+                  cl::setKernelArg(data_, argPos++, arg17.size, arg17.data()));
     if(arg17.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg17.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg17.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg18.size, arg18.data()));
+                  cl::setKernelArg(data_, argPos++, arg18.size, arg18.data()));
     if(arg18.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg18.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg18.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg19.size, arg19.data()));
+                  cl::setKernelArg(data_, argPos++, arg19.size, arg19.data()));
     if(arg19.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg19.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg19.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg20.size, arg20.data()));
+                  cl::setKernelArg(data_, argPos++, arg20.size, arg20.data()));
     if(arg20.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg20.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg20.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg21.size, arg21.data()));
+                  cl::setKernelArg(data_, argPos++, arg21.size, arg21.data()));
     if(arg21.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg21.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg21.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg22.size, arg22.data()));
+                  cl::setKernelArg(data_, argPos++, arg22.size, arg22.data()));
     if(arg22.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg22.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg22.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg23.size, arg23.data()));
+                  cl::setKernelArg(data_, argPos++, arg23.size, arg23.data()));
     if(arg23.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg23.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg23.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg24.size, arg24.data()));
+                  cl::setKernelArg(data_, argPos++, arg24.size, arg24.data()));
     if(arg24.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg24.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg24.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg25.size, arg25.data()));
+                  cl::setKernelArg(data_, argPos++, arg25.size, arg25.data()));
     if(arg25.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg25.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg25.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg26.size, arg26.data()));
+                  cl::setKernelArg(data_, argPos++, arg26.size, arg26.data()));
     if(arg26.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg26.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg26.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg27.size, arg27.data()));
+                  cl::setKernelArg(data_, argPos++, arg27.size, arg27.data()));
     if(arg27.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg27.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg27.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg28.size, arg28.data()));
+                  cl::setKernelArg(data_, argPos++, arg28.size, arg28.data()));
     if(arg28.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg28.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg28.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg29.size, arg29.data()));
+                  cl::setKernelArg(data_, argPos++, arg29.size, arg29.data()));
     if(arg29.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg29.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg29.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg30.size, arg30.data()));
+                  cl::setKernelArg(data_, argPos++, arg30.size, arg30.data()));
     if(arg30.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg30.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg30.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg31.size, arg31.data()));
+                  cl::setKernelArg(data_, argPos++, arg31.size, arg31.data()));
     if(arg31.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg31.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg31.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg32.size, arg32.data()));
+                  cl::setKernelArg(data_, argPos++, arg32.size, arg32.data()));
     if(arg32.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg32.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg32.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg33.size, arg33.data()));
+                  cl::setKernelArg(data_, argPos++, arg33.size, arg33.data()));
     if(arg33.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg33.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg33.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg34.size, arg34.data()));
+                  cl::setKernelArg(data_, argPos++, arg34.size, arg34.data()));
     if(arg34.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg34.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg34.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg35.size, arg35.data()));
+                  cl::setKernelArg(data_, argPos++, arg35.size, arg35.data()));
     if(arg35.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg35.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg35.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg36.size, arg36.data()));
+                  cl::setKernelArg(data_, argPos++, arg36.size, arg36.data()));
     if(arg36.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg36.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg36.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg37.size, arg37.data()));
+                  cl::setKernelArg(data_, argPos++, arg37.size, arg37.data()));
     if(arg37.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg37.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg37.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg38.size, arg38.data()));
+                  cl::setKernelArg(data_, argPos++, arg38.size, arg38.data()));
     if(arg38.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg38.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg38.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg39.size, arg39.data()));
+                  cl::setKernelArg(data_, argPos++, arg39.size, arg39.data()));
     if(arg39.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg39.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg39.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg40.size, arg40.data()));
+                  cl::setKernelArg(data_, argPos++, arg40.size, arg40.data()));
     if(arg40.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg40.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg40.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg41.size, arg41.data()));
+                  cl::setKernelArg(data_, argPos++, arg41.size, arg41.data()));
     if(arg41.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg41.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg41.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg42.size, arg42.data()));
+                  cl::setKernelArg(data_, argPos++, arg42.size, arg42.data()));
     if(arg42.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg42.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg42.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -6931,271 +6931,271 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg5.size, arg5.data()));
+                  cl::setKernelArg(data_, argPos++, arg5.size, arg5.data()));
     if(arg5.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg5.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg5.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg6.size, arg6.data()));
+                  cl::setKernelArg(data_, argPos++, arg6.size, arg6.data()));
     if(arg6.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg6.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg6.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg7.size, arg7.data()));
+                  cl::setKernelArg(data_, argPos++, arg7.size, arg7.data()));
     if(arg7.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg7.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg7.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg8.size, arg8.data()));
+                  cl::setKernelArg(data_, argPos++, arg8.size, arg8.data()));
     if(arg8.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg8.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg8.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg9.size, arg9.data()));
+                  cl::setKernelArg(data_, argPos++, arg9.size, arg9.data()));
     if(arg9.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg9.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg9.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg10.size, arg10.data()));
+                  cl::setKernelArg(data_, argPos++, arg10.size, arg10.data()));
     if(arg10.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg10.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg10.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg11.size, arg11.data()));
+                  cl::setKernelArg(data_, argPos++, arg11.size, arg11.data()));
     if(arg11.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg11.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg11.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg12.size, arg12.data()));
+                  cl::setKernelArg(data_, argPos++, arg12.size, arg12.data()));
     if(arg12.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg12.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg12.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg13.size, arg13.data()));
+                  cl::setKernelArg(data_, argPos++, arg13.size, arg13.data()));
     if(arg13.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg13.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg13.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg14.size, arg14.data()));
+                  cl::setKernelArg(data_, argPos++, arg14.size, arg14.data()));
     if(arg14.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg14.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg14.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg15.size, arg15.data()));
+                  cl::setKernelArg(data_, argPos++, arg15.size, arg15.data()));
     if(arg15.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg15.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg15.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg16.size, arg16.data()));
+                  cl::setKernelArg(data_, argPos++, arg16.size, arg16.data()));
     if(arg16.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg16.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg16.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg17.size, arg17.data()));
+                  cl::setKernelArg(data_, argPos++, arg17.size, arg17.data()));
     if(arg17.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg17.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg17.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg18.size, arg18.data()));
+                  cl::setKernelArg(data_, argPos++, arg18.size, arg18.data()));
     if(arg18.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg18.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg18.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg19.size, arg19.data()));
+                  cl::setKernelArg(data_, argPos++, arg19.size, arg19.data()));
     if(arg19.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg19.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg19.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg20.size, arg20.data()));
+                  cl::setKernelArg(data_, argPos++, arg20.size, arg20.data()));
     if(arg20.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg20.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg20.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg21.size, arg21.data()));
+                  cl::setKernelArg(data_, argPos++, arg21.size, arg21.data()));
     if(arg21.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg21.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg21.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg22.size, arg22.data()));
+                  cl::setKernelArg(data_, argPos++, arg22.size, arg22.data()));
     if(arg22.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg22.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg22.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg23.size, arg23.data()));
+                  cl::setKernelArg(data_, argPos++, arg23.size, arg23.data()));
     if(arg23.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg23.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg23.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg24.size, arg24.data()));
+                  cl::setKernelArg(data_, argPos++, arg24.size, arg24.data()));
     if(arg24.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg24.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg24.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg25.size, arg25.data()));
+                  cl::setKernelArg(data_, argPos++, arg25.size, arg25.data()));
     if(arg25.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg25.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg25.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg26.size, arg26.data()));
+                  cl::setKernelArg(data_, argPos++, arg26.size, arg26.data()));
     if(arg26.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg26.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg26.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg27.size, arg27.data()));
+                  cl::setKernelArg(data_, argPos++, arg27.size, arg27.data()));
     if(arg27.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg27.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg27.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg28.size, arg28.data()));
+                  cl::setKernelArg(data_, argPos++, arg28.size, arg28.data()));
     if(arg28.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg28.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg28.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg29.size, arg29.data()));
+                  cl::setKernelArg(data_, argPos++, arg29.size, arg29.data()));
     if(arg29.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg29.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg29.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg30.size, arg30.data()));
+                  cl::setKernelArg(data_, argPos++, arg30.size, arg30.data()));
     if(arg30.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg30.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg30.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg31.size, arg31.data()));
+                  cl::setKernelArg(data_, argPos++, arg31.size, arg31.data()));
     if(arg31.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg31.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg31.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg32.size, arg32.data()));
+                  cl::setKernelArg(data_, argPos++, arg32.size, arg32.data()));
     if(arg32.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg32.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg32.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg33.size, arg33.data()));
+                  cl::setKernelArg(data_, argPos++, arg33.size, arg33.data()));
     if(arg33.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg33.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg33.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg34.size, arg34.data()));
+                  cl::setKernelArg(data_, argPos++, arg34.size, arg34.data()));
     if(arg34.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg34.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg34.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg35.size, arg35.data()));
+                  cl::setKernelArg(data_, argPos++, arg35.size, arg35.data()));
     if(arg35.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg35.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg35.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg36.size, arg36.data()));
+                  cl::setKernelArg(data_, argPos++, arg36.size, arg36.data()));
     if(arg36.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg36.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg36.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg37.size, arg37.data()));
+                  cl::setKernelArg(data_, argPos++, arg37.size, arg37.data()));
     if(arg37.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg37.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg37.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg38.size, arg38.data()));
+                  cl::setKernelArg(data_, argPos++, arg38.size, arg38.data()));
     if(arg38.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg38.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg38.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg39.size, arg39.data()));
+                  cl::setKernelArg(data_, argPos++, arg39.size, arg39.data()));
     if(arg39.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg39.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg39.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg40.size, arg40.data()));
+                  cl::setKernelArg(data_, argPos++, arg40.size, arg40.data()));
     if(arg40.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg40.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg40.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg41.size, arg41.data()));
+                  cl::setKernelArg(data_, argPos++, arg41.size, arg41.data()));
     if(arg41.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg41.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg41.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg42.size, arg42.data()));
+                  cl::setKernelArg(data_, argPos++, arg42.size, arg42.data()));
     if(arg42.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg42.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg42.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg43.size, arg43.data()));
+                  cl::setKernelArg(data_, argPos++, arg43.size, arg43.data()));
     if(arg43.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg43.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg43.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -7231,277 +7231,277 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg5.size, arg5.data()));
+                  cl::setKernelArg(data_, argPos++, arg5.size, arg5.data()));
     if(arg5.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg5.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg5.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg6.size, arg6.data()));
+                  cl::setKernelArg(data_, argPos++, arg6.size, arg6.data()));
     if(arg6.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg6.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg6.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg7.size, arg7.data()));
+                  cl::setKernelArg(data_, argPos++, arg7.size, arg7.data()));
     if(arg7.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg7.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg7.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg8.size, arg8.data()));
+                  cl::setKernelArg(data_, argPos++, arg8.size, arg8.data()));
     if(arg8.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg8.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg8.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg9.size, arg9.data()));
+                  cl::setKernelArg(data_, argPos++, arg9.size, arg9.data()));
     if(arg9.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg9.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg9.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg10.size, arg10.data()));
+                  cl::setKernelArg(data_, argPos++, arg10.size, arg10.data()));
     if(arg10.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg10.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg10.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg11.size, arg11.data()));
+                  cl::setKernelArg(data_, argPos++, arg11.size, arg11.data()));
     if(arg11.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg11.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg11.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg12.size, arg12.data()));
+                  cl::setKernelArg(data_, argPos++, arg12.size, arg12.data()));
     if(arg12.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg12.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg12.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg13.size, arg13.data()));
+                  cl::setKernelArg(data_, argPos++, arg13.size, arg13.data()));
     if(arg13.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg13.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg13.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg14.size, arg14.data()));
+                  cl::setKernelArg(data_, argPos++, arg14.size, arg14.data()));
     if(arg14.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg14.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg14.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg15.size, arg15.data()));
+                  cl::setKernelArg(data_, argPos++, arg15.size, arg15.data()));
     if(arg15.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg15.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg15.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg16.size, arg16.data()));
+                  cl::setKernelArg(data_, argPos++, arg16.size, arg16.data()));
     if(arg16.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg16.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg16.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg17.size, arg17.data()));
+                  cl::setKernelArg(data_, argPos++, arg17.size, arg17.data()));
     if(arg17.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg17.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg17.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg18.size, arg18.data()));
+                  cl::setKernelArg(data_, argPos++, arg18.size, arg18.data()));
     if(arg18.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg18.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg18.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg19.size, arg19.data()));
+                  cl::setKernelArg(data_, argPos++, arg19.size, arg19.data()));
     if(arg19.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg19.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg19.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg20.size, arg20.data()));
+                  cl::setKernelArg(data_, argPos++, arg20.size, arg20.data()));
     if(arg20.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg20.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg20.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg21.size, arg21.data()));
+                  cl::setKernelArg(data_, argPos++, arg21.size, arg21.data()));
     if(arg21.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg21.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg21.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg22.size, arg22.data()));
+                  cl::setKernelArg(data_, argPos++, arg22.size, arg22.data()));
     if(arg22.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg22.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg22.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg23.size, arg23.data()));
+                  cl::setKernelArg(data_, argPos++, arg23.size, arg23.data()));
     if(arg23.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg23.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg23.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg24.size, arg24.data()));
+                  cl::setKernelArg(data_, argPos++, arg24.size, arg24.data()));
     if(arg24.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg24.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg24.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg25.size, arg25.data()));
+                  cl::setKernelArg(data_, argPos++, arg25.size, arg25.data()));
     if(arg25.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg25.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg25.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg26.size, arg26.data()));
+                  cl::setKernelArg(data_, argPos++, arg26.size, arg26.data()));
     if(arg26.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg26.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg26.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg27.size, arg27.data()));
+                  cl::setKernelArg(data_, argPos++, arg27.size, arg27.data()));
     if(arg27.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg27.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg27.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg28.size, arg28.data()));
+                  cl::setKernelArg(data_, argPos++, arg28.size, arg28.data()));
     if(arg28.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg28.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg28.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg29.size, arg29.data()));
+                  cl::setKernelArg(data_, argPos++, arg29.size, arg29.data()));
     if(arg29.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg29.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg29.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg30.size, arg30.data()));
+                  cl::setKernelArg(data_, argPos++, arg30.size, arg30.data()));
     if(arg30.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg30.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg30.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg31.size, arg31.data()));
+                  cl::setKernelArg(data_, argPos++, arg31.size, arg31.data()));
     if(arg31.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg31.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg31.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg32.size, arg32.data()));
+                  cl::setKernelArg(data_, argPos++, arg32.size, arg32.data()));
     if(arg32.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg32.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg32.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg33.size, arg33.data()));
+                  cl::setKernelArg(data_, argPos++, arg33.size, arg33.data()));
     if(arg33.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg33.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg33.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg34.size, arg34.data()));
+                  cl::setKernelArg(data_, argPos++, arg34.size, arg34.data()));
     if(arg34.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg34.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg34.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg35.size, arg35.data()));
+                  cl::setKernelArg(data_, argPos++, arg35.size, arg35.data()));
     if(arg35.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg35.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg35.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg36.size, arg36.data()));
+                  cl::setKernelArg(data_, argPos++, arg36.size, arg36.data()));
     if(arg36.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg36.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg36.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg37.size, arg37.data()));
+                  cl::setKernelArg(data_, argPos++, arg37.size, arg37.data()));
     if(arg37.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg37.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg37.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg38.size, arg38.data()));
+                  cl::setKernelArg(data_, argPos++, arg38.size, arg38.data()));
     if(arg38.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg38.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg38.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg39.size, arg39.data()));
+                  cl::setKernelArg(data_, argPos++, arg39.size, arg39.data()));
     if(arg39.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg39.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg39.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg40.size, arg40.data()));
+                  cl::setKernelArg(data_, argPos++, arg40.size, arg40.data()));
     if(arg40.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg40.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg40.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg41.size, arg41.data()));
+                  cl::setKernelArg(data_, argPos++, arg41.size, arg41.data()));
     if(arg41.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg41.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg41.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg42.size, arg42.data()));
+                  cl::setKernelArg(data_, argPos++, arg42.size, arg42.data()));
     if(arg42.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg42.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg42.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg43.size, arg43.data()));
+                  cl::setKernelArg(data_, argPos++, arg43.size, arg43.data()));
     if(arg43.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg43.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg43.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg44.size, arg44.data()));
+                  cl::setKernelArg(data_, argPos++, arg44.size, arg44.data()));
     if(arg44.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg44.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg44.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -7538,283 +7538,283 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg5.size, arg5.data()));
+                  cl::setKernelArg(data_, argPos++, arg5.size, arg5.data()));
     if(arg5.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg5.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg5.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg6.size, arg6.data()));
+                  cl::setKernelArg(data_, argPos++, arg6.size, arg6.data()));
     if(arg6.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg6.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg6.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg7.size, arg7.data()));
+                  cl::setKernelArg(data_, argPos++, arg7.size, arg7.data()));
     if(arg7.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg7.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg7.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg8.size, arg8.data()));
+                  cl::setKernelArg(data_, argPos++, arg8.size, arg8.data()));
     if(arg8.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg8.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg8.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg9.size, arg9.data()));
+                  cl::setKernelArg(data_, argPos++, arg9.size, arg9.data()));
     if(arg9.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg9.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg9.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg10.size, arg10.data()));
+                  cl::setKernelArg(data_, argPos++, arg10.size, arg10.data()));
     if(arg10.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg10.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg10.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg11.size, arg11.data()));
+                  cl::setKernelArg(data_, argPos++, arg11.size, arg11.data()));
     if(arg11.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg11.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg11.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg12.size, arg12.data()));
+                  cl::setKernelArg(data_, argPos++, arg12.size, arg12.data()));
     if(arg12.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg12.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg12.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg13.size, arg13.data()));
+                  cl::setKernelArg(data_, argPos++, arg13.size, arg13.data()));
     if(arg13.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg13.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg13.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg14.size, arg14.data()));
+                  cl::setKernelArg(data_, argPos++, arg14.size, arg14.data()));
     if(arg14.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg14.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg14.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg15.size, arg15.data()));
+                  cl::setKernelArg(data_, argPos++, arg15.size, arg15.data()));
     if(arg15.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg15.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg15.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg16.size, arg16.data()));
+                  cl::setKernelArg(data_, argPos++, arg16.size, arg16.data()));
     if(arg16.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg16.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg16.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg17.size, arg17.data()));
+                  cl::setKernelArg(data_, argPos++, arg17.size, arg17.data()));
     if(arg17.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg17.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg17.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg18.size, arg18.data()));
+                  cl::setKernelArg(data_, argPos++, arg18.size, arg18.data()));
     if(arg18.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg18.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg18.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg19.size, arg19.data()));
+                  cl::setKernelArg(data_, argPos++, arg19.size, arg19.data()));
     if(arg19.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg19.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg19.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg20.size, arg20.data()));
+                  cl::setKernelArg(data_, argPos++, arg20.size, arg20.data()));
     if(arg20.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg20.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg20.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg21.size, arg21.data()));
+                  cl::setKernelArg(data_, argPos++, arg21.size, arg21.data()));
     if(arg21.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg21.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg21.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg22.size, arg22.data()));
+                  cl::setKernelArg(data_, argPos++, arg22.size, arg22.data()));
     if(arg22.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg22.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg22.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg23.size, arg23.data()));
+                  cl::setKernelArg(data_, argPos++, arg23.size, arg23.data()));
     if(arg23.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg23.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg23.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg24.size, arg24.data()));
+                  cl::setKernelArg(data_, argPos++, arg24.size, arg24.data()));
     if(arg24.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg24.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg24.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg25.size, arg25.data()));
+                  cl::setKernelArg(data_, argPos++, arg25.size, arg25.data()));
     if(arg25.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg25.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg25.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg26.size, arg26.data()));
+                  cl::setKernelArg(data_, argPos++, arg26.size, arg26.data()));
     if(arg26.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg26.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg26.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg27.size, arg27.data()));
+                  cl::setKernelArg(data_, argPos++, arg27.size, arg27.data()));
     if(arg27.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg27.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg27.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg28.size, arg28.data()));
+                  cl::setKernelArg(data_, argPos++, arg28.size, arg28.data()));
     if(arg28.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg28.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg28.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg29.size, arg29.data()));
+                  cl::setKernelArg(data_, argPos++, arg29.size, arg29.data()));
     if(arg29.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg29.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg29.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg30.size, arg30.data()));
+                  cl::setKernelArg(data_, argPos++, arg30.size, arg30.data()));
     if(arg30.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg30.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg30.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg31.size, arg31.data()));
+                  cl::setKernelArg(data_, argPos++, arg31.size, arg31.data()));
     if(arg31.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg31.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg31.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg32.size, arg32.data()));
+                  cl::setKernelArg(data_, argPos++, arg32.size, arg32.data()));
     if(arg32.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg32.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg32.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg33.size, arg33.data()));
+                  cl::setKernelArg(data_, argPos++, arg33.size, arg33.data()));
     if(arg33.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg33.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg33.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg34.size, arg34.data()));
+                  cl::setKernelArg(data_, argPos++, arg34.size, arg34.data()));
     if(arg34.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg34.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg34.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg35.size, arg35.data()));
+                  cl::setKernelArg(data_, argPos++, arg35.size, arg35.data()));
     if(arg35.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg35.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg35.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg36.size, arg36.data()));
+                  cl::setKernelArg(data_, argPos++, arg36.size, arg36.data()));
     if(arg36.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg36.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg36.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg37.size, arg37.data()));
+                  cl::setKernelArg(data_, argPos++, arg37.size, arg37.data()));
     if(arg37.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg37.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg37.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg38.size, arg38.data()));
+                  cl::setKernelArg(data_, argPos++, arg38.size, arg38.data()));
     if(arg38.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg38.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg38.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg39.size, arg39.data()));
+                  cl::setKernelArg(data_, argPos++, arg39.size, arg39.data()));
     if(arg39.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg39.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg39.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg40.size, arg40.data()));
+                  cl::setKernelArg(data_, argPos++, arg40.size, arg40.data()));
     if(arg40.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg40.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg40.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg41.size, arg41.data()));
+                  cl::setKernelArg(data_, argPos++, arg41.size, arg41.data()));
     if(arg41.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg41.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg41.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg42.size, arg42.data()));
+                  cl::setKernelArg(data_, argPos++, arg42.size, arg42.data()));
     if(arg42.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg42.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg42.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg43.size, arg43.data()));
+                  cl::setKernelArg(data_, argPos++, arg43.size, arg43.data()));
     if(arg43.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg43.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg43.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg44.size, arg44.data()));
+                  cl::setKernelArg(data_, argPos++, arg44.size, arg44.data()));
     if(arg44.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg44.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg44.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg45.size, arg45.data()));
+                  cl::setKernelArg(data_, argPos++, arg45.size, arg45.data()));
     if(arg45.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg45.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg45.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -7851,289 +7851,289 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg5.size, arg5.data()));
+                  cl::setKernelArg(data_, argPos++, arg5.size, arg5.data()));
     if(arg5.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg5.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg5.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg6.size, arg6.data()));
+                  cl::setKernelArg(data_, argPos++, arg6.size, arg6.data()));
     if(arg6.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg6.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg6.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg7.size, arg7.data()));
+                  cl::setKernelArg(data_, argPos++, arg7.size, arg7.data()));
     if(arg7.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg7.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg7.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg8.size, arg8.data()));
+                  cl::setKernelArg(data_, argPos++, arg8.size, arg8.data()));
     if(arg8.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg8.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg8.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg9.size, arg9.data()));
+                  cl::setKernelArg(data_, argPos++, arg9.size, arg9.data()));
     if(arg9.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg9.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg9.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg10.size, arg10.data()));
+                  cl::setKernelArg(data_, argPos++, arg10.size, arg10.data()));
     if(arg10.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg10.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg10.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg11.size, arg11.data()));
+                  cl::setKernelArg(data_, argPos++, arg11.size, arg11.data()));
     if(arg11.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg11.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg11.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg12.size, arg12.data()));
+                  cl::setKernelArg(data_, argPos++, arg12.size, arg12.data()));
     if(arg12.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg12.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg12.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg13.size, arg13.data()));
+                  cl::setKernelArg(data_, argPos++, arg13.size, arg13.data()));
     if(arg13.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg13.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg13.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg14.size, arg14.data()));
+                  cl::setKernelArg(data_, argPos++, arg14.size, arg14.data()));
     if(arg14.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg14.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg14.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg15.size, arg15.data()));
+                  cl::setKernelArg(data_, argPos++, arg15.size, arg15.data()));
     if(arg15.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg15.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg15.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg16.size, arg16.data()));
+                  cl::setKernelArg(data_, argPos++, arg16.size, arg16.data()));
     if(arg16.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg16.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg16.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg17.size, arg17.data()));
+                  cl::setKernelArg(data_, argPos++, arg17.size, arg17.data()));
     if(arg17.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg17.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg17.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg18.size, arg18.data()));
+                  cl::setKernelArg(data_, argPos++, arg18.size, arg18.data()));
     if(arg18.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg18.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg18.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg19.size, arg19.data()));
+                  cl::setKernelArg(data_, argPos++, arg19.size, arg19.data()));
     if(arg19.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg19.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg19.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg20.size, arg20.data()));
+                  cl::setKernelArg(data_, argPos++, arg20.size, arg20.data()));
     if(arg20.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg20.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg20.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg21.size, arg21.data()));
+                  cl::setKernelArg(data_, argPos++, arg21.size, arg21.data()));
     if(arg21.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg21.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg21.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg22.size, arg22.data()));
+                  cl::setKernelArg(data_, argPos++, arg22.size, arg22.data()));
     if(arg22.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg22.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg22.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg23.size, arg23.data()));
+                  cl::setKernelArg(data_, argPos++, arg23.size, arg23.data()));
     if(arg23.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg23.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg23.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg24.size, arg24.data()));
+                  cl::setKernelArg(data_, argPos++, arg24.size, arg24.data()));
     if(arg24.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg24.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg24.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg25.size, arg25.data()));
+                  cl::setKernelArg(data_, argPos++, arg25.size, arg25.data()));
     if(arg25.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg25.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg25.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg26.size, arg26.data()));
+                  cl::setKernelArg(data_, argPos++, arg26.size, arg26.data()));
     if(arg26.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg26.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg26.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg27.size, arg27.data()));
+                  cl::setKernelArg(data_, argPos++, arg27.size, arg27.data()));
     if(arg27.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg27.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg27.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg28.size, arg28.data()));
+                  cl::setKernelArg(data_, argPos++, arg28.size, arg28.data()));
     if(arg28.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg28.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg28.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg29.size, arg29.data()));
+                  cl::setKernelArg(data_, argPos++, arg29.size, arg29.data()));
     if(arg29.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg29.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg29.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg30.size, arg30.data()));
+                  cl::setKernelArg(data_, argPos++, arg30.size, arg30.data()));
     if(arg30.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg30.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg30.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg31.size, arg31.data()));
+                  cl::setKernelArg(data_, argPos++, arg31.size, arg31.data()));
     if(arg31.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg31.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg31.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg32.size, arg32.data()));
+                  cl::setKernelArg(data_, argPos++, arg32.size, arg32.data()));
     if(arg32.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg32.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg32.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg33.size, arg33.data()));
+                  cl::setKernelArg(data_, argPos++, arg33.size, arg33.data()));
     if(arg33.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg33.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg33.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg34.size, arg34.data()));
+                  cl::setKernelArg(data_, argPos++, arg34.size, arg34.data()));
     if(arg34.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg34.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg34.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg35.size, arg35.data()));
+                  cl::setKernelArg(data_, argPos++, arg35.size, arg35.data()));
     if(arg35.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg35.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg35.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg36.size, arg36.data()));
+                  cl::setKernelArg(data_, argPos++, arg36.size, arg36.data()));
     if(arg36.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg36.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg36.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg37.size, arg37.data()));
+                  cl::setKernelArg(data_, argPos++, arg37.size, arg37.data()));
     if(arg37.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg37.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg37.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg38.size, arg38.data()));
+                  cl::setKernelArg(data_, argPos++, arg38.size, arg38.data()));
     if(arg38.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg38.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg38.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg39.size, arg39.data()));
+                  cl::setKernelArg(data_, argPos++, arg39.size, arg39.data()));
     if(arg39.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg39.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg39.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg40.size, arg40.data()));
+                  cl::setKernelArg(data_, argPos++, arg40.size, arg40.data()));
     if(arg40.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg40.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg40.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg41.size, arg41.data()));
+                  cl::setKernelArg(data_, argPos++, arg41.size, arg41.data()));
     if(arg41.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg41.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg41.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg42.size, arg42.data()));
+                  cl::setKernelArg(data_, argPos++, arg42.size, arg42.data()));
     if(arg42.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg42.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg42.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg43.size, arg43.data()));
+                  cl::setKernelArg(data_, argPos++, arg43.size, arg43.data()));
     if(arg43.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg43.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg43.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg44.size, arg44.data()));
+                  cl::setKernelArg(data_, argPos++, arg44.size, arg44.data()));
     if(arg44.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg44.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg44.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg45.size, arg45.data()));
+                  cl::setKernelArg(data_, argPos++, arg45.size, arg45.data()));
     if(arg45.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg45.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg45.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg46.size, arg46.data()));
+                  cl::setKernelArg(data_, argPos++, arg46.size, arg46.data()));
     if(arg46.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg46.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg46.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -8170,295 +8170,295 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg5.size, arg5.data()));
+                  cl::setKernelArg(data_, argPos++, arg5.size, arg5.data()));
     if(arg5.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg5.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg5.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg6.size, arg6.data()));
+                  cl::setKernelArg(data_, argPos++, arg6.size, arg6.data()));
     if(arg6.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg6.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg6.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg7.size, arg7.data()));
+                  cl::setKernelArg(data_, argPos++, arg7.size, arg7.data()));
     if(arg7.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg7.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg7.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg8.size, arg8.data()));
+                  cl::setKernelArg(data_, argPos++, arg8.size, arg8.data()));
     if(arg8.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg8.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg8.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg9.size, arg9.data()));
+                  cl::setKernelArg(data_, argPos++, arg9.size, arg9.data()));
     if(arg9.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg9.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg9.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg10.size, arg10.data()));
+                  cl::setKernelArg(data_, argPos++, arg10.size, arg10.data()));
     if(arg10.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg10.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg10.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg11.size, arg11.data()));
+                  cl::setKernelArg(data_, argPos++, arg11.size, arg11.data()));
     if(arg11.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg11.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg11.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg12.size, arg12.data()));
+                  cl::setKernelArg(data_, argPos++, arg12.size, arg12.data()));
     if(arg12.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg12.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg12.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg13.size, arg13.data()));
+                  cl::setKernelArg(data_, argPos++, arg13.size, arg13.data()));
     if(arg13.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg13.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg13.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg14.size, arg14.data()));
+                  cl::setKernelArg(data_, argPos++, arg14.size, arg14.data()));
     if(arg14.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg14.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg14.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg15.size, arg15.data()));
+                  cl::setKernelArg(data_, argPos++, arg15.size, arg15.data()));
     if(arg15.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg15.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg15.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg16.size, arg16.data()));
+                  cl::setKernelArg(data_, argPos++, arg16.size, arg16.data()));
     if(arg16.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg16.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg16.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg17.size, arg17.data()));
+                  cl::setKernelArg(data_, argPos++, arg17.size, arg17.data()));
     if(arg17.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg17.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg17.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg18.size, arg18.data()));
+                  cl::setKernelArg(data_, argPos++, arg18.size, arg18.data()));
     if(arg18.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg18.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg18.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg19.size, arg19.data()));
+                  cl::setKernelArg(data_, argPos++, arg19.size, arg19.data()));
     if(arg19.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg19.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg19.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg20.size, arg20.data()));
+                  cl::setKernelArg(data_, argPos++, arg20.size, arg20.data()));
     if(arg20.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg20.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg20.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg21.size, arg21.data()));
+                  cl::setKernelArg(data_, argPos++, arg21.size, arg21.data()));
     if(arg21.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg21.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg21.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg22.size, arg22.data()));
+                  cl::setKernelArg(data_, argPos++, arg22.size, arg22.data()));
     if(arg22.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg22.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg22.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg23.size, arg23.data()));
+                  cl::setKernelArg(data_, argPos++, arg23.size, arg23.data()));
     if(arg23.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg23.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg23.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg24.size, arg24.data()));
+                  cl::setKernelArg(data_, argPos++, arg24.size, arg24.data()));
     if(arg24.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg24.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg24.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg25.size, arg25.data()));
+                  cl::setKernelArg(data_, argPos++, arg25.size, arg25.data()));
     if(arg25.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg25.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg25.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg26.size, arg26.data()));
+                  cl::setKernelArg(data_, argPos++, arg26.size, arg26.data()));
     if(arg26.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg26.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg26.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg27.size, arg27.data()));
+                  cl::setKernelArg(data_, argPos++, arg27.size, arg27.data()));
     if(arg27.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg27.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg27.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg28.size, arg28.data()));
+                  cl::setKernelArg(data_, argPos++, arg28.size, arg28.data()));
     if(arg28.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg28.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg28.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg29.size, arg29.data()));
+                  cl::setKernelArg(data_, argPos++, arg29.size, arg29.data()));
     if(arg29.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg29.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg29.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg30.size, arg30.data()));
+                  cl::setKernelArg(data_, argPos++, arg30.size, arg30.data()));
     if(arg30.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg30.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg30.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg31.size, arg31.data()));
+                  cl::setKernelArg(data_, argPos++, arg31.size, arg31.data()));
     if(arg31.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg31.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg31.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg32.size, arg32.data()));
+                  cl::setKernelArg(data_, argPos++, arg32.size, arg32.data()));
     if(arg32.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg32.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg32.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg33.size, arg33.data()));
+                  cl::setKernelArg(data_, argPos++, arg33.size, arg33.data()));
     if(arg33.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg33.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg33.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg34.size, arg34.data()));
+                  cl::setKernelArg(data_, argPos++, arg34.size, arg34.data()));
     if(arg34.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg34.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg34.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg35.size, arg35.data()));
+                  cl::setKernelArg(data_, argPos++, arg35.size, arg35.data()));
     if(arg35.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg35.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg35.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg36.size, arg36.data()));
+                  cl::setKernelArg(data_, argPos++, arg36.size, arg36.data()));
     if(arg36.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg36.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg36.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg37.size, arg37.data()));
+                  cl::setKernelArg(data_, argPos++, arg37.size, arg37.data()));
     if(arg37.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg37.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg37.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg38.size, arg38.data()));
+                  cl::setKernelArg(data_, argPos++, arg38.size, arg38.data()));
     if(arg38.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg38.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg38.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg39.size, arg39.data()));
+                  cl::setKernelArg(data_, argPos++, arg39.size, arg39.data()));
     if(arg39.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg39.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg39.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg40.size, arg40.data()));
+                  cl::setKernelArg(data_, argPos++, arg40.size, arg40.data()));
     if(arg40.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg40.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg40.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg41.size, arg41.data()));
+                  cl::setKernelArg(data_, argPos++, arg41.size, arg41.data()));
     if(arg41.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg41.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg41.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg42.size, arg42.data()));
+                  cl::setKernelArg(data_, argPos++, arg42.size, arg42.data()));
     if(arg42.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg42.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg42.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg43.size, arg43.data()));
+                  cl::setKernelArg(data_, argPos++, arg43.size, arg43.data()));
     if(arg43.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg43.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg43.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg44.size, arg44.data()));
+                  cl::setKernelArg(data_, argPos++, arg44.size, arg44.data()));
     if(arg44.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg44.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg44.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg45.size, arg45.data()));
+                  cl::setKernelArg(data_, argPos++, arg45.size, arg45.data()));
     if(arg45.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg45.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg45.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg46.size, arg46.data()));
+                  cl::setKernelArg(data_, argPos++, arg46.size, arg46.data()));
     if(arg46.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg46.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg46.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg47.size, arg47.data()));
+                  cl::setKernelArg(data_, argPos++, arg47.size, arg47.data()));
     if(arg47.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg47.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg47.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -8496,301 +8496,301 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg5.size, arg5.data()));
+                  cl::setKernelArg(data_, argPos++, arg5.size, arg5.data()));
     if(arg5.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg5.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg5.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg6.size, arg6.data()));
+                  cl::setKernelArg(data_, argPos++, arg6.size, arg6.data()));
     if(arg6.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg6.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg6.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg7.size, arg7.data()));
+                  cl::setKernelArg(data_, argPos++, arg7.size, arg7.data()));
     if(arg7.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg7.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg7.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg8.size, arg8.data()));
+                  cl::setKernelArg(data_, argPos++, arg8.size, arg8.data()));
     if(arg8.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg8.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg8.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg9.size, arg9.data()));
+                  cl::setKernelArg(data_, argPos++, arg9.size, arg9.data()));
     if(arg9.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg9.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg9.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg10.size, arg10.data()));
+                  cl::setKernelArg(data_, argPos++, arg10.size, arg10.data()));
     if(arg10.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg10.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg10.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg11.size, arg11.data()));
+                  cl::setKernelArg(data_, argPos++, arg11.size, arg11.data()));
     if(arg11.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg11.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg11.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg12.size, arg12.data()));
+                  cl::setKernelArg(data_, argPos++, arg12.size, arg12.data()));
     if(arg12.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg12.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg12.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg13.size, arg13.data()));
+                  cl::setKernelArg(data_, argPos++, arg13.size, arg13.data()));
     if(arg13.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg13.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg13.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg14.size, arg14.data()));
+                  cl::setKernelArg(data_, argPos++, arg14.size, arg14.data()));
     if(arg14.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg14.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg14.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg15.size, arg15.data()));
+                  cl::setKernelArg(data_, argPos++, arg15.size, arg15.data()));
     if(arg15.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg15.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg15.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg16.size, arg16.data()));
+                  cl::setKernelArg(data_, argPos++, arg16.size, arg16.data()));
     if(arg16.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg16.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg16.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg17.size, arg17.data()));
+                  cl::setKernelArg(data_, argPos++, arg17.size, arg17.data()));
     if(arg17.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg17.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg17.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg18.size, arg18.data()));
+                  cl::setKernelArg(data_, argPos++, arg18.size, arg18.data()));
     if(arg18.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg18.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg18.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg19.size, arg19.data()));
+                  cl::setKernelArg(data_, argPos++, arg19.size, arg19.data()));
     if(arg19.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg19.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg19.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg20.size, arg20.data()));
+                  cl::setKernelArg(data_, argPos++, arg20.size, arg20.data()));
     if(arg20.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg20.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg20.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg21.size, arg21.data()));
+                  cl::setKernelArg(data_, argPos++, arg21.size, arg21.data()));
     if(arg21.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg21.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg21.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg22.size, arg22.data()));
+                  cl::setKernelArg(data_, argPos++, arg22.size, arg22.data()));
     if(arg22.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg22.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg22.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg23.size, arg23.data()));
+                  cl::setKernelArg(data_, argPos++, arg23.size, arg23.data()));
     if(arg23.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg23.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg23.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg24.size, arg24.data()));
+                  cl::setKernelArg(data_, argPos++, arg24.size, arg24.data()));
     if(arg24.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg24.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg24.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg25.size, arg25.data()));
+                  cl::setKernelArg(data_, argPos++, arg25.size, arg25.data()));
     if(arg25.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg25.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg25.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg26.size, arg26.data()));
+                  cl::setKernelArg(data_, argPos++, arg26.size, arg26.data()));
     if(arg26.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg26.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg26.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg27.size, arg27.data()));
+                  cl::setKernelArg(data_, argPos++, arg27.size, arg27.data()));
     if(arg27.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg27.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg27.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg28.size, arg28.data()));
+                  cl::setKernelArg(data_, argPos++, arg28.size, arg28.data()));
     if(arg28.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg28.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg28.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg29.size, arg29.data()));
+                  cl::setKernelArg(data_, argPos++, arg29.size, arg29.data()));
     if(arg29.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg29.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg29.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg30.size, arg30.data()));
+                  cl::setKernelArg(data_, argPos++, arg30.size, arg30.data()));
     if(arg30.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg30.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg30.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg31.size, arg31.data()));
+                  cl::setKernelArg(data_, argPos++, arg31.size, arg31.data()));
     if(arg31.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg31.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg31.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg32.size, arg32.data()));
+                  cl::setKernelArg(data_, argPos++, arg32.size, arg32.data()));
     if(arg32.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg32.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg32.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg33.size, arg33.data()));
+                  cl::setKernelArg(data_, argPos++, arg33.size, arg33.data()));
     if(arg33.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg33.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg33.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg34.size, arg34.data()));
+                  cl::setKernelArg(data_, argPos++, arg34.size, arg34.data()));
     if(arg34.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg34.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg34.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg35.size, arg35.data()));
+                  cl::setKernelArg(data_, argPos++, arg35.size, arg35.data()));
     if(arg35.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg35.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg35.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg36.size, arg36.data()));
+                  cl::setKernelArg(data_, argPos++, arg36.size, arg36.data()));
     if(arg36.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg36.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg36.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg37.size, arg37.data()));
+                  cl::setKernelArg(data_, argPos++, arg37.size, arg37.data()));
     if(arg37.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg37.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg37.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg38.size, arg38.data()));
+                  cl::setKernelArg(data_, argPos++, arg38.size, arg38.data()));
     if(arg38.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg38.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg38.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg39.size, arg39.data()));
+                  cl::setKernelArg(data_, argPos++, arg39.size, arg39.data()));
     if(arg39.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg39.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg39.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg40.size, arg40.data()));
+                  cl::setKernelArg(data_, argPos++, arg40.size, arg40.data()));
     if(arg40.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg40.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg40.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg41.size, arg41.data()));
+                  cl::setKernelArg(data_, argPos++, arg41.size, arg41.data()));
     if(arg41.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg41.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg41.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg42.size, arg42.data()));
+                  cl::setKernelArg(data_, argPos++, arg42.size, arg42.data()));
     if(arg42.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg42.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg42.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg43.size, arg43.data()));
+                  cl::setKernelArg(data_, argPos++, arg43.size, arg43.data()));
     if(arg43.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg43.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg43.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg44.size, arg44.data()));
+                  cl::setKernelArg(data_, argPos++, arg44.size, arg44.data()));
     if(arg44.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg44.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg44.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg45.size, arg45.data()));
+                  cl::setKernelArg(data_, argPos++, arg45.size, arg45.data()));
     if(arg45.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg45.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg45.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg46.size, arg46.data()));
+                  cl::setKernelArg(data_, argPos++, arg46.size, arg46.data()));
     if(arg46.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg46.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg46.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg47.size, arg47.data()));
+                  cl::setKernelArg(data_, argPos++, arg47.size, arg47.data()));
     if(arg47.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg47.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg47.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg48.size, arg48.data()));
+                  cl::setKernelArg(data_, argPos++, arg48.size, arg48.data()));
     if(arg48.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg48.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg48.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
@@ -8828,307 +8828,307 @@
     int argPos = 0;
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [0]",
-                  clSetKernelArg(kernel_, argPos++, sizeof(void*), NULL));
+                  cl::setKernelArg(data_, argPos++, sizeof(void*), NULL));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg0.size, arg0.data()));
+                  cl::setKernelArg(data_, argPos++, arg0.size, arg0.data()));
     if(arg0.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg0.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg0.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg1.size, arg1.data()));
+                  cl::setKernelArg(data_, argPos++, arg1.size, arg1.data()));
     if(arg1.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg1.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg1.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg2.size, arg2.data()));
+                  cl::setKernelArg(data_, argPos++, arg2.size, arg2.data()));
     if(arg2.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg2.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg2.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg3.size, arg3.data()));
+                  cl::setKernelArg(data_, argPos++, arg3.size, arg3.data()));
     if(arg3.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg3.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg3.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg4.size, arg4.data()));
+                  cl::setKernelArg(data_, argPos++, arg4.size, arg4.data()));
     if(arg4.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg4.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg4.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg5.size, arg5.data()));
+                  cl::setKernelArg(data_, argPos++, arg5.size, arg5.data()));
     if(arg5.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg5.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg5.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg6.size, arg6.data()));
+                  cl::setKernelArg(data_, argPos++, arg6.size, arg6.data()));
     if(arg6.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg6.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg6.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg7.size, arg7.data()));
+                  cl::setKernelArg(data_, argPos++, arg7.size, arg7.data()));
     if(arg7.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg7.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg7.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg8.size, arg8.data()));
+                  cl::setKernelArg(data_, argPos++, arg8.size, arg8.data()));
     if(arg8.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg8.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg8.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg9.size, arg9.data()));
+                  cl::setKernelArg(data_, argPos++, arg9.size, arg9.data()));
     if(arg9.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg9.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg9.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg10.size, arg10.data()));
+                  cl::setKernelArg(data_, argPos++, arg10.size, arg10.data()));
     if(arg10.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg10.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg10.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg11.size, arg11.data()));
+                  cl::setKernelArg(data_, argPos++, arg11.size, arg11.data()));
     if(arg11.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg11.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg11.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg12.size, arg12.data()));
+                  cl::setKernelArg(data_, argPos++, arg12.size, arg12.data()));
     if(arg12.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg12.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg12.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg13.size, arg13.data()));
+                  cl::setKernelArg(data_, argPos++, arg13.size, arg13.data()));
     if(arg13.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg13.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg13.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg14.size, arg14.data()));
+                  cl::setKernelArg(data_, argPos++, arg14.size, arg14.data()));
     if(arg14.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg14.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg14.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg15.size, arg15.data()));
+                  cl::setKernelArg(data_, argPos++, arg15.size, arg15.data()));
     if(arg15.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg15.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg15.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg16.size, arg16.data()));
+                  cl::setKernelArg(data_, argPos++, arg16.size, arg16.data()));
     if(arg16.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg16.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg16.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg17.size, arg17.data()));
+                  cl::setKernelArg(data_, argPos++, arg17.size, arg17.data()));
     if(arg17.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg17.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg17.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg18.size, arg18.data()));
+                  cl::setKernelArg(data_, argPos++, arg18.size, arg18.data()));
     if(arg18.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg18.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg18.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg19.size, arg19.data()));
+                  cl::setKernelArg(data_, argPos++, arg19.size, arg19.data()));
     if(arg19.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg19.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg19.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg20.size, arg20.data()));
+                  cl::setKernelArg(data_, argPos++, arg20.size, arg20.data()));
     if(arg20.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg20.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg20.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg21.size, arg21.data()));
+                  cl::setKernelArg(data_, argPos++, arg21.size, arg21.data()));
     if(arg21.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg21.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg21.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg22.size, arg22.data()));
+                  cl::setKernelArg(data_, argPos++, arg22.size, arg22.data()));
     if(arg22.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg22.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg22.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg23.size, arg23.data()));
+                  cl::setKernelArg(data_, argPos++, arg23.size, arg23.data()));
     if(arg23.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg23.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg23.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg24.size, arg24.data()));
+                  cl::setKernelArg(data_, argPos++, arg24.size, arg24.data()));
     if(arg24.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg24.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg24.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg25.size, arg25.data()));
+                  cl::setKernelArg(data_, argPos++, arg25.size, arg25.data()));
     if(arg25.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg25.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg25.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg26.size, arg26.data()));
+                  cl::setKernelArg(data_, argPos++, arg26.size, arg26.data()));
     if(arg26.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg26.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg26.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg27.size, arg27.data()));
+                  cl::setKernelArg(data_, argPos++, arg27.size, arg27.data()));
     if(arg27.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg27.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg27.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg28.size, arg28.data()));
+                  cl::setKernelArg(data_, argPos++, arg28.size, arg28.data()));
     if(arg28.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg28.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg28.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg29.size, arg29.data()));
+                  cl::setKernelArg(data_, argPos++, arg29.size, arg29.data()));
     if(arg29.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg29.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg29.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg30.size, arg30.data()));
+                  cl::setKernelArg(data_, argPos++, arg30.size, arg30.data()));
     if(arg30.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg30.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg30.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg31.size, arg31.data()));
+                  cl::setKernelArg(data_, argPos++, arg31.size, arg31.data()));
     if(arg31.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg31.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg31.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg32.size, arg32.data()));
+                  cl::setKernelArg(data_, argPos++, arg32.size, arg32.data()));
     if(arg32.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg32.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg32.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg33.size, arg33.data()));
+                  cl::setKernelArg(data_, argPos++, arg33.size, arg33.data()));
     if(arg33.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg33.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg33.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg34.size, arg34.data()));
+                  cl::setKernelArg(data_, argPos++, arg34.size, arg34.data()));
     if(arg34.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg34.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg34.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg35.size, arg35.data()));
+                  cl::setKernelArg(data_, argPos++, arg35.size, arg35.data()));
     if(arg35.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg35.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg35.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg36.size, arg36.data()));
+                  cl::setKernelArg(data_, argPos++, arg36.size, arg36.data()));
     if(arg36.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg36.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg36.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg37.size, arg37.data()));
+                  cl::setKernelArg(data_, argPos++, arg37.size, arg37.data()));
     if(arg37.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg37.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg37.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg38.size, arg38.data()));
+                  cl::setKernelArg(data_, argPos++, arg38.size, arg38.data()));
     if(arg38.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg38.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg38.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg39.size, arg39.data()));
+                  cl::setKernelArg(data_, argPos++, arg39.size, arg39.data()));
     if(arg39.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg39.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg39.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg40.size, arg40.data()));
+                  cl::setKernelArg(data_, argPos++, arg40.size, arg40.data()));
     if(arg40.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg40.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg40.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg41.size, arg41.data()));
+                  cl::setKernelArg(data_, argPos++, arg41.size, arg41.data()));
     if(arg41.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg41.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg41.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg42.size, arg42.data()));
+                  cl::setKernelArg(data_, argPos++, arg42.size, arg42.data()));
     if(arg42.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg42.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg42.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg43.size, arg43.data()));
+                  cl::setKernelArg(data_, argPos++, arg43.size, arg43.data()));
     if(arg43.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg43.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg43.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg44.size, arg44.data()));
+                  cl::setKernelArg(data_, argPos++, arg44.size, arg44.data()));
     if(arg44.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg44.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg44.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg45.size, arg45.data()));
+                  cl::setKernelArg(data_, argPos++, arg45.size, arg45.data()));
     if(arg45.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg45.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg45.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg46.size, arg46.data()));
+                  cl::setKernelArg(data_, argPos++, arg46.size, arg46.data()));
     if(arg46.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg46.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg46.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg47.size, arg47.data()));
+                  cl::setKernelArg(data_, argPos++, arg47.size, arg47.data()));
     if(arg47.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg47.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg47.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg48.size, arg48.data()));
+                  cl::setKernelArg(data_, argPos++, arg48.size, arg48.data()));
     if(arg48.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg48.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg48.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Kernel Argument [" << argPos << "]",
-                  clSetKernelArg(kernel_, argPos++, arg49.size, arg49.data()));
+                  cl::setKernelArg(data_, argPos++, arg49.size, arg49.data()));
     if(arg49.hasTwoArgs)
       OCCA_CL_CHECK("Kernel (" + functionName + ") : Setting Texture Kernel Argument for [" << (argPos - 1) << "]",
-                    clSetKernelArg(kernel_, argPos++, sizeof(void*), arg49.arg2.void_));
+                    cl::setKernelArg(data_, argPos++, sizeof(void*), arg49.arg2.void_));
 
     OCCA_CL_CHECK("Kernel (" + functionName + ") : Kernel Run",
                   clEnqueueNDRangeKernel(*((cl_command_queue*) dev->currentStream),
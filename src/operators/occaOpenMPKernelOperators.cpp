@@ -7,9 +7,19 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data());
+    }
   }
 
   template <>
@@ -21,10 +31,21 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data());
+    }
   }
 
   template <>
@@ -36,11 +57,23 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data());
+    }
   }
 
   template <>
@@ -53,12 +86,25 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data());
+    }
   }
 
   template <>
@@ -71,13 +117,27 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data());
+    }
   }
 
   template <>
@@ -90,14 +150,29 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data(),
-              arg5.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data());
+    }
   }
 
   template <>
@@ -111,15 +186,31 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data(),
-              arg5.data(),
-              arg6.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data());
+    }
   }
 
   template <>
@@ -133,16 +224,33 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data(),
-              arg5.data(),
-              arg6.data(),
-              arg7.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data());
+    }
   }
 
   template <>
@@ -156,17 +264,35 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data(),
-              arg5.data(),
-              arg6.data(),
-              arg7.data(),
-              arg8.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data());
+    }
   }
 
   template <>
@@ -181,18 +307,37 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data(),
-              arg5.data(),
-              arg6.data(),
-              arg7.data(),
-              arg8.data(),
-              arg9.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data());
+    }
   }
 
   template <>
@@ -207,19 +352,39 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data(),
-              arg5.data(),
-              arg6.data(),
-              arg7.data(),
-              arg8.data(),
-              arg9.data(),
-              arg10.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data());
+    }
   }
 
   template <>
@@ -234,20 +399,41 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data(),
-              arg5.data(),
-              arg6.data(),
-              arg7.data(),
-              arg8.data(),
-              arg9.data(),
-              arg10.data(),
-              arg11.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data());
+    }
   }
 
   template <>
@@ -263,21 +449,43 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data(),
-              arg5.data(),
-              arg6.data(),
-              arg7.data(),
-              arg8.data(),
-              arg9.data(),
-              arg10.data(),
-              arg11.data(),
-              arg12.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data());
+    }
   }
 
   template <>
@@ -293,22 +501,45 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data(),
-              arg5.data(),
-              arg6.data(),
-              arg7.data(),
-              arg8.data(),
-              arg9.data(),
-              arg10.data(),
-              arg11.data(),
-              arg12.data(),
-              arg13.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data());
+    }
   }
 
   template <>
@@ -324,23 +555,47 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data(),
-              arg5.data(),
-              arg6.data(),
-              arg7.data(),
-              arg8.data(),
-              arg9.data(),
-              arg10.data(),
-              arg11.data(),
-              arg12.data(),
-              arg13.data(),
-              arg14.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data());
+    }
   }
 
   template <>
@@ -357,24 +612,49 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data(),
-              arg5.data(),
-              arg6.data(),
-              arg7.data(),
-              arg8.data(),
-              arg9.data(),
-              arg10.data(),
-              arg11.data(),
-              arg12.data(),
-              arg13.data(),
-              arg14.data(),
-              arg15.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data());
+    }
   }
 
   template <>
@@ -391,25 +671,51 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data(),
-              arg5.data(),
-              arg6.data(),
-              arg7.data(),
-              arg8.data(),
-              arg9.data(),
-              arg10.data(),
-              arg11.data(),
-              arg12.data(),
-              arg13.data(),
-              arg14.data(),
-              arg15.data(),
-              arg16.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data());
+    }
   }
 
   template <>
@@ -426,26 +732,53 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data(),
-              arg5.data(),
-              arg6.data(),
-              arg7.data(),
-              arg8.data(),
-              arg9.data(),
-              arg10.data(),
-              arg11.data(),
-              arg12.data(),
-              arg13.data(),
-              arg14.data(),
-              arg15.data(),
-              arg16.data(),
-              arg17.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data());
+    }
   }
 
   template <>
@@ -463,27 +796,55 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data(),
-              arg5.data(),
-              arg6.data(),
-              arg7.data(),
-              arg8.data(),
-              arg9.data(),
-              arg10.data(),
-              arg11.data(),
-              arg12.data(),
-              arg13.data(),
-              arg14.data(),
-              arg15.data(),
-              arg16.data(),
-              arg17.data(),
-              arg18.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data());
+    }
   }
 
   template <>
@@ -501,28 +862,57 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data(),
-              arg5.data(),
-              arg6.data(),
-              arg7.data(),
-              arg8.data(),
-              arg9.data(),
-              arg10.data(),
-              arg11.data(),
-              arg12.data(),
-              arg13.data(),
-              arg14.data(),
-              arg15.data(),
-              arg16.data(),
-              arg17.data(),
-              arg18.data(),
-              arg19.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data());
+    }
   }
 
   template <>
@@ -540,29 +930,59 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data(),
-              arg5.data(),
-              arg6.data(),
-              arg7.data(),
-              arg8.data(),
-              arg9.data(),
-              arg10.data(),
-              arg11.data(),
-              arg12.data(),
-              arg13.data(),
-              arg14.data(),
-              arg15.data(),
-              arg16.data(),
-              arg17.data(),
-              arg18.data(),
-              arg19.data(),
-              arg20.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data());
+    }
   }
 
   template <>
@@ -581,30 +1001,61 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data(),
-              arg5.data(),
-              arg6.data(),
-              arg7.data(),
-              arg8.data(),
-              arg9.data(),
-              arg10.data(),
-              arg11.data(),
-              arg12.data(),
-              arg13.data(),
-              arg14.data(),
-              arg15.data(),
-              arg16.data(),
-              arg17.data(),
-              arg18.data(),
-              arg19.data(),
-              arg20.data(),
-              arg21.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data());
+    }
   }
 
   template <>
@@ -623,31 +1074,63 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data(),
-              arg5.data(),
-              arg6.data(),
-              arg7.data(),
-              arg8.data(),
-              arg9.data(),
-              arg10.data(),
-              arg11.data(),
-              arg12.data(),
-              arg13.data(),
-              arg14.data(),
-              arg15.data(),
-              arg16.data(),
-              arg17.data(),
-              arg18.data(),
-              arg19.data(),
-              arg20.data(),
-              arg21.data(),
-              arg22.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data());
+    }
   }
 
   template <>
@@ -666,32 +1149,65 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data(),
-              arg5.data(),
-              arg6.data(),
-              arg7.data(),
-              arg8.data(),
-              arg9.data(),
-              arg10.data(),
-              arg11.data(),
-              arg12.data(),
-              arg13.data(),
-              arg14.data(),
-              arg15.data(),
-              arg16.data(),
-              arg17.data(),
-              arg18.data(),
-              arg19.data(),
-              arg20.data(),
-              arg21.data(),
-              arg22.data(),
-              arg23.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data());
+    }
   }
 
   template <>
@@ -711,33 +1227,67 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data(),
-              arg5.data(),
-              arg6.data(),
-              arg7.data(),
-              arg8.data(),
-              arg9.data(),
-              arg10.data(),
-              arg11.data(),
-              arg12.data(),
-              arg13.data(),
-              arg14.data(),
-              arg15.data(),
-              arg16.data(),
-              arg17.data(),
-              arg18.data(),
-              arg19.data(),
-              arg20.data(),
-              arg21.data(),
-              arg22.data(),
-              arg23.data(),
-              arg24.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data());
+    }
   }
 
   template <>
@@ -757,34 +1307,69 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data(),
-              arg5.data(),
-              arg6.data(),
-              arg7.data(),
-              arg8.data(),
-              arg9.data(),
-              arg10.data(),
-              arg11.data(),
-              arg12.data(),
-              arg13.data(),
-              arg14.data(),
-              arg15.data(),
-              arg16.data(),
-              arg17.data(),
-              arg18.data(),
-              arg19.data(),
-              arg20.data(),
-              arg21.data(),
-              arg22.data(),
-              arg23.data(),
-              arg24.data(),
-              arg25.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data());
+    }
   }
 
   template <>
@@ -804,35 +1389,71 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data(),
-              arg5.data(),
-              arg6.data(),
-              arg7.data(),
-              arg8.data(),
-              arg9.data(),
-              arg10.data(),
-              arg11.data(),
-              arg12.data(),
-              arg13.data(),
-              arg14.data(),
-              arg15.data(),
-              arg16.data(),
-              arg17.data(),
-              arg18.data(),
-              arg19.data(),
-              arg20.data(),
-              arg21.data(),
-              arg22.data(),
-              arg23.data(),
-              arg24.data(),
-              arg25.data(),
-              arg26.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data());
+    }
   }
 
   template <>
@@ -853,36 +1474,73 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data(),
-              arg5.data(),
-              arg6.data(),
-              arg7.data(),
-              arg8.data(),
-              arg9.data(),
-              arg10.data(),
-              arg11.data(),
-              arg12.data(),
-              arg13.data(),
-              arg14.data(),
-              arg15.data(),
-              arg16.data(),
-              arg17.data(),
-              arg18.data(),
-              arg19.data(),
-              arg20.data(),
-              arg21.data(),
-              arg22.data(),
-              arg23.data(),
-              arg24.data(),
-              arg25.data(),
-              arg26.data(),
-              arg27.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data());
+    }
   }
 
   template <>
@@ -903,37 +1561,75 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data(),
-              arg5.data(),
-              arg6.data(),
-              arg7.data(),
-              arg8.data(),
-              arg9.data(),
-              arg10.data(),
-              arg11.data(),
-              arg12.data(),
-              arg13.data(),
-              arg14.data(),
-              arg15.data(),
-              arg16.data(),
-              arg17.data(),
-              arg18.data(),
-              arg19.data(),
-              arg20.data(),
-              arg21.data(),
-              arg22.data(),
-              arg23.data(),
-              arg24.data(),
-              arg25.data(),
-              arg26.data(),
-              arg27.data(),
-              arg28.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data(),
+                arg28.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data(),
+                arg28.data());
+    }
   }
 
   template <>
@@ -954,38 +1650,77 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data(),
-              arg5.data(),
-              arg6.data(),
-              arg7.data(),
-              arg8.data(),
-              arg9.data(),
-              arg10.data(),
-              arg11.data(),
-              arg12.data(),
-              arg13.data(),
-              arg14.data(),
-              arg15.data(),
-              arg16.data(),
-              arg17.data(),
-              arg18.data(),
-              arg19.data(),
-              arg20.data(),
-              arg21.data(),
-              arg22.data(),
-              arg23.data(),
-              arg24.data(),
-              arg25.data(),
-              arg26.data(),
-              arg27.data(),
-              arg28.data(),
-              arg29.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data(),
+                arg28.data(),
+                arg29.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data(),
+                arg28.data(),
+                arg29.data());
+    }
   }
 
   template <>
@@ -1007,39 +1742,79 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data(),
-              arg5.data(),
-              arg6.data(),
-              arg7.data(),
-              arg8.data(),
-              arg9.data(),
-              arg10.data(),
-              arg11.data(),
-              arg12.data(),
-              arg13.data(),
-              arg14.data(),
-              arg15.data(),
-              arg16.data(),
-              arg17.data(),
-              arg18.data(),
-              arg19.data(),
-              arg20.data(),
-              arg21.data(),
-              arg22.data(),
-              arg23.data(),
-              arg24.data(),
-              arg25.data(),
-              arg26.data(),
-              arg27.data(),
-              arg28.data(),
-              arg29.data(),
-              arg30.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data(),
+                arg28.data(),
+                arg29.data(),
+                arg30.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data(),
+                arg28.data(),
+                arg29.data(),
+                arg30.data());
+    }
   }
 
   template <>
@@ -1061,40 +1836,81 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data(),
-              arg5.data(),
-              arg6.data(),
-              arg7.data(),
-              arg8.data(),
-              arg9.data(),
-              arg10.data(),
-              arg11.data(),
-              arg12.data(),
-              arg13.data(),
-              arg14.data(),
-              arg15.data(),
-              arg16.data(),
-              arg17.data(),
-              arg18.data(),
-              arg19.data(),
-              arg20.data(),
-              arg21.data(),
-              arg22.data(),
-              arg23.data(),
-              arg24.data(),
-              arg25.data(),
-              arg26.data(),
-              arg27.data(),
-              arg28.data(),
-              arg29.data(),
-              arg30.data(),
-              arg31.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data(),
+                arg28.data(),
+                arg29.data(),
+                arg30.data(),
+                arg31.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data(),
+                arg28.data(),
+                arg29.data(),
+                arg30.data(),
+                arg31.data());
+    }
   }
 
   template <>
@@ -1116,41 +1932,83 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data(),
-              arg5.data(),
-              arg6.data(),
-              arg7.data(),
-              arg8.data(),
-              arg9.data(),
-              arg10.data(),
-              arg11.data(),
-              arg12.data(),
-              arg13.data(),
-              arg14.data(),
-              arg15.data(),
-              arg16.data(),
-              arg17.data(),
-              arg18.data(),
-              arg19.data(),
-              arg20.data(),
-              arg21.data(),
-              arg22.data(),
-              arg23.data(),
-              arg24.data(),
-              arg25.data(),
-              arg26.data(),
-              arg27.data(),
-              arg28.data(),
-              arg29.data(),
-              arg30.data(),
-              arg31.data(),
-              arg32.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data(),
+                arg28.data(),
+                arg29.data(),
+                arg30.data(),
+                arg31.data(),
+                arg32.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data(),
+                arg28.data(),
+                arg29.data(),
+                arg30.data(),
+                arg31.data(),
+                arg32.data());
+    }
   }
 
   template <>
@@ -1173,42 +2031,85 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data(),
-              arg5.data(),
-              arg6.data(),
-              arg7.data(),
-              arg8.data(),
-              arg9.data(),
-              arg10.data(),
-              arg11.data(),
-              arg12.data(),
-              arg13.data(),
-              arg14.data(),
-              arg15.data(),
-              arg16.data(),
-              arg17.data(),
-              arg18.data(),
-              arg19.data(),
-              arg20.data(),
-              arg21.data(),
-              arg22.data(),
-              arg23.data(),
-              arg24.data(),
-              arg25.data(),
-              arg26.data(),
-              arg27.data(),
-              arg28.data(),
-              arg29.data(),
-              arg30.data(),
-              arg31.data(),
-              arg32.data(),
-              arg33.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data(),
+                arg28.data(),
+                arg29.data(),
+                arg30.data(),
+                arg31.data(),
+                arg32.data(),
+                arg33.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data(),
+                arg28.data(),
+                arg29.data(),
+                arg30.data(),
+                arg31.data(),
+                arg32.data(),
+                arg33.data());
+    }
   }
 
   template <>
@@ -1231,43 +2132,87 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data(),
-              arg5.data(),
-              arg6.data(),
-              arg7.data(),
-              arg8.data(),
-              arg9.data(),
-              arg10.data(),
-              arg11.data(),
-              arg12.data(),
-              arg13.data(),
-              arg14.data(),
-              arg15.data(),
-              arg16.data(),
-              arg17.data(),
-              arg18.data(),
-              arg19.data(),
-              arg20.data(),
-              arg21.data(),
-              arg22.data(),
-              arg23.data(),
-              arg24.data(),
-              arg25.data(),
-              arg26.data(),
-              arg27.data(),
-              arg28.data(),
-              arg29.data(),
-              arg30.data(),
-              arg31.data(),
-              arg32.data(),
-              arg33.data(),
-              arg34.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data(),
+                arg28.data(),
+                arg29.data(),
+                arg30.data(),
+                arg31.data(),
+                arg32.data(),
+                arg33.data(),
+                arg34.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data(),
+                arg28.data(),
+                arg29.data(),
+                arg30.data(),
+                arg31.data(),
+                arg32.data(),
+                arg33.data(),
+                arg34.data());
+    }
   }
 
   template <>
@@ -1290,44 +2235,89 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data(),
-              arg5.data(),
-              arg6.data(),
-              arg7.data(),
-              arg8.data(),
-              arg9.data(),
-              arg10.data(),
-              arg11.data(),
-              arg12.data(),
-              arg13.data(),
-              arg14.data(),
-              arg15.data(),
-              arg16.data(),
-              arg17.data(),
-              arg18.data(),
-              arg19.data(),
-              arg20.data(),
-              arg21.data(),
-              arg22.data(),
-              arg23.data(),
-              arg24.data(),
-              arg25.data(),
-              arg26.data(),
-              arg27.data(),
-              arg28.data(),
-              arg29.data(),
-              arg30.data(),
-              arg31.data(),
-              arg32.data(),
-              arg33.data(),
-              arg34.data(),
-              arg35.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data(),
+                arg28.data(),
+                arg29.data(),
+                arg30.data(),
+                arg31.data(),
+                arg32.data(),
+                arg33.data(),
+                arg34.data(),
+                arg35.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data(),
+                arg28.data(),
+                arg29.data(),
+                arg30.data(),
+                arg31.data(),
+                arg32.data(),
+                arg33.data(),
+                arg34.data(),
+                arg35.data());
+    }
   }
 
   template <>
@@ -1351,45 +2341,91 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data(),
-              arg5.data(),
-              arg6.data(),
-              arg7.data(),
-              arg8.data(),
-              arg9.data(),
-              arg10.data(),
-              arg11.data(),
-              arg12.data(),
-              arg13.data(),
-              arg14.data(),
-              arg15.data(),
-              arg16.data(),
-              arg17.data(),
-              arg18.data(),
-              arg19.data(),
-              arg20.data(),
-              arg21.data(),
-              arg22.data(),
-              arg23.data(),
-              arg24.data(),
-              arg25.data(),
-              arg26.data(),
-              arg27.data(),
-              arg28.data(),
-              arg29.data(),
-              arg30.data(),
-              arg31.data(),
-              arg32.data(),
-              arg33.data(),
-              arg34.data(),
-              arg35.data(),
-              arg36.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data(),
+                arg28.data(),
+                arg29.data(),
+                arg30.data(),
+                arg31.data(),
+                arg32.data(),
+                arg33.data(),
+                arg34.data(),
+                arg35.data(),
+                arg36.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data(),
+                arg28.data(),
+                arg29.data(),
+                arg30.data(),
+                arg31.data(),
+                arg32.data(),
+                arg33.data(),
+                arg34.data(),
+                arg35.data(),
+                arg36.data());
+    }
   }
 
   template <>
@@ -1413,46 +2449,93 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data(),
-              arg5.data(),
-              arg6.data(),
-              arg7.data(),
-              arg8.data(),
-              arg9.data(),
-              arg10.data(),
-              arg11.data(),
-              arg12.data(),
-              arg13.data(),
-              arg14.data(),
-              arg15.data(),
-              arg16.data(),
-              arg17.data(),
-              arg18.data(),
-              arg19.data(),
-              arg20.data(),
-              arg21.data(),
-              arg22.data(),
-              arg23.data(),
-              arg24.data(),
-              arg25.data(),
-              arg26.data(),
-              arg27.data(),
-              arg28.data(),
-              arg29.data(),
-              arg30.data(),
-              arg31.data(),
-              arg32.data(),
-              arg33.data(),
-              arg34.data(),
-              arg35.data(),
-              arg36.data(),
-              arg37.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data(),
+                arg28.data(),
+                arg29.data(),
+                arg30.data(),
+                arg31.data(),
+                arg32.data(),
+                arg33.data(),
+                arg34.data(),
+                arg35.data(),
+                arg36.data(),
+                arg37.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data(),
+                arg28.data(),
+                arg29.data(),
+                arg30.data(),
+                arg31.data(),
+                arg32.data(),
+                arg33.data(),
+                arg34.data(),
+                arg35.data(),
+                arg36.data(),
+                arg37.data());
+    }
   }
 
   template <>
@@ -1476,47 +2559,95 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data(),
-              arg5.data(),
-              arg6.data(),
-              arg7.data(),
-              arg8.data(),
-              arg9.data(),
-              arg10.data(),
-              arg11.data(),
-              arg12.data(),
-              arg13.data(),
-              arg14.data(),
-              arg15.data(),
-              arg16.data(),
-              arg17.data(),
-              arg18.data(),
-              arg19.data(),
-              arg20.data(),
-              arg21.data(),
-              arg22.data(),
-              arg23.data(),
-              arg24.data(),
-              arg25.data(),
-              arg26.data(),
-              arg27.data(),
-              arg28.data(),
-              arg29.data(),
-              arg30.data(),
-              arg31.data(),
-              arg32.data(),
-              arg33.data(),
-              arg34.data(),
-              arg35.data(),
-              arg36.data(),
-              arg37.data(),
-              arg38.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data(),
+                arg28.data(),
+                arg29.data(),
+                arg30.data(),
+                arg31.data(),
+                arg32.data(),
+                arg33.data(),
+                arg34.data(),
+                arg35.data(),
+                arg36.data(),
+                arg37.data(),
+                arg38.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data(),
+                arg28.data(),
+                arg29.data(),
+                arg30.data(),
+                arg31.data(),
+                arg32.data(),
+                arg33.data(),
+                arg34.data(),
+                arg35.data(),
+                arg36.data(),
+                arg37.data(),
+                arg38.data());
+    }
   }
 
   template <>
@@ -1541,48 +2672,97 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data(),
-              arg5.data(),
-              arg6.data(),
-              arg7.data(),
-              arg8.data(),
-              arg9.data(),
-              arg10.data(),
-              arg11.data(),
-              arg12.data(),
-              arg13.data(),
-              arg14.data(),
-              arg15.data(),
-              arg16.data(),
-              arg17.data(),
-              arg18.data(),
-              arg19.data(),
-              arg20.data(),
-              arg21.data(),
-              arg22.data(),
-              arg23.data(),
-              arg24.data(),
-              arg25.data(),
-              arg26.data(),
-              arg27.data(),
-              arg28.data(),
-              arg29.data(),
-              arg30.data(),
-              arg31.data(),
-              arg32.data(),
-              arg33.data(),
-              arg34.data(),
-              arg35.data(),
-              arg36.data(),
-              arg37.data(),
-              arg38.data(),
-              arg39.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data(),
+                arg28.data(),
+                arg29.data(),
+                arg30.data(),
+                arg31.data(),
+                arg32.data(),
+                arg33.data(),
+                arg34.data(),
+                arg35.data(),
+                arg36.data(),
+                arg37.data(),
+                arg38.data(),
+                arg39.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data(),
+                arg28.data(),
+                arg29.data(),
+                arg30.data(),
+                arg31.data(),
+                arg32.data(),
+                arg33.data(),
+                arg34.data(),
+                arg35.data(),
+                arg36.data(),
+                arg37.data(),
+                arg38.data(),
+                arg39.data());
+    }
   }
 
   template <>
@@ -1607,49 +2787,99 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data(),
-              arg5.data(),
-              arg6.data(),
-              arg7.data(),
-              arg8.data(),
-              arg9.data(),
-              arg10.data(),
-              arg11.data(),
-              arg12.data(),
-              arg13.data(),
-              arg14.data(),
-              arg15.data(),
-              arg16.data(),
-              arg17.data(),
-              arg18.data(),
-              arg19.data(),
-              arg20.data(),
-              arg21.data(),
-              arg22.data(),
-              arg23.data(),
-              arg24.data(),
-              arg25.data(),
-              arg26.data(),
-              arg27.data(),
-              arg28.data(),
-              arg29.data(),
-              arg30.data(),
-              arg31.data(),
-              arg32.data(),
-              arg33.data(),
-              arg34.data(),
-              arg35.data(),
-              arg36.data(),
-              arg37.data(),
-              arg38.data(),
-              arg39.data(),
-              arg40.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data(),
+                arg28.data(),
+                arg29.data(),
+                arg30.data(),
+                arg31.data(),
+                arg32.data(),
+                arg33.data(),
+                arg34.data(),
+                arg35.data(),
+                arg36.data(),
+                arg37.data(),
+                arg38.data(),
+                arg39.data(),
+                arg40.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data(),
+                arg28.data(),
+                arg29.data(),
+                arg30.data(),
+                arg31.data(),
+                arg32.data(),
+                arg33.data(),
+                arg34.data(),
+                arg35.data(),
+                arg36.data(),
+                arg37.data(),
+                arg38.data(),
+                arg39.data(),
+                arg40.data());
+    }
   }
 
   template <>
@@ -1674,50 +2904,101 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data(),
-              arg5.data(),
-              arg6.data(),
-              arg7.data(),
-              arg8.data(),
-              arg9.data(),
-              arg10.data(),
-              arg11.data(),
-              arg12.data(),
-              arg13.data(),
-              arg14.data(),
-              arg15.data(),
-              arg16.data(),
-              arg17.data(),
-              arg18.data(),
-              arg19.data(),
-              arg20.data(),
-              arg21.data(),
-              arg22.data(),
-              arg23.data(),
-              arg24.data(),
-              arg25.data(),
-              arg26.data(),
-              arg27.data(),
-              arg28.data(),
-              arg29.data(),
-              arg30.data(),
-              arg31.data(),
-              arg32.data(),
-              arg33.data(),
-              arg34.data(),
-              arg35.data(),
-              arg36.data(),
-              arg37.data(),
-              arg38.data(),
-              arg39.data(),
-              arg40.data(),
-              arg41.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data(),
+                arg28.data(),
+                arg29.data(),
+                arg30.data(),
+                arg31.data(),
+                arg32.data(),
+                arg33.data(),
+                arg34.data(),
+                arg35.data(),
+                arg36.data(),
+                arg37.data(),
+                arg38.data(),
+                arg39.data(),
+                arg40.data(),
+                arg41.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data(),
+                arg28.data(),
+                arg29.data(),
+                arg30.data(),
+                arg31.data(),
+                arg32.data(),
+                arg33.data(),
+                arg34.data(),
+                arg35.data(),
+                arg36.data(),
+                arg37.data(),
+                arg38.data(),
+                arg39.data(),
+                arg40.data(),
+                arg41.data());
+    }
   }
 
   template <>
@@ -1743,51 +3024,103 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data(),
-              arg5.data(),
-              arg6.data(),
-              arg7.data(),
-              arg8.data(),
-              arg9.data(),
-              arg10.data(),
-              arg11.data(),
-              arg12.data(),
-              arg13.data(),
-              arg14.data(),
-              arg15.data(),
-              arg16.data(),
-              arg17.data(),
-              arg18.data(),
-              arg19.data(),
-              arg20.data(),
-              arg21.data(),
-              arg22.data(),
-              arg23.data(),
-              arg24.data(),
-              arg25.data(),
-              arg26.data(),
-              arg27.data(),
-              arg28.data(),
-              arg29.data(),
-              arg30.data(),
-              arg31.data(),
-              arg32.data(),
-              arg33.data(),
-              arg34.data(),
-              arg35.data(),
-              arg36.data(),
-              arg37.data(),
-              arg38.data(),
-              arg39.data(),
-              arg40.data(),
-              arg41.data(),
-              arg42.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data(),
+                arg28.data(),
+                arg29.data(),
+                arg30.data(),
+                arg31.data(),
+                arg32.data(),
+                arg33.data(),
+                arg34.data(),
+                arg35.data(),
+                arg36.data(),
+                arg37.data(),
+                arg38.data(),
+                arg39.data(),
+                arg40.data(),
+                arg41.data(),
+                arg42.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data(),
+                arg28.data(),
+                arg29.data(),
+                arg30.data(),
+                arg31.data(),
+                arg32.data(),
+                arg33.data(),
+                arg34.data(),
+                arg35.data(),
+                arg36.data(),
+                arg37.data(),
+                arg38.data(),
+                arg39.data(),
+                arg40.data(),
+                arg41.data(),
+                arg42.data());
+    }
   }
 
   template <>
@@ -1813,52 +3146,105 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data(),
-              arg5.data(),
-              arg6.data(),
-              arg7.data(),
-              arg8.data(),
-              arg9.data(),
-              arg10.data(),
-              arg11.data(),
-              arg12.data(),
-              arg13.data(),
-              arg14.data(),
-              arg15.data(),
-              arg16.data(),
-              arg17.data(),
-              arg18.data(),
-              arg19.data(),
-              arg20.data(),
-              arg21.data(),
-              arg22.data(),
-              arg23.data(),
-              arg24.data(),
-              arg25.data(),
-              arg26.data(),
-              arg27.data(),
-              arg28.data(),
-              arg29.data(),
-              arg30.data(),
-              arg31.data(),
-              arg32.data(),
-              arg33.data(),
-              arg34.data(),
-              arg35.data(),
-              arg36.data(),
-              arg37.data(),
-              arg38.data(),
-              arg39.data(),
-              arg40.data(),
-              arg41.data(),
-              arg42.data(),
-              arg43.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data(),
+                arg28.data(),
+                arg29.data(),
+                arg30.data(),
+                arg31.data(),
+                arg32.data(),
+                arg33.data(),
+                arg34.data(),
+                arg35.data(),
+                arg36.data(),
+                arg37.data(),
+                arg38.data(),
+                arg39.data(),
+                arg40.data(),
+                arg41.data(),
+                arg42.data(),
+                arg43.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data(),
+                arg28.data(),
+                arg29.data(),
+                arg30.data(),
+                arg31.data(),
+                arg32.data(),
+                arg33.data(),
+                arg34.data(),
+                arg35.data(),
+                arg36.data(),
+                arg37.data(),
+                arg38.data(),
+                arg39.data(),
+                arg40.data(),
+                arg41.data(),
+                arg42.data(),
+                arg43.data());
+    }
   }
 
   template <>
@@ -1884,53 +3270,107 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data(),
-              arg5.data(),
-              arg6.data(),
-              arg7.data(),
-              arg8.data(),
-              arg9.data(),
-              arg10.data(),
-              arg11.data(),
-              arg12.data(),
-              arg13.data(),
-              arg14.data(),
-              arg15.data(),
-              arg16.data(),
-              arg17.data(),
-              arg18.data(),
-              arg19.data(),
-              arg20.data(),
-              arg21.data(),
-              arg22.data(),
-              arg23.data(),
-              arg24.data(),
-              arg25.data(),
-              arg26.data(),
-              arg27.data(),
-              arg28.data(),
-              arg29.data(),
-              arg30.data(),
-              arg31.data(),
-              arg32.data(),
-              arg33.data(),
-              arg34.data(),
-              arg35.data(),
-              arg36.data(),
-              arg37.data(),
-              arg38.data(),
-              arg39.data(),
-              arg40.data(),
-              arg41.data(),
-              arg42.data(),
-              arg43.data(),
-              arg44.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data(),
+                arg28.data(),
+                arg29.data(),
+                arg30.data(),
+                arg31.data(),
+                arg32.data(),
+                arg33.data(),
+                arg34.data(),
+                arg35.data(),
+                arg36.data(),
+                arg37.data(),
+                arg38.data(),
+                arg39.data(),
+                arg40.data(),
+                arg41.data(),
+                arg42.data(),
+                arg43.data(),
+                arg44.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data(),
+                arg28.data(),
+                arg29.data(),
+                arg30.data(),
+                arg31.data(),
+                arg32.data(),
+                arg33.data(),
+                arg34.data(),
+                arg35.data(),
+                arg36.data(),
+                arg37.data(),
+                arg38.data(),
+                arg39.data(),
+                arg40.data(),
+                arg41.data(),
+                arg42.data(),
+                arg43.data(),
+                arg44.data());
+    }
   }
 
   template <>
@@ -1957,54 +3397,109 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data(),
-              arg5.data(),
-              arg6.data(),
-              arg7.data(),
-              arg8.data(),
-              arg9.data(),
-              arg10.data(),
-              arg11.data(),
-              arg12.data(),
-              arg13.data(),
-              arg14.data(),
-              arg15.data(),
-              arg16.data(),
-              arg17.data(),
-              arg18.data(),
-              arg19.data(),
-              arg20.data(),
-              arg21.data(),
-              arg22.data(),
-              arg23.data(),
-              arg24.data(),
-              arg25.data(),
-              arg26.data(),
-              arg27.data(),
-              arg28.data(),
-              arg29.data(),
-              arg30.data(),
-              arg31.data(),
-              arg32.data(),
-              arg33.data(),
-              arg34.data(),
-              arg35.data(),
-              arg36.data(),
-              arg37.data(),
-              arg38.data(),
-              arg39.data(),
-              arg40.data(),
-              arg41.data(),
-              arg42.data(),
-              arg43.data(),
-              arg44.data(),
-              arg45.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data(),
+                arg28.data(),
+                arg29.data(),
+                arg30.data(),
+                arg31.data(),
+                arg32.data(),
+                arg33.data(),
+                arg34.data(),
+                arg35.data(),
+                arg36.data(),
+                arg37.data(),
+                arg38.data(),
+                arg39.data(),
+                arg40.data(),
+                arg41.data(),
+                arg42.data(),
+                arg43.data(),
+                arg44.data(),
+                arg45.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data(),
+                arg28.data(),
+                arg29.data(),
+                arg30.data(),
+                arg31.data(),
+                arg32.data(),
+                arg33.data(),
+                arg34.data(),
+                arg35.data(),
+                arg36.data(),
+                arg37.data(),
+                arg38.data(),
+                arg39.data(),
+                arg40.data(),
+                arg41.data(),
+                arg42.data(),
+                arg43.data(),
+                arg44.data(),
+                arg45.data());
+    }
   }
 
   template <>
@@ -2031,55 +3526,111 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data(),
-              arg5.data(),
-              arg6.data(),
-              arg7.data(),
-              arg8.data(),
-              arg9.data(),
-              arg10.data(),
-              arg11.data(),
-              arg12.data(),
-              arg13.data(),
-              arg14.data(),
-              arg15.data(),
-              arg16.data(),
-              arg17.data(),
-              arg18.data(),
-              arg19.data(),
-              arg20.data(),
-              arg21.data(),
-              arg22.data(),
-              arg23.data(),
-              arg24.data(),
-              arg25.data(),
-              arg26.data(),
-              arg27.data(),
-              arg28.data(),
-              arg29.data(),
-              arg30.data(),
-              arg31.data(),
-              arg32.data(),
-              arg33.data(),
-              arg34.data(),
-              arg35.data(),
-              arg36.data(),
-              arg37.data(),
-              arg38.data(),
-              arg39.data(),
-              arg40.data(),
-              arg41.data(),
-              arg42.data(),
-              arg43.data(),
-              arg44.data(),
-              arg45.data(),
-              arg46.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data(),
+                arg28.data(),
+                arg29.data(),
+                arg30.data(),
+                arg31.data(),
+                arg32.data(),
+                arg33.data(),
+                arg34.data(),
+                arg35.data(),
+                arg36.data(),
+                arg37.data(),
+                arg38.data(),
+                arg39.data(),
+                arg40.data(),
+                arg41.data(),
+                arg42.data(),
+                arg43.data(),
+                arg44.data(),
+                arg45.data(),
+                arg46.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data(),
+                arg28.data(),
+                arg29.data(),
+                arg30.data(),
+                arg31.data(),
+                arg32.data(),
+                arg33.data(),
+                arg34.data(),
+                arg35.data(),
+                arg36.data(),
+                arg37.data(),
+                arg38.data(),
+                arg39.data(),
+                arg40.data(),
+                arg41.data(),
+                arg42.data(),
+                arg43.data(),
+                arg44.data(),
+                arg45.data(),
+                arg46.data());
+    }
   }
 
   template <>
@@ -2106,56 +3657,113 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data(),
-              arg5.data(),
-              arg6.data(),
-              arg7.data(),
-              arg8.data(),
-              arg9.data(),
-              arg10.data(),
-              arg11.data(),
-              arg12.data(),
-              arg13.data(),
-              arg14.data(),
-              arg15.data(),
-              arg16.data(),
-              arg17.data(),
-              arg18.data(),
-              arg19.data(),
-              arg20.data(),
-              arg21.data(),
-              arg22.data(),
-              arg23.data(),
-              arg24.data(),
-              arg25.data(),
-              arg26.data(),
-              arg27.data(),
-              arg28.data(),
-              arg29.data(),
-              arg30.data(),
-              arg31.data(),
-              arg32.data(),
-              arg33.data(),
-              arg34.data(),
-              arg35.data(),
-              arg36.data(),
-              arg37.data(),
-              arg38.data(),
-              arg39.data(),
-              arg40.data(),
-              arg41.data(),
-              arg42.data(),
-              arg43.data(),
-              arg44.data(),
-              arg45.data(),
-              arg46.data(),
-              arg47.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data(),
+                arg28.data(),
+                arg29.data(),
+                arg30.data(),
+                arg31.data(),
+                arg32.data(),
+                arg33.data(),
+                arg34.data(),
+                arg35.data(),
+                arg36.data(),
+                arg37.data(),
+                arg38.data(),
+                arg39.data(),
+                arg40.data(),
+                arg41.data(),
+                arg42.data(),
+                arg43.data(),
+                arg44.data(),
+                arg45.data(),
+                arg46.data(),
+                arg47.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data(),
+                arg28.data(),
+                arg29.data(),
+                arg30.data(),
+                arg31.data(),
+                arg32.data(),
+                arg33.data(),
+                arg34.data(),
+                arg35.data(),
+                arg36.data(),
+                arg37.data(),
+                arg38.data(),
+                arg39.data(),
+                arg40.data(),
+                arg41.data(),
+                arg42.data(),
+                arg43.data(),
+                arg44.data(),
+                arg45.data(),
+                arg46.data(),
+                arg47.data());
+    }
   }
 
   template <>
@@ -2183,57 +3791,115 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data(),
-              arg5.data(),
-              arg6.data(),
-              arg7.data(),
-              arg8.data(),
-              arg9.data(),
-              arg10.data(),
-              arg11.data(),
-              arg12.data(),
-              arg13.data(),
-              arg14.data(),
-              arg15.data(),
-              arg16.data(),
-              arg17.data(),
-              arg18.data(),
-              arg19.data(),
-              arg20.data(),
-              arg21.data(),
-              arg22.data(),
-              arg23.data(),
-              arg24.data(),
-              arg25.data(),
-              arg26.data(),
-              arg27.data(),
-              arg28.data(),
-              arg29.data(),
-              arg30.data(),
-              arg31.data(),
-              arg32.data(),
-              arg33.data(),
-              arg34.data(),
-              arg35.data(),
-              arg36.data(),
-              arg37.data(),
-              arg38.data(),
-              arg39.data(),
-              arg40.data(),
-              arg41.data(),
-              arg42.data(),
-              arg43.data(),
-              arg44.data(),
-              arg45.data(),
-              arg46.data(),
-              arg47.data(),
-              arg48.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data(),
+                arg28.data(),
+                arg29.data(),
+                arg30.data(),
+                arg31.data(),
+                arg32.data(),
+                arg33.data(),
+                arg34.data(),
+                arg35.data(),
+                arg36.data(),
+                arg37.data(),
+                arg38.data(),
+                arg39.data(),
+                arg40.data(),
+                arg41.data(),
+                arg42.data(),
+                arg43.data(),
+                arg44.data(),
+                arg45.data(),
+                arg46.data(),
+                arg47.data(),
+                arg48.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data(),
+                arg28.data(),
+                arg29.data(),
+                arg30.data(),
+                arg31.data(),
+                arg32.data(),
+                arg33.data(),
+                arg34.data(),
+                arg35.data(),
+                arg36.data(),
+                arg37.data(),
+                arg38.data(),
+                arg39.data(),
+                arg40.data(),
+                arg41.data(),
+                arg42.data(),
+                arg43.data(),
+                arg44.data(),
+                arg45.data(),
+                arg46.data(),
+                arg47.data(),
+                arg48.data());
+    }
   }
 
   template <>
@@ -2261,56 +3927,115 @@
 
     int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
 
-    tmpKernel(occaKernelArgs,
-              occaInnerId0, occaInnerId1, occaInnerId2,
-              arg0.data(),
-              arg1.data(),
-              arg2.data(),
-              arg3.data(),
-              arg4.data(),
-              arg5.data(),
-              arg6.data(),
-              arg7.data(),
-              arg8.data(),
-              arg9.data(),
-              arg10.data(),
-              arg11.data(),
-              arg12.data(),
-              arg13.data(),
-              arg14.data(),
-              arg15.data(),
-              arg16.data(),
-              arg17.data(),
-              arg18.data(),
-              arg19.data(),
-              arg20.data(),
-              arg21.data(),
-              arg22.data(),
-              arg23.data(),
-              arg24.data(),
-              arg25.data(),
-              arg26.data(),
-              arg27.data(),
-              arg28.data(),
-              arg29.data(),
-              arg30.data(),
-              arg31.data(),
-              arg32.data(),
-              arg33.data(),
-              arg34.data(),
-              arg35.data(),
-              arg36.data(),
-              arg37.data(),
-              arg38.data(),
-              arg39.data(),
-              arg40.data(),
-              arg41.data(),
-              arg42.data(),
-              arg43.data(),
-              arg44.data(),
-              arg45.data(),
-              arg46.data(),
-              arg47.data(),
-              arg48.data(),
-              arg49.data());
+    openMPTeamScope teamScope(data_.team);
+
+    if(openMPLaunchOpensTeam(data_)){
+#pragma omp parallel
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data(),
+                arg28.data(),
+                arg29.data(),
+                arg30.data(),
+                arg31.data(),
+                arg32.data(),
+                arg33.data(),
+                arg34.data(),
+                arg35.data(),
+                arg36.data(),
+                arg37.data(),
+                arg38.data(),
+                arg39.data(),
+                arg40.data(),
+                arg41.data(),
+                arg42.data(),
+                arg43.data(),
+                arg44.data(),
+                arg45.data(),
+                arg46.data(),
+                arg47.data(),
+                arg48.data(),
+                arg49.data());
+    }
+    else{
+      tmpKernel(occaKernelArgs,
+                occaInnerId0, occaInnerId1, occaInnerId2,
+                arg0.data(),
+                arg1.data(),
+                arg2.data(),
+                arg3.data(),
+                arg4.data(),
+                arg5.data(),
+                arg6.data(),
+                arg7.data(),
+                arg8.data(),
+                arg9.data(),
+                arg10.data(),
+                arg11.data(),
+                arg12.data(),
+                arg13.data(),
+                arg14.data(),
+                arg15.data(),
+                arg16.data(),
+                arg17.data(),
+                arg18.data(),
+                arg19.data(),
+                arg20.data(),
+                arg21.data(),
+                arg22.data(),
+                arg23.data(),
+                arg24.data(),
+                arg25.data(),
+                arg26.data(),
+                arg27.data(),
+                arg28.data(),
+                arg29.data(),
+                arg30.data(),
+                arg31.data(),
+                arg32.data(),
+                arg33.data(),
+                arg34.data(),
+                arg35.data(),
+                arg36.data(),
+                arg37.data(),
+                arg38.data(),
+                arg39.data(),
+                arg40.data(),
+                arg41.data(),
+                arg42.data(),
+                arg43.data(),
+                arg44.data(),
+                arg45.data(),
+                arg46.data(),
+                arg47.data(),
+                arg48.data(),
+                arg49.data());
+    }
   }
\ No newline at end of file
@@ -3,6 +3,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -16,12 +19,21 @@
 
       args->args[0] = arg0;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel1);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel1);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -67,6 +79,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -81,12 +96,21 @@
       args->args[0] = arg0;
     args->args[1] = arg1;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel2);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel2);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -133,6 +157,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -148,12 +175,21 @@
     args->args[1] = arg1;
     args->args[2] = arg2;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel3);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel3);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -202,6 +238,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -218,12 +257,21 @@
     args->args[2] = arg2;
     args->args[3] = arg3;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel4);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel4);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -273,6 +321,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -290,12 +341,21 @@
     args->args[3] = arg3;
     args->args[4] = arg4;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel5);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel5);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -346,6 +406,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -364,12 +427,21 @@
     args->args[4] = arg4;
     args->args[5] = arg5;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel6);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel6);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -422,6 +494,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -441,12 +516,21 @@
     args->args[5] = arg5;
     args->args[6] = arg6;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel7);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel7);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -500,6 +584,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -520,12 +607,21 @@
     args->args[6] = arg6;
     args->args[7] = arg7;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel8);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel8);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -580,6 +676,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -601,12 +700,21 @@
     args->args[7] = arg7;
     args->args[8] = arg8;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel9);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel9);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -663,6 +771,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -685,12 +796,21 @@
     args->args[8] = arg8;
     args->args[9] = arg9;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel10);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel10);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -748,6 +868,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -771,12 +894,21 @@
     args->args[9] = arg9;
     args->args[10] = arg10;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel11);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel11);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -835,6 +967,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -859,12 +994,21 @@
     args->args[10] = arg10;
     args->args[11] = arg11;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel12);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel12);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -925,6 +1069,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -950,12 +1097,21 @@
     args->args[11] = arg11;
     args->args[12] = arg12;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel13);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel13);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -1017,6 +1173,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -1043,12 +1202,21 @@
     args->args[12] = arg12;
     args->args[13] = arg13;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel14);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel14);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -1111,6 +1279,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -1138,12 +1309,21 @@
     args->args[13] = arg13;
     args->args[14] = arg14;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel15);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel15);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -1208,6 +1388,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -1236,12 +1419,21 @@
     args->args[14] = arg14;
     args->args[15] = arg15;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel16);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel16);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -1307,6 +1499,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -1336,12 +1531,21 @@
     args->args[15] = arg15;
     args->args[16] = arg16;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel17);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel17);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -1408,6 +1612,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -1438,12 +1645,21 @@
     args->args[16] = arg16;
     args->args[17] = arg17;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel18);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel18);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -1512,6 +1728,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -1543,12 +1762,21 @@
     args->args[17] = arg17;
     args->args[18] = arg18;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel19);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel19);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -1618,6 +1846,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -1650,12 +1881,21 @@
     args->args[18] = arg18;
     args->args[19] = arg19;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel20);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel20);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -1726,6 +1966,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -1759,12 +2002,21 @@
     args->args[19] = arg19;
     args->args[20] = arg20;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel21);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel21);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -1837,6 +2089,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -1871,12 +2126,21 @@
     args->args[20] = arg20;
     args->args[21] = arg21;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel22);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel22);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -1950,6 +2214,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -1985,12 +2252,21 @@
     args->args[21] = arg21;
     args->args[22] = arg22;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel23);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel23);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -2065,6 +2341,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -2101,12 +2380,21 @@
     args->args[22] = arg22;
     args->args[23] = arg23;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel24);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel24);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -2183,6 +2471,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -2220,12 +2511,21 @@
     args->args[23] = arg23;
     args->args[24] = arg24;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel25);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel25);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -2303,6 +2603,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -2341,12 +2644,21 @@
     args->args[24] = arg24;
     args->args[25] = arg25;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel26);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel26);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -2425,6 +2737,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -2464,12 +2779,21 @@
     args->args[25] = arg25;
     args->args[26] = arg26;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel27);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel27);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -2550,6 +2874,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -2590,12 +2917,21 @@
     args->args[26] = arg26;
     args->args[27] = arg27;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel28);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel28);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -2677,6 +3013,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -2718,12 +3057,21 @@
     args->args[27] = arg27;
     args->args[28] = arg28;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel29);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel29);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -2806,6 +3154,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -2848,12 +3199,21 @@
     args->args[28] = arg28;
     args->args[29] = arg29;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel30);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel30);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -2938,6 +3298,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -2981,12 +3344,21 @@
     args->args[29] = arg29;
     args->args[30] = arg30;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel31);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel31);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -3072,6 +3444,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -3116,12 +3491,21 @@
     args->args[30] = arg30;
     args->args[31] = arg31;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel32);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel32);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -3208,6 +3592,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -3253,12 +3640,21 @@
     args->args[31] = arg31;
     args->args[32] = arg32;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel33);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel33);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -3347,6 +3743,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -3393,12 +3792,21 @@
     args->args[32] = arg32;
     args->args[33] = arg33;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel34);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel34);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -3488,6 +3896,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -3535,12 +3946,21 @@
     args->args[33] = arg33;
     args->args[34] = arg34;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel35);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel35);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -3631,6 +4051,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -3679,12 +4102,21 @@
     args->args[34] = arg34;
     args->args[35] = arg35;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel36);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel36);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -3777,6 +4209,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -3826,12 +4261,21 @@
     args->args[35] = arg35;
     args->args[36] = arg36;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel37);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel37);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -3925,6 +4369,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -3975,12 +4422,21 @@
     args->args[36] = arg36;
     args->args[37] = arg37;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel38);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel38);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -4075,6 +4531,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -4126,12 +4585,21 @@
     args->args[37] = arg37;
     args->args[38] = arg38;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel39);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel39);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -4228,6 +4696,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -4280,12 +4751,21 @@
     args->args[38] = arg38;
     args->args[39] = arg39;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel40);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel40);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -4383,6 +4863,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -4436,12 +4919,21 @@
     args->args[39] = arg39;
     args->args[40] = arg40;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel41);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel41);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -4540,6 +5032,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -4594,12 +5089,21 @@
     args->args[40] = arg40;
     args->args[41] = arg41;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel42);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel42);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -4700,6 +5204,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -4755,12 +5262,21 @@
     args->args[41] = arg41;
     args->args[42] = arg42;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel43);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel43);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -4862,6 +5378,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -4918,12 +5437,21 @@
     args->args[42] = arg42;
     args->args[43] = arg43;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel44);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel44);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -5026,6 +5554,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -5083,12 +5614,21 @@
     args->args[43] = arg43;
     args->args[44] = arg44;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel45);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel45);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -5193,6 +5733,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -5251,12 +5794,21 @@
     args->args[44] = arg44;
     args->args[45] = arg45;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel46);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel46);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -5362,6 +5914,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -5421,12 +5976,21 @@
     args->args[45] = arg45;
     args->args[46] = arg46;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel47);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel47);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -5533,6 +6097,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -5593,12 +6160,21 @@
     args->args[46] = arg46;
     args->args[47] = arg47;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel48);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel48);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -5707,6 +6283,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -5768,12 +6347,21 @@
     args->args[47] = arg47;
     args->args[48] = arg48;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel49);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel49);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);
@@ -5883,6 +6471,9 @@
     PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) data);
     int pThreadCount = data_.pThreadCount;
 
+    // Graph replays collect launches and submit them together
+    PthreadBatch_t *batch = *(data_.batch);
+
     for(int p = 0; p < pThreadCount; ++p){
       PthreadKernelArg_t *args = new PthreadKernelArg_t;
       args->rank  = p;
@@ -5945,12 +6536,21 @@
     args->args[48] = arg48;
     args->args[49] = arg49;
 
+      if(batch){
+        batch->kernelLaunch.push_back(launchKernel50);
+        batch->kernelArgs.push_back(args);
+        continue;
+      }
+
       pthread_mutex_lock(data_.kernelMutex);
       data_.kernelLaunch[p]->push(launchKernel50);
       data_.kernelArgs[p]->push(args);
       pthread_mutex_unlock(data_.kernelMutex);
     }
 
+    if(batch)
+      return;
+
     pthread_mutex_lock(data_.pendingJobsMutex);
     *(data_.pendingJobs) += data_.pThreadCount;
     pthread_mutex_unlock(data_.pendingJobsMutex);